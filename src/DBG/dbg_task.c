@@ -33,9 +33,23 @@
 #include "xtime_l.h"		// Xilinx ð ̺귯
 
 #include "dbg_task.h"			//  ½ũ   
-#include "../siu/siu_task.h"	// SIU ½ũ   
+#include "../SIU/siu_task.h"	// SIU ½ũ   
 #include "../common/common.h"	//  ƿƼ Լ  
-#include "../opu/opu_task.h"	// OPU ½ũ   
+#include "../OPU/opu_task.h"	// OPU ½ũ   
+#include "../IGNU/Inc/crc.h"	// IGNU CRC Ŀ  
+#include "../common/ringbuf.h"	// SPSC   
+#include "../common/snapstore.h"	// ֽŰ    
+#include "../common/bramio.h"	// BRAM Bulk   
+#include "../common/copyeng.h"	// BRAM <-> DDR Copy Engine  
+#include "../IGNU/Inc/ignu_task.h"	// IGNU ½ũ  
+#include "../IGNU/Inc/ins_gps.h"	// IGNU IMU/GPS  
+#include "../IGNU/Inc/strapdown.h"	// IGNU ڼ   
+#include "../IGNU/Inc/navfilter.h"	// IGNU ׹   
+#include "../IGNU/Inc/history.h"	// IGNU  ð ̷  
+#include "../IGNU/Inc/timesync.h"	// IGNU GPS ð   
+#include "../IGNU/Inc/pus.h"		// IGNU PUS  й  
+#include "../IGNU/Inc/tmsched.h"	// IGNU TM ٷ  
+#include "../IGNU/Inc/TMTC.h"		// IGNU TM/TC (CCSDS)  
 
 /*==============================================================================
  * Gloabal Function
@@ -589,6 +603,307 @@ static int testImuLogFunc(int argc, char *argv[])
 	return(0);					// '0' 
 }
 
+static int testCrcBenchFunc(int argc, char *argv[])
+{
+	UInt32 uiLen = CRC_BENCH_MAX_LEN;
+	UInt32 uiIter = 1000;
+
+	if(argc > 1) uiLen = (UInt32)atoi(argv[1]);
+	if(argc > 2) uiIter = (UInt32)atoi(argv[2]);
+
+	CrcBenchmark( uiLen, uiIter );
+
+	return(0);					// '0' 
+}
+
+static int testRbStressFunc(int argc, char *argv[])
+{
+	UInt32 uiSec = 5;
+
+	if(argc > 1) uiSec = (UInt32)atoi(argv[1]);
+
+	RingBufStress( uiSec );
+
+	return(0);					// '0' 
+}
+
+static int testSnapStressFunc(int argc, char *argv[])
+{
+	UInt32 uiSec = 5;
+
+	if(argc > 1) uiSec = (UInt32)atoi(argv[1]);
+
+	SnapStoreStress( uiSec );
+
+	return(0);					// '0' 
+}
+
+static int testSnapFunc(int argc, char *argv[])
+{
+	ImuGpsSnapReport();
+
+	return(0);					// '0' 
+}
+
+static int testLatencyFunc(int argc, char *argv[])
+{
+	IgnuLatencyReport();
+
+	return(0);					// '0' 
+}
+
+static int testPoolFunc(int argc, char *argv[])
+{
+	IgnuPoolReport();
+
+	return(0);					// '0' 
+}
+
+static int testImuDecimFunc(int argc, char *argv[])
+{
+	if(argc > 1) ImuSetDecimation( (UInt32)atoi(argv[1]) );
+
+	printf( "IMU decimation : 1/%d\n", (int)ImuGetDecimation() );
+
+	return(0);					// '0' 
+}
+
+static int testImuBenchFunc(int argc, char *argv[])
+{
+	UInt32 uiRecords = IMU_RATE_HZ * 10;
+
+	if(argc > 1) uiRecords = (UInt32)atoi(argv[1]);
+
+	ImuAccumBenchmark( uiRecords );
+
+	return(0);					// '0' 
+}
+
+static int testUnpackBenchFunc(int argc, char *argv[])
+{
+	UInt32 uiPackets = 0;
+
+	if(argc > 1) uiPackets = (UInt32)atoi(argv[1]);
+
+	ImuUnpackBenchmark( uiPackets );
+
+	return(0);					// '0' 
+}
+
+static int testAttFunc(int argc, char *argv[])
+{
+	StrapdownReport();
+
+	return(0);					// '0' 
+}
+
+static int testAttBenchFunc(int argc, char *argv[])
+{
+	UInt32 uiSamples = IMU_RATE_HZ * 10;
+
+	if(argc > 1) uiSamples = (UInt32)atoi(argv[1]);
+
+	StrapdownBenchmark( uiSamples );
+
+	return(0);					// '0' 
+}
+
+static int testNavFunc(int argc, char *argv[])
+{
+	NavFilterReport();
+
+	return(0);					// '0' 
+}
+
+static int testNavBenchFunc(int argc, char *argv[])
+{
+	UInt32 uiCycles = 100;
+
+	if(argc > 1) uiCycles = (UInt32)atoi(argv[1]);
+
+	NavFilterBenchmark( uiCycles );
+
+	return(0);					// '0' 
+}
+
+static int testHistFunc(int argc, char *argv[])
+{
+	UInt32 uiAgeMs = 100;
+
+	if(argc > 1) uiAgeMs = (UInt32)atoi(argv[1]);
+
+	HistReport( uiAgeMs );
+
+	return(0);					// '0' 
+}
+
+static int testHistBenchFunc(int argc, char *argv[])
+{
+	UInt32 uiQueries = 100000;
+
+	if(argc > 1) uiQueries = (UInt32)atoi(argv[1]);
+
+	HistBenchmark( uiQueries );
+
+	return(0);					// '0' 
+}
+
+static int testTimeFunc(int argc, char *argv[])
+{
+	TimeSyncReport();
+
+	return(0);					// '0' 
+}
+
+static int testPusFunc(int argc, char *argv[])
+{
+	PusReport();
+
+	return(0);					// '0' 
+}
+
+static int testTmFunc(int argc, char *argv[])
+{
+	TmSchedReport();
+
+	return(0);					// '0' 
+}
+
+static int testTmRateFunc(int argc, char *argv[])
+{
+	UInt32 uiPhaseMs = TM_PHASE_AUTO;
+	SInt32 siRet;
+
+	if(argc < 3)
+	{
+		printf( "Usage: tmrate <product 0..%d> <period ms, 0: off> [phase ms]\n", TM_PROD_NUM - 1 );
+		return(0);
+	}
+	if(argc > 3) uiPhaseMs = (UInt32)atoi(argv[3]);
+
+	siRet = TmSchedSetRate( (UInt32)atoi(argv[1]), (UInt32)atoi(argv[2]), uiPhaseMs );
+	if( siRet != TM_SCHED_OK )
+	{
+		printf( "tmrate error %d (period: multiple of %d ms, phase < period)\n", (int)siRet, TM_SCHED_TICK_MS );
+	}
+	TmSchedReport();
+
+	return(0);					// '0' 
+}
+
+static int testCcsdsFunc(int argc, char *argv[])
+{
+	CcsdsReport();
+
+	return(0);					// '0' 
+}
+
+static int testTmSegFunc(int argc, char *argv[])
+{
+	static UInt8 ucSegBuf[16384];
+	UInt32 uiLen = 4096;
+	UInt32 i;
+	TickType_t xStart, xEnd;
+	SInt32 siRet;
+
+	if(argc > 1) uiLen = (UInt32)atoi(argv[1]);
+	if(uiLen > sizeof(ucSegBuf)) uiLen = sizeof(ucSegBuf);
+
+	/* īƮ   TM(Pong) ۽ */
+	for( i=0; i<uiLen; i++ )
+	{
+		ucSegBuf[i] = (UInt8)i;
+	}
+
+	/* TxTask ۽ Ϸ(Ǵ ߴ)  */
+	xStart = xTaskGetTickCount();
+	siRet = SendCcsdsTmSeg( PUS_SVC_DIAGNOSE, PUS_SUB_DIAG_PONG, ucSegBuf, uiLen );
+	while( (siRet == 0) && CcsdsTmSegBusy() )
+	{
+		vTaskDelay( 5 );
+	}
+	xEnd = xTaskGetTickCount();
+
+	printf( "tmseg %u bytes: %s, %u ms\n", (unsigned)uiLen, (siRet == 0) ? "OK" : "FAIL",
+		(unsigned)((xEnd - xStart) * portTICK_PERIOD_MS) );
+	CcsdsReport();
+
+	return(0);					// '0' 
+}
+
+static int testSlotStatFunc(int argc, char *argv[])
+{
+	SlotRxReport();
+
+	return(0);					// '0' 
+}
+
+static int testUartStatFunc(int argc, char *argv[])
+{
+	UartRxReport();
+
+	return(0);					// '0' 
+}
+
+static int testUartBenchFunc(int argc, char *argv[])
+{
+	UInt32 uiMs = 10000;
+	UInt32 uiPeriodMs = DELAY_5_MSECOND;
+
+	if(argc > 1) uiMs = (UInt32)atoi(argv[1]);
+	if(argc > 2) uiPeriodMs = (UInt32)atoi(argv[2]);
+
+	UartRxBenchmark( uiMs, uiPeriodMs );
+
+	return(0);					// '0' 
+}
+
+static int testBramBenchFunc(int argc, char *argv[])
+{
+	UInt32 uiLen = UART_BRAM_SIZE;
+	UInt32 uiIter = 1000;
+
+	if(argc > 1) uiLen = (UInt32)atoi(argv[1]);
+	if(argc > 2) uiIter = (UInt32)atoi(argv[2]);
+
+	BramBenchmark( uiLen, uiIter );
+
+	return(0);					// '0' 
+}
+
+static int testCopyStatFunc(int argc, char *argv[])
+{
+	CopyEngReport();
+
+	return(0);					// '0' 
+}
+
+static int testCopyBenchFunc(int argc, char *argv[])
+{
+	UInt32 uiLen = UART_BRAM_SIZE;
+	UInt32 uiCnt = COPY_QUEUE_LEN;
+
+	if(argc > 1) uiLen = (UInt32)atoi(argv[1]);
+	if(argc > 2) uiCnt = (UInt32)atoi(argv[2]);
+
+	CopyEngBenchmark( uiLen, uiCnt );
+
+	return(0);					// '0' 
+}
+
+static int testImuStatFunc(int argc, char *argv[])
+{
+	ImuParseStat_t stStat;
+
+	ImuGetRateStats( &stStat );
+
+	printf( "IMU records %u, sync error %u, counter gap %u (lost %u), partial payload %u\n",
+		(unsigned)stStat.uiRecords, (unsigned)stStat.uiSyncErr, (unsigned)stStat.uiCntGap,
+		(unsigned)stStat.uiCntLost, (unsigned)stStat.uiTrailing );
+
+	return(0);					// '0' 
+}
+
 /**
  * @fn UsrCmdList
  * @brief Initialize and list user commands
@@ -600,6 +915,34 @@ static void UsrCmdList(void)
 	UsrCmdSet( "uart", testUartLogFunc,"UART Log Function Command",'N',"\0");
 	UsrCmdSet( "gps", testGpsLogFunc,"GPS Log Function Command",'N',"\0");
 	UsrCmdSet( "imu", testImuLogFunc,"IMU Log Function Command",'N',"\0");
+	UsrCmdSet( "crc", testCrcBenchFunc,"CRC Benchmark (crc <len> <iter>)",'N',"\0");
+	UsrCmdSet( "rbstress", testRbStressFunc,"SPSC Ring Buffer Stress Test (rbstress <sec>)",'N',"\0");
+	UsrCmdSet( "snstress", testSnapStressFunc,"Snapshot Store Stress Test (snstress <sec>)",'N',"\0");
+	UsrCmdSet( "snap", testSnapFunc,"Latest IMU/GPS Snapshot Sequence / Age",'N',"\0");
+	UsrCmdSet( "lat", testLatencyFunc,"COM1 Command-to-Ack Latency (print & reset)",'N',"\0");
+	UsrCmdSet( "pool", testPoolFunc,"IGNU Buffer Pool Occupancy / High-water",'N',"\0");
+	UsrCmdSet( "imudec", testImuDecimFunc,"IMU -> IGNU Forwarding Ratio (imudec <n>)",'N',"\0");
+	UsrCmdSet( "imubench", testImuBenchFunc,"Full-rate IMU Path Benchmark (imubench <records>)",'N',"\0");
+	UsrCmdSet( "imustat", testImuStatFunc,"Full-rate IMU Record Check Statistics",'N',"\0");
+	UsrCmdSet( "upkbench", testUnpackBenchFunc,"IMU 24-bit Unpack Benchmark (upkbench [packets], default 1k/10k)",'N',"\0");
+	UsrCmdSet( "att", testAttFunc,"Strapdown Attitude / Per-sample Cost",'N',"\0");
+	UsrCmdSet( "attbench", testAttBenchFunc,"Strapdown Propagation Benchmark (attbench <samples>)",'N',"\0");
+	UsrCmdSet( "nav", testNavFunc,"GPS/INS Filter State / Step Timing",'N',"\0");
+	UsrCmdSet( "navbench", testNavBenchFunc,"GPS/INS Filter Benchmark (navbench <gps cycles>)",'N',"\0");
+	UsrCmdSet( "hist", testHistFunc,"IMU/GPS/TPVAW History Span / Query (hist <age ms>)",'N',"\0");
+	UsrCmdSet( "hisbench", testHistBenchFunc,"History Lookup Benchmark (hisbench <queries>)",'N',"\0");
+	UsrCmdSet( "time", testTimeFunc,"GPS Time Correlation State / Sample-to-TM Latency",'N',"\0");
+	UsrCmdSet( "pus", testPusFunc,"PUS TC Handlers: Calls / Length Errors / Execution Time",'N',"\0");
+	UsrCmdSet( "tm", testTmFunc,"TM Scheduler: Product Rates / Phases / Burst Load",'N',"\0");
+	UsrCmdSet( "tmrate", testTmRateFunc,"Set TM Product Rate: tmrate <product> <period ms> [phase ms]",'N',"\0");
+	UsrCmdSet( "ccsds", testCcsdsFunc,"CCSDS Sequence Counters / Segmented TM / TC Reassembly",'N',"\0");
+	UsrCmdSet( "tmseg", testTmSegFunc,"Segmented TM Test: tmseg <bytes>",'N',"\0");
+	UsrCmdSet( "uartstat", testUartStatFunc,"RS422 RX Statistics",'N',"\0");
+	UsrCmdSet( "slotstat", testSlotStatFunc,"LVDS Slot RX Statistics",'N',"\0");
+	UsrCmdSet( "uarbench", testUartBenchFunc,"RS422 RX Drain Bench: uarbench <ms> <period ms>",'N',"\0");
+	UsrCmdSet( "brmbench", testBramBenchFunc,"BRAM Copy Bench: brmbench <bytes> <iter>",'N',"\0");
+	UsrCmdSet( "copystat", testCopyStatFunc,"Copy Engine Statistics",'N',"\0");
+	UsrCmdSet( "cpybench", testCopyBenchFunc,"Copy Engine Bench: cpybench <bytes> <count>",'N',"\0");
 }
 
 
@@ -19,7 +19,7 @@
  * Define
  *============================================================================*/
 #define MAX_KISS_BUF    1024 // Max payload size for KISS frames
-#define MAX_TM_DATA     512  // Max Telemetry Data Size
+#define TM_BURST_MAX    8    // Packets per SendCcsdsTmBurst call
 
 /* CSP Definitions */
 #define CSP_HEADER_SIZE 4
@@ -36,6 +36,30 @@
 #define CCSDS_PRI_HEADER_SIZE 6
 #define CCSDS_TC_SEC_HEADER_SIZE 4   // TC: Svc(1)+Sub(1)+Src(2)
 #define CCSDS_TM_SEC_HEADER_SIZE 12  // TM: Svc(1)+Sub(1)+Src(2)+Time(6)+Flags(1)+Spare(1) = 12 Bytes
+#define CCSDS_APID_TM       0x023B // TM APID for PDHS (standard packets)
+#define CCSDS_APID_TM_BULK  0x023C // TM APID for segmented bulk products
+
+/* TM APIDs with their own sequence counter */
+#define TM_APID_STD         0
+#define TM_APID_BULK        1
+#define TM_APID_NUM         2
+
+/* Sequence Flags (Primary Header bits 15-14 of Sequence Control) */
+#define CCSDS_SEQ_CONT      0x0  // Continuation segment
+#define CCSDS_SEQ_FIRST     0x1  // First segment
+#define CCSDS_SEQ_LAST      0x2  // Last segment
+#define CCSDS_SEQ_UNSEG     0x3  // Unsegmented packet
+#define CCSDS_SEQ_CNT_MASK  0x3FFF
+
+/* Segmentation: every segment repeats the secondary header and carries
+ * up to CCSDS_SEG_DATA_MAX bytes, which fits one COM1 TX ring record even
+ * if every byte needs KISS escaping. */
+#define CCSDS_SEG_DATA_MAX  ((((UART_BRAM_SIZE - 4) - 3) / 2) - CSP_HEADER_SIZE - CSP_CRC32_SIZE \
+                             - CCSDS_PRI_HEADER_SIZE - CCSDS_TM_SEC_HEADER_SIZE - 2)
+#define CCSDS_SEG_TIMEOUT_MS 1000  // Ring full this long: abort the transfer
+#define CCSDS_TM_SEG_MAX    16384  // Largest segmented TM user data (copied for TxTask)
+#define CCSDS_TC_REASM_MAX  16384  // Largest reassembled TC user data
+#define CCSDS_TC_REASM_TIMEOUT_MS 1000 // Gap between TC segments
 
 /* Response Constants (Table 9) */
 #define TM_ACK_VALID        0xFF // Valid TC
@@ -59,6 +83,11 @@
 
 /* Service 5: Housekeeping */
 #define PUS_SUB_HK_REQ      1    // One Shot HK Request / Report
+#define PUS_SUB_HK_IMU      2    // TM: IMU Sample (periodic)
+#define PUS_SUB_HK_GPS      3    // TM: GPS Fix (periodic)
+#define PUS_SUB_HK_NAV      4    // TM: Filter State (periodic)
+#define PUS_SUB_HK_SET_RATE 31   // TC: Set TM Product Period / Phase
+#define TM_RATE_CMD_SIZE    5    // Product(1) + Period ms(2, BE) + Phase ms(2, BE)
 
 /* Service 8: Function Management */
 #define PUS_SUB_FUNC_EXEC   1    // Perform Function
@@ -70,6 +99,26 @@
 /*==============================================================================
  * Type Definition
  *============================================================================*/
+/* KISS Frame Handler: pFrame (CSP packet, KISS command byte removed) is valid only during the call */
+typedef void (*KissFrameHandler_t)(UInt8 *pFrame, UInt32 uiLen, void *pArg);
+
+/* TX Scatter-Gather Segment */
+typedef struct {
+    const UInt8 *pData;
+    UInt32 uiLen;
+} TxIov_t;
+
+/* TM Packet of a burst (ucSent set by SendCcsdsTmBurst) */
+typedef struct {
+    UInt8 ucSvc;
+    UInt8 ucSub;
+    UInt8 ucApid;           // TM_APID_xxx
+    UInt8 ucSeqFlags;       // CCSDS_SEQ_xxx
+    UInt8 ucSent;
+    const UInt8 *pData;
+    UInt32 uiLen;
+} TmPacket_t;
+
 typedef struct {
     UInt8 pri;
     UInt8 dest;
@@ -79,6 +128,27 @@ typedef struct {
     UInt8 flags;
 } csp_header_t;
 
+/* Sequence Counter per TM APID */
+typedef struct {
+    UInt16 usApid;
+    UInt16 usSeq;           // Next sequence count
+    UInt32 uiPkt;           // Packets queued
+} CcsdsApidCnt_t;
+
+/* Segmented TM / TC Reassembly Statistics */
+typedef struct {
+    UInt32 uiTmXfer;        // Segmented TM transfers completed
+    UInt32 uiTmSeg;         // Segments queued
+    UInt32 uiTmAbort;       // Transfers aborted (ring full too long)
+    UInt32 uiTmMaxMs;       // Longest transfer
+    UInt32 uiTmOversize;    // Burst packets larger than one record (not sent)
+    UInt32 uiTcDone;        // TCs reassembled
+    UInt32 uiTcSeg;         // Segments received
+    UInt32 uiTcSeqErr;      // Missing / foreign segment
+    UInt32 uiTcOverflow;    // Larger than CCSDS_TC_REASM_MAX
+    UInt32 uiTcTimeout;     // Gap longer than CCSDS_TC_REASM_TIMEOUT_MS
+} CcsdsSegStats_t;
+
 /* ============================================================================
  * 6.2.1 Payload Status Telemetry (Reply Status)
  * Total Size: 6 Bytes (ICD Compliant)
@@ -140,6 +210,72 @@ typedef struct __attribute__((packed)) {
     UInt32 reserved[5];     // 20 bytes (Restored)
 } TestData_t;
 
+/* ============================================================================
+ * IMU Sample Telemetry (Svc 5, Sub 2), latest STIM record
+ * Total Size: 32 Bytes
+ * ============================================================================ */
+typedef struct __attribute__((packed)) {
+    UInt8  counter;         // STIM counter
+    UInt8  _reserved[3];
+    float  gyroX;           // deg/s
+    float  gyroY;
+    float  gyroZ;
+    float  accX;            // g
+    float  accY;
+    float  accZ;
+    float  temp;            // degC
+} ImuSampleTm_t;
+
+/* ============================================================================
+ * GPS Fix Telemetry (Svc 5, Sub 3), latest receiver PVT
+ * Total Size: 72 Bytes
+ * ============================================================================ */
+typedef struct __attribute__((packed)) {
+    UInt32 gpsWeek;
+    UInt32 gpsTime;         // TOW (ms)
+    double lat;             // deg
+    double lon;             // deg
+    float  alt;             // m
+    float  velN;            // m/s
+    float  velE;
+    float  velU;
+    UInt8  mode;
+    UInt8  error;
+    UInt8  NrSV;
+    UInt8  _reserved_align;
+    float  undulation;      // m
+    float  cog;             // deg
+    double rxClkBias;       // ms
+    float  rxClkDrift;      // ppm
+    UInt16 hAccuracy;       // cm
+    UInt16 vAccuracy;       // cm
+    UInt16 latency;         // 0.1 ms
+    UInt16 _reserved;
+} GpsFixTm_t;
+
+/* ============================================================================
+ * Filter State Telemetry (Svc 5, Sub 4), GPS/INS solution
+ * Total Size: 88 Bytes
+ * ============================================================================ */
+typedef struct __attribute__((packed)) {
+    UInt8  navValid;        // 1: filter initialised from GPS
+    UInt8  attAligned;      // 1: attitude initialised from TPVAW
+    UInt8  timeState;       // TIME_STATE_xxx
+    UInt8  _reserved;
+    double lat;             // deg
+    double lon;             // deg
+    float  alt;             // m
+    float  velN;            // m/s
+    float  velE;
+    float  velU;
+    float  q[4];            // Attitude quaternion (w, x, y, z)
+    float  roll;
+    float  pitch;
+    float  yaw;
+    float  accBias[3];      // m/s^2
+    float  gyroBias[3];     // rad/s
+} NavStateTm_t;
+
 /* ============================================================================
  * TPVAW Data Structure (Received from PDHS)
  * Total Size: 108 Bytes (Based on main.py struct format)
@@ -178,9 +314,17 @@ typedef struct __attribute__((packed)) {
  * Global Function Declarations
  *============================================================================*/
 SInt32 KissDecode(UInt8 ucByte, UInt8 *pDecodedBuf);
+SInt32 KissDecodeBlock(const UInt8 *pData, UInt32 uiLen, KissFrameHandler_t pfnFrame, void *pArg);
 SInt32 CspReceive(UInt8 *pPacket, SInt32 siLen);
 SInt32 CspSend(UInt8 dest, UInt8 dport, UInt8 *pData, UInt32 uiLen);
+SInt32 CspSendv(UInt8 dest, UInt8 dport, const TxIov_t *pIov, UInt32 uiIovCnt);
+void TmtcInit(void);
 void SendResponse(UInt8 ucSvc, UInt8 ucSub, UInt8 ucAck);
 void SendTestData(void);
+UInt32 SendCcsdsTmBurst(TmPacket_t *pPkt, UInt32 uiCnt);
+SInt32 SendCcsdsTmSeg(UInt8 ucSvc, UInt8 ucSub, const UInt8 *pData, UInt32 uiLen);
+UInt32 CcsdsTmSegBusy(void);
+void CcsdsTmSegPump(void);
+void CcsdsReport(void);
 
 #endif /* __TMTC_H__ */
@@ -0,0 +1,55 @@
+/**
+ * @file crc.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief CSP CRC-32C / CCSDS CRC-16 Kernels Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __CRC_H__
+#define __CRC_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "../../common/common.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+/* Kernel Variants */
+#define CRC_IMPL_BITWISE    0    // Bit-serial (reference)
+#define CRC_IMPL_TABLE      1    // Table-driven, 1 Byte per step
+#define CRC_IMPL_SLICE8     2    // Slicing-by-8, 8 Bytes per step
+
+/* Build-time selection (e.g. -DIGNU_CRC_IMPL=CRC_IMPL_TABLE) */
+#ifndef IGNU_CRC_IMPL
+#define IGNU_CRC_IMPL       CRC_IMPL_SLICE8
+#endif
+
+#define CRC32C_POLY         0x82F63B78  // CSP CRC-32C (Castagnoli, Reflected)
+#define CRC16_POLY          0x1021      // CCSDS CRC-16 (CCITT-FALSE)
+
+#define CRC_BENCH_MAX_LEN   4096        // Benchmark Buffer Size
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+void CrcInit(void);
+
+/* CSP CRC-32C (Streaming: Init -> Update xN -> Final) */
+UInt32 Crc32cInit(void);
+UInt32 Crc32cUpdate(UInt32 uiCrc, const UInt8 *pData, UInt32 uiLen);
+UInt32 Crc32cFinal(UInt32 uiCrc);
+
+/* CCSDS CRC-16 (Streaming: Init -> Update xN -> Final) */
+UInt16 Crc16Init(void);
+UInt16 Crc16Update(UInt16 usCrc, const UInt8 *pData, UInt32 uiLen);
+UInt16 Crc16Final(UInt16 usCrc);
+
+/* Throughput of every variant (MB/s) */
+void CrcBenchmark(UInt32 uiLen, UInt32 uiIter);
+
+#endif /* __CRC_H__ */
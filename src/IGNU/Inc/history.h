@@ -0,0 +1,106 @@
+/**
+ * @file history.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Time-Tagged Sample History (IMU / GPS / TPVAW) Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Every stream keeps its recent samples in a ring ordered by a common
+ * timebase, the Cortex-A9 global timer (XTime counts). FreeRTOS ticks and
+ * GPS TOW are converted to that timebase with HistTickToStamp and
+ * HistTowToStamp. A query at an arbitrary time finds the two bracketing
+ * samples by binary search (O(log n)) and interpolates between them:
+ * linear for IMU / GPS / TPVAW position and velocity, SLERP for the TPVAW
+ * attitude.
+ *
+ * One writer per stream, any number of readers. Readers never lock: they
+ * search in place, copy only the two bracketing samples and repeat the
+ * search if the writer overwrote one of them meanwhile.
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __HISTORY_H__
+#define __HISTORY_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "ins_gps.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+/* Depth per stream (power of two) */
+#define HIST_IMU_DEPTH      4096        // ~2 s at IMU_RATE_HZ
+#define HIST_GPS_DEPTH      64          // GPS fixes
+#define HIST_TPVAW_DEPTH    32          // TPVAW commands
+
+/* Slots next to the write position that queries leave alone */
+#define HIST_GUARD          4
+#define HIST_RETRY_MAX      8
+
+/* Query Result */
+#define HIST_OK             0
+#define HIST_ERR_EMPTY      (-1)        // Nothing recorded yet
+#define HIST_ERR_OLD        (-2)        // Query before the oldest sample kept
+#define HIST_ERR_NEW        (-3)        // Query after the newest sample
+#define HIST_ERR_BUSY       (-4)        // Writer kept overwriting the bracket
+
+/* Static initializer over caller storage */
+#define HIST_RING_INIT(stamp, data, size, depth)    { (stamp), (UInt8 *)(data), (size), (depth) - 1, 0, 0, 0, 0, 0 }
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+#pragma pack(push)
+#pragma pack()
+/* Generic Ring (stamps kept apart from the samples for the search) */
+typedef struct {
+    UInt64 *pStamp;             // XTime per slot
+    UInt8 *pData;               // Samples
+    UInt32 uiSize;              // Sample Size
+    UInt32 uiMask;              // Depth - 1
+    volatile UInt32 uiHead;     // Samples written (next slot = uiHead & uiMask)
+    UInt32 uiOrderErr;          // Pushes rejected, stamp going back
+    volatile UInt32 uiQuery;    // Queries
+    volatile UInt32 uiMiss;     // Queries outside the kept span
+    volatile UInt32 uiRetry;    // Searches repeated after an overwrite
+} HistRing_t;
+
+/* TPVAW sample (attitude as [w, x, y, z]) */
+typedef struct {
+    double dTime1;
+    double dTime2;
+    double dPos[3];
+    double dVel[3];
+    float fQ[4];
+} HistTpvaw_t;
+#pragma pack(pop)
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+/* Generic Ring */
+SInt32 HistPush(HistRing_t *pRing, UInt64 ullStamp, const void *pData);
+SInt32 HistFind(HistRing_t *pRing, UInt64 ullStamp, void *pA, void *pB, float *pFrac);
+UInt32 HistSpan(HistRing_t *pRing, UInt64 *pOldest, UInt64 *pNewest);
+
+/* Timebase */
+UInt64 HistNow(void);
+UInt64 HistTickToStamp(UInt32 uiTick);
+SInt32 HistTowToStamp(UInt32 uiTowMs, UInt64 *pStamp);
+
+/* Streams */
+void HistImuPush(const ImuData_t *pImu, UInt32 uiCnt, UInt64 ullStampLast);
+void HistGpsPush(const GpsData_t *pGps, UInt64 ullStamp);
+void HistTpvawPush(const HistTpvaw_t *pTpvaw, UInt64 ullStamp);
+
+SInt32 HistImuAt(UInt64 ullStamp, ImuData_t *pImu);
+SInt32 HistGpsAt(UInt64 ullStamp, GpsData_t *pGps);
+SInt32 HistTpvawAt(UInt64 ullStamp, HistTpvaw_t *pTpvaw);
+
+void HistReport(UInt32 uiAgeMs);
+void HistBenchmark(UInt32 uiQueries);
+
+#endif /* __HISTORY_H__ */
@@ -19,6 +19,18 @@
 #include "queue.h"
 #include "../../common/common.h"
 #include "../../OPU/opu_task.h" // For sRbData
+#include "../../common/bufpool.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+/* Queues carry sRbData pointers from stIgnuRbPool */
+#define IGNU_IMU_QUEUE_LEN      4   // IMU Data Queue Depth
+#define IGNU_GPS_QUEUE_LEN      2   // GPS Data Queue Depth
+#define IGNU_COM1_QUEUE_LEN     4   // COM1 Data Queue Depth
+
+/* Queued + one in flight per producer (gps/imu/uart_thread) and consumer, + spare */
+#define IGNU_RB_POOL_CNT        (IGNU_IMU_QUEUE_LEN + IGNU_GPS_QUEUE_LEN + IGNU_COM1_QUEUE_LEN + 6)
 
 /*==============================================================================
  * Gloabal Variables Extern
@@ -26,6 +38,7 @@
 extern QueueHandle_t xImuDataQueue;
 extern QueueHandle_t xGpsDataQueue;
 extern QueueHandle_t xCom1DataQueue;
+extern sBufPool stIgnuRbPool;
 
 /*==============================================================================
  * Type Definition
@@ -44,4 +57,14 @@ void TxTask( void *pvParameters );
 void SetIgnuState(IgnuState_t eState);
 IgnuState_t GetIgnuState(void);
 
+/* sRbData Pool (Alloc -> fill -> IgnuRbPost, IgnuTask releases) */
+sRbData *IgnuRbAlloc(void);
+SInt32 IgnuRbPost(QueueHandle_t xQueue, sRbData *pRbData);
+void IgnuPoolReport(void);
+
+/* Command-to-Ack Latency (COM1 BRAM read -> response TM committed to the COM1 TX ring) */
+void IgnuCmdRxStamp(void);
+void IgnuCmdAckStamp(void);
+void IgnuLatencyReport(void);
+
 #endif /* __IGNU_TASK_H__ */
@@ -13,6 +13,7 @@
  *============================================================================*/
 #include "FreeRTOS.h"
 #include "../../common/common.h"
+#include "../../common/snapstore.h"
 
 /*==============================================================================
  * Define
@@ -20,11 +21,25 @@
 /* IMU Packet Definitions */
 #define IMU_PACKET_SIZE     42
 #define IMU_SYNC_BYTE       0xA5
+#define IMU_COUNTER_OFFSET  35
+#define IMU_BATCH_MAX       36      // Records per sRbData payload (MAX_RB_DATA / IMU_PACKET_SIZE)
+#define IMU_AXES            6       // Gyro X/Y/Z, Accel X/Y/Z
+
+/* NEON unpack kernel (needs -mfpu=neon or neon-vfpv3; scalar fallback otherwise) */
+#if defined(__ARM_NEON) && !defined(SIM_HOST)
+#define IMU_UNPACK_NEON     1
+#else
+#define IMU_UNPACK_NEON     0
+#endif
 
 /* GPS Packet Definitions */
 #define GPS_RAW_PACKET_SIZE 91
 #define GPS_SYNC_WORD       0x2440
 
+/* Full-rate IMU Path */
+#define IMU_RATE_HZ         2000    // STIM300 Sample Rate (Benchmark Reference)
+#define IMU_DECIM_DEFAULT   10      // imu_thread -> IgnuTask forwarding ratio
+
 /* Scale Factors */
 #define ACCEL_SCALE_FACTOR  524288.0f 
 #define GYRO_SCALE_FACTOR   524288.0f 
@@ -97,6 +112,7 @@ typedef struct {
     float  rxClkDrift;
     UInt16 hAccuracy;
     UInt16 vAccuracy;
+    UInt16 latency;     // Receiver output latency (0.1 ms)
 } GpsData_t;
 
 
@@ -111,6 +127,31 @@ typedef struct {
     UInt8 ucCounter;
 } ImuData_t;
 
+/*
+ * 3. IMU Payload Parse Statistics (running, per stream)
+ * ucNextCnt / ucCntValid carry the counter check across payloads.
+ */
+typedef struct {
+    UInt32 uiRecords;   // Records decoded
+    UInt32 uiSyncErr;   // Records rejected (sync byte)
+    UInt32 uiCntGap;    // Counter discontinuities
+    UInt32 uiCntLost;   // Records missing according to the counter
+    UInt32 uiTrailing;  // Payloads with a partial record at the end
+    UInt8  ucNextCnt;   // Expected counter of the next record
+    UInt8  ucCntValid;  // 0: next record restarts the counter check
+} ImuParseStat_t;
+
+/*
+ * 4. Full-rate IMU Accumulator
+ * Raw 24-bit sums (exact, no float per sample), reset every TM interval.
+ */
+typedef struct {
+    SInt64 sllSumGyro[3];
+    SInt64 sllSumAcc[3];
+    UInt32 uiCnt;       // Records accumulated
+    UInt32 uiSyncErr;   // Records rejected (sync byte)
+} ImuAccum_t;
+
 /*==============================================================================
  * Global Function Declarations
  *============================================================================*/
@@ -121,7 +162,20 @@ float GetImuGyroTempX(const UInt8 *pData); /* Added */
 void PrintFloat(float val);
 void SetImuData(ImuData_t *pData);
 void GetImuData(ImuData_t *pData);
+SInt32 GetImuSnapshot(ImuData_t *pData, sSnapInfo *pInfo);
 UInt32 GetImuLastTick(void); /* Added for Status Check */
+void ImuUnpackBatch(const UInt8 *pData, UInt32 uiRecords, float *pOut);
+void ImuUnpackBenchmark(UInt32 uiPackets);
+UInt32 ParseImuPayload(const UInt8 *pData, UInt32 uiLen, ImuData_t *pOutput, UInt32 uiMaxOut, ImuParseStat_t *pStat);
+
+/* Full-rate IMU Functions */
+UInt32 ImuAccumulate(const UInt8 *pData, UInt32 uiLen, ImuData_t *pOutput, UInt32 uiMaxOut);
+UInt32 ImuTakeMean(ImuData_t *pMean);
+UInt32 ImuPeekMean(ImuData_t *pMean);
+void ImuSetDecimation(UInt32 uiRatio);
+UInt32 ImuGetDecimation(void);
+void ImuAccumBenchmark(UInt32 uiRecords);
+void ImuGetRateStats(ImuParseStat_t *pStat);
 
 /* GPS Functions */
 /* 
@@ -131,6 +185,8 @@ UInt32 GetImuLastTick(void); /* Added for Status Check */
 SInt32 ParseGpsPacket(const UInt8 *pRawData, GpsData_t *pOutput);
 void SetGpsData(GpsData_t *pData);
 void GetGpsData(GpsData_t *pData);
+SInt32 GetGpsSnapshot(GpsData_t *pData, sSnapInfo *pInfo);
+void ImuGpsSnapReport(void);
 void PrintDouble(double val);
 
 #endif /* __INS_GPS_H__ */
@@ -0,0 +1,109 @@
+/**
+ * @file navfilter.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Loosely Coupled GPS/INS Error-State Kalman Filter Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * INS mechanisation (local NED frame, origin at the first GPS fix) runs at
+ * IMU rate on the strapdown attitude. The 15-state error covariance
+ * [dPos dVel dPsi dGyroBias dAccBias] is propagated every NAV_COV_DECIM
+ * samples and updated with GPS position / velocity as six sequential
+ * scalar measurements (no matrix inverse). The covariance is stored as a
+ * packed upper triangle; all buffers are fixed size, nothing is allocated.
+ *
+ * Everything runs in imu_thread. GPS fixes are handed over by IgnuTask
+ * with NavFilterGpsPost and applied before the next IMU batch.
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __NAVFILTER_H__
+#define __NAVFILTER_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "ins_gps.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define NAV_STATES          15
+#define NAV_P_SIZE          ((NAV_STATES * (NAV_STATES + 1)) / 2)   // Packed Upper Triangle
+#define NAV_SYM_ROW(i)      (((i) * ((2 * NAV_STATES) + 1 - (i))) / 2)
+
+/* Error State Index */
+#define NAV_X_POS           0
+#define NAV_X_VEL           3
+#define NAV_X_PSI           6
+#define NAV_X_BG            9
+#define NAV_X_BA            12
+
+#define NAV_COV_DECIM       20          // Covariance propagation every 20 samples (100 Hz)
+#define NAV_GRAVITY         9.80665f    // m/s^2
+#define NAV_GATE_SIGMA2     25.0f       // Innovation gate (5 sigma)^2
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+/* Filter Output (geodetic, radians like GpsData_t) */
+typedef struct {
+    double dLat;
+    double dLon;
+    double dHeight;
+    float  fVn;
+    float  fVe;
+    float  fVu;
+    float  fAccBias[3];     // m/s^2
+    float  fGyroBias[3];    // rad/s
+    UInt32 uiValid;         // 0: waiting for the first GPS fix
+} NavOutput_t;
+
+/* Filter Instance */
+typedef struct {
+    /* Nominal State (NED, origin at first fix) */
+    double dPos[3];         // m
+    float fVel[3];          // m/s
+    float fAccBias[3];      // m/s^2
+    float fGyroBias[3];     // rad/s (total, also applied in the strapdown)
+    float fP[NAV_P_SIZE];   // Error Covariance (packed upper triangle)
+
+    /* Covariance propagation interval */
+    float fFnSum[3];        // Sum of nav-frame specific force
+    UInt32 uiCovCnt;        // Samples since last propagation
+
+    /* Local Frame */
+    double dLat0, dLon0, dH0;
+    double dRn, dRe;        // Meridian / Transverse radius + height (m)
+    double dCosLat0;
+    UInt32 uiInit;
+
+    /* Scratch (dense) for the propagation kernel */
+    float fPhi[NAV_STATES][NAV_STATES];
+    float fTmp[NAV_STATES][NAV_STATES];
+} NavFilter_t;
+
+/* Timing / Health */
+typedef struct {
+    UInt32 uiPropCnt;       // Covariance propagations
+    UInt32 uiPropMaxNs;
+    UInt64 ullPropNs;
+    UInt32 uiUpdCnt;        // GPS updates
+    UInt32 uiUpdMaxNs;
+    UInt64 ullUpdNs;
+    UInt32 uiGpsInvalid;    // Fixes without PVT
+    UInt32 uiGpsRejected;   // Measurements outside the gate
+} NavTiming_t;
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+void NavFilterGpsPost(const GpsData_t *pGps);
+void NavFilterUpdate(const ImuData_t *pImu, UInt32 uiCnt);
+UInt32 NavFilterGetOutput(NavOutput_t *pOut);
+
+void NavFilterReport(void);
+void NavFilterBenchmark(UInt32 uiCycles);
+
+#endif /* __NAVFILTER_H__ */
@@ -0,0 +1,76 @@
+/**
+ * @file pus.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief PUS Service / Subtype Dispatch Registry Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Telecommand handlers are registered at init for a service and a range of
+ * subtypes, together with the accepted user data length. Dispatch is two
+ * table lookups (service -> slot, slot / subtype -> handler), independent
+ * of the number of handlers. Every handler keeps its call count, length
+ * rejections and execution time.
+ *
+ * Registration is not locked: register before the IGNU tasks start.
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __PUS_H__
+#define __PUS_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "../../common/common.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define PUS_SVC_SLOTS       8           // Distinct services
+#define PUS_HANDLER_MAX     32          // Registered handlers
+#define PUS_LEN_ANY         0xFFFF      // No upper length limit
+
+/* Dispatch Result */
+#define PUS_OK              0
+#define PUS_ERR_SERVICE     (-1)        // Service not registered
+#define PUS_ERR_SUBTYPE     (-2)        // Subtype not registered for the service
+#define PUS_ERR_LENGTH      (-3)        // User data length outside the handler limits
+#define PUS_ERR_FULL        (-4)        // Registration: table full
+#define PUS_ERR_OVERLAP     (-5)        // Registration: subtype already taken
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+/* Handler: pData / uiLen is the TC user data (CRC excluded), valid during the call */
+typedef void (*PusHandler_t)(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen);
+
+#pragma pack(push)
+#pragma pack()
+typedef struct {
+    PusHandler_t pfnHandler;
+    const char *pName;
+    UInt8 ucSvc;
+    UInt8 ucSubMin;
+    UInt8 ucSubMax;
+    UInt16 usMinLen;
+    UInt16 usMaxLen;
+
+    /* Profiling */
+    UInt32 uiCnt;
+    UInt32 uiLenErr;
+    UInt32 uiMaxNs;
+    UInt64 ullSumNs;
+} PusEntry_t;
+#pragma pack(pop)
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+SInt32 PusRegister(UInt8 ucSvc, UInt8 ucSubMin, UInt8 ucSubMax, UInt16 usMinLen, UInt16 usMaxLen,
+                   PusHandler_t pfnHandler, const char *pName);
+SInt32 PusDispatch(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen);
+
+void PusReport(void);
+
+#endif /* __PUS_H__ */
@@ -0,0 +1,71 @@
+/**
+ * @file strapdown.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Quaternion Strapdown Attitude Propagation Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Attitude (body -> navigation quaternion) is propagated at IMU rate from
+ * the gyro of every decoded STIM record, with a two-sample coning
+ * correction. It starts from the quaternion of the last TPVAW command and
+ * takes attitude / gyro bias corrections from the navigation filter.
+ * Earth rate and transport rate are not compensated.
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __STRAPDOWN_H__
+#define __STRAPDOWN_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "ins_gps.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define STRAPDOWN_DT        (1.0f / IMU_RATE_HZ)    // Sample Period (s)
+
+/*
+ * Per-sample budget: 2 us = ~1330 cycles at 667 MHz, 0.4 % of the 500 us
+ * sample period at 2 kHz. One step is ~60 FLOPs, no trig / sqrt / divide.
+ */
+#define STRAPDOWN_BUDGET_NS 2000
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+/* Propagation State */
+typedef struct {
+    float fQ[4];            // Body -> Nav Quaternion [w, x, y, z]
+    float fPrevAlpha[3];    // Previous Delta Angle (rad), coning term
+    float fGyroBias[3];     // Subtracted from every gyro sample (deg/s)
+    UInt32 uiPrevValid;     // 0: first sample after init
+} StrapdownState_t;
+
+/* Cost Statistics */
+typedef struct {
+    UInt32 uiSamples;       // Samples propagated
+    UInt32 uiBatches;       // StrapdownUpdate calls
+    UInt32 uiMaxNs;         // Worst per-sample cost of a batch
+    UInt32 uiOverBudget;    // Batches above STRAPDOWN_BUDGET_NS per sample
+    UInt64 ullSumNs;        // Total time in StrapdownUpdate
+} StrapdownStats_t;
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+void StrapdownInit(float fW, float fX, float fY, float fZ);
+void StrapdownUpdate(const ImuData_t *pImu, UInt32 uiCnt);
+UInt32 StrapdownGetEuler(float *pRoll, float *pPitch, float *pYaw);
+void StrapdownGetQuat(float *pQ);
+void StrapdownApplyCorrection(const float *pDPsi, const float *pDGyroBias);
+
+void QuatToEuler(const float *pQ, float *pRoll, float *pPitch, float *pYaw);
+void QuatSlerp(const float *pQa, const float *pQb, float fT, float *pQ);
+
+void StrapdownReport(void);
+void StrapdownBenchmark(UInt32 uiSamples);
+
+#endif /* __STRAPDOWN_H__ */
@@ -0,0 +1,111 @@
+/**
+ * @file timesync.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief GPS Time Correlation and CCSDS Time Stamps Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * The Cortex-A9 global timer (XTime) is the on-board timebase. Every GPS
+ * fix ties one XTime value to GPS time: the fix epoch is its arrival time
+ * minus the receiver output latency, and its GPS time is week / TOW
+ * corrected by the receiver clock bias. A second-order loop steers the
+ * model
+ *
+ *     GPS time = Ref GPS time + (XTime - Ref XTime) * (1 + drift)
+ *
+ * towards each fix. Between fixes (and in holdover) the model extrapolates
+ * with the estimated drift. Before the first fix, time is counted from
+ * power-up.
+ *
+ * TM packets carry the model time in CCSDS unsegmented time code (CUC)
+ * form: 4 bytes of seconds since the GPS epoch plus 2 bytes of binary
+ * fraction (2^-16 s = 15.3 us).
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __TIMESYNC_H__
+#define __TIMESYNC_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "ins_gps.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define TIME_WEEK_MS            604800000LL
+#define TIME_NS_PER_MS          1000000LL
+#define TIME_CUC_SIZE           6           // Coarse(4) + Fine(2)
+
+/* Loop (per GPS fix) */
+#define TIME_SYNC_ALPHA         0.25        // Offset gain
+#define TIME_SYNC_BETA          0.05        // Drift gain
+#define TIME_SYNC_DRIFT_MAX     500.0e-6    // Oscillator tolerance clamp
+#define TIME_SYNC_STEP_NS       5000000LL   // Residual above 5 ms: step the model
+#define TIME_SYNC_LOCK_NS       200000LL    // Residual below 200 us ...
+#define TIME_SYNC_LOCK_CNT      5           // ... for 5 fixes in a row: locked
+#define TIME_SYNC_HOLD_MS       10000       // No fix for 10 s: holdover
+
+/* Receiver output -> IgnuTask delay not covered by the latency field (calibration) */
+#define TIME_SYNC_PIPE_US       0
+
+/* State */
+#define TIME_STATE_FREE         0           // No fix yet, time since power-up
+#define TIME_STATE_COARSE       1           // Stepped, converging
+#define TIME_STATE_LOCKED       2
+#define TIME_STATE_HOLDOVER     3           // Fixes missing, extrapolating
+
+/* Sample-to-TM latency sources */
+#define TIME_LAT_GPS            0           // GPS fix epoch -> Test Data TM
+#define TIME_LAT_IMU            1           // Last IMU record -> Test Data TM
+#define TIME_LAT_NUM            2
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+#pragma pack(push)
+#pragma pack()
+/* Correlation Model */
+typedef struct {
+    UInt64 ullRefStamp;         // XTime of the reference point
+    SInt64 sllRefGpsNs;         // GPS time at the reference point (ns since GPS epoch)
+    double dDrift;              // GPS seconds per XTime second - 1
+    UInt64 ullLastFix;          // XTime of the last fix used
+    UInt32 uiState;             // TIME_STATE_xxx (holdover decided on read)
+    UInt32 uiGood;              // Consecutive fixes within TIME_SYNC_LOCK_NS
+} TimeSyncModel_t;
+
+/* Loop Statistics */
+typedef struct {
+    UInt32 uiFix;               // Fixes used
+    UInt32 uiReject;            // Fixes without valid time
+    UInt32 uiStep;              // Model steps
+    SInt32 siLastResNs;         // Residual of the last fix
+    UInt32 uiMaxResNs;          // Largest |residual| while locked
+} TimeSyncStats_t;
+
+/* Latency (us) */
+typedef struct {
+    UInt32 uiCnt;
+    UInt32 uiMinUs;
+    UInt32 uiMaxUs;
+    UInt64 ullSumUs;
+} TimeLatency_t;
+#pragma pack(pop)
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+void TimeSyncGpsPost(const GpsData_t *pGps, UInt64 ullArrival);
+
+UInt32 TimeSyncToGps(UInt64 ullStamp, SInt64 *pGpsNs);
+SInt32 TimeSyncGpsToStamp(SInt64 sllGpsNs, UInt64 *pStamp);
+SInt32 TimeSyncTowToStamp(UInt32 uiTowMs, UInt64 *pStamp);
+UInt32 TimeSyncCuc(UInt64 ullStamp, UInt8 *pCuc);
+
+void TimeSyncLatency(UInt32 uiSrc, UInt64 ullSample, UInt64 ullSent);
+void TimeSyncReport(void);
+
+#endif /* __TIMESYNC_H__ */
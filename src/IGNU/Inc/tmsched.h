@@ -0,0 +1,100 @@
+/**
+ * @file tmsched.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Multi-Rate Telemetry Scheduler Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Every periodic TM product (test data, HK, IMU sample, GPS fix, filter
+ * state) has its own period and phase in scheduler ticks. TxTask runs the
+ * scheduler every TM_SCHED_TICK_MS; the products due in a tick are built
+ * and handed to SendCcsdsTmBurst together, so they leave as one COM1 ring
+ * record (one UART BRAM transfer) instead of one transfer per packet.
+ *
+ * With TM_PHASE_AUTO the phase is chosen to minimise the expected bytes
+ * that coincide with the other enabled products, which keeps the link
+ * load flat. Rates are set by telecommand (Svc 5 / Sub 31) or DBG "tmrate".
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __TMSCHED_H__
+#define __TMSCHED_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "../../common/common.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define TM_SCHED_TICK_MS    10          // Scheduler tick (TxTask period)
+#define TM_PROD_MAX         8           // Registered products
+#define TM_PROD_BUF         128         // Largest product user data (one burst packet, <= CCSDS_SEG_DATA_MAX)
+#define TM_PERIOD_MAX_MS    600000      // 10 min
+#define TM_PHASE_AUTO       0xFFFF      // Pick the least loaded phase
+#define TM_PHASE_SEARCH     1000        // Phases tried by the auto placement
+
+/* Products */
+#define TM_PROD_TEST        0           // Test Data (Svc 1 / Sub 10)
+#define TM_PROD_HK          1           // Payload Status (Svc 5 / Sub 1)
+#define TM_PROD_IMU         2           // IMU Sample (Svc 5 / Sub 2)
+#define TM_PROD_GPS         3           // GPS Fix (Svc 5 / Sub 3)
+#define TM_PROD_NAV         4           // Filter State (Svc 5 / Sub 4)
+#define TM_PROD_NUM         5
+
+/* Result */
+#define TM_SCHED_OK         0
+#define TM_SCHED_ERR_PROD   (-1)        // Product not registered
+#define TM_SCHED_ERR_RATE   (-2)        // Period not a tick multiple / phase >= period
+#define TM_SCHED_ERR_LEN    (-3)        // User data larger than TM_PROD_BUF
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+/* Builder: fill pBuf (up to uiMax bytes), return the length (0: nothing to send) */
+typedef UInt32 (*TmBuild_t)(UInt8 *pBuf, UInt32 uiMax);
+
+#pragma pack(push)
+#pragma pack()
+typedef struct {
+    TmBuild_t pfnBuild;
+    const char *pName;
+    UInt8 ucSvc;
+    UInt8 ucSub;
+    UInt8 ucRunOnly;            // Only while IGNU_STATE_RUN
+    UInt32 uiLen;               // Last (or expected) user data length
+
+    /* Schedule (ticks, written under critical section) */
+    UInt32 uiPeriod;            // 0: disabled
+    UInt32 uiPhase;
+    UInt32 uiNext;              // Tick of the next report
+
+    /* Statistics */
+    UInt32 uiSent;
+    UInt32 uiDrop;              // Ring full / frame too large
+    UInt32 uiLate;              // Reports skipped after a stall
+} TmProduct_t;
+
+typedef struct {
+    UInt32 uiTick;
+    UInt32 uiBurst;             // Ticks with at least one packet
+    UInt32 uiPkt;
+    UInt32 uiMaxPkt;            // Most packets in one burst
+    UInt32 uiMaxBytes;          // Most user data bytes in one burst
+    UInt32 uiMaxNs;             // Longest build + send
+} TmSchedStats_t;
+#pragma pack(pop)
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+SInt32 TmSchedRegister(UInt32 uiProd, UInt8 ucSvc, UInt8 ucSub, TmBuild_t pfnBuild, UInt32 uiLen,
+                       UInt32 uiRunOnly, UInt32 uiPeriodMs, UInt32 uiPhaseMs, const char *pName);
+SInt32 TmSchedSetRate(UInt32 uiProd, UInt32 uiPeriodMs, UInt32 uiPhaseMs);
+void TmSchedTick(UInt32 uiRun);
+
+void TmSchedReport(void);
+
+#endif /* __TMSCHED_H__ */
@@ -12,7 +12,14 @@
 #include "../Inc/TMTC.h"
 #include "../Inc/ignu_task.h"
 #include "../Inc/ins_gps.h"
-#include "../../OPU/opu_task.h" // For SendToCom1
+#include "../Inc/strapdown.h"
+#include "../Inc/navfilter.h"
+#include "../Inc/history.h"
+#include "../Inc/timesync.h"
+#include "../Inc/pus.h"
+#include "../Inc/tmsched.h"
+#include "../Inc/crc.h"
+#include "../../OPU/opu_task.h" // For SerialTxReserve / SerialTxCommit
 #include "xil_printf.h"
 #include <math.h>
 
@@ -41,6 +48,11 @@ typedef enum {
     KISS_STATE_ESCAPE
 } KissState_t;
 
+typedef struct {
+    UInt8 *pBuf;
+    SInt32 siLen;
+} KissCopy_t;
+
 /*==============================================================================
  * Local Variables
  *============================================================================*/
@@ -48,142 +60,251 @@ static UInt8 ucKissBuf[MAX_KISS_BUF];
 static UInt32 uiKissIdx = 0;
 static KissState_t eKissState = KISS_STATE_WAIT_FEND;
 
+/* TM sequence counters (under the COM1 producer lock, advanced on commit only) */
+static CcsdsApidCnt_t stTmApid[TM_APID_NUM] = {
+    { CCSDS_APID_TM, 0, 0 },
+    { CCSDS_APID_TM_BULK, 0, 0 }
+};
+
+/* Segmented TM transfer (started by any task, sent by TxTask) */
+typedef struct {
+    volatile UInt32 uiBusy;     // Transfer owned until sent or aborted
+    volatile UInt32 uiReady;    // Set up, TxTask may send
+    UInt8 ucSvc;
+    UInt8 ucSub;
+    UInt8 ucAck;                // TC response: close the command-to-ack probe
+    UInt32 uiLen;
+    UInt32 uiOff;               // Bytes queued
+    TickType_t xStart;
+    TickType_t xLastProgress;
+} CcsdsTmSeg_t;
+
+static CcsdsTmSeg_t stTmSeg;
+static UInt8 ucTmSegBuf[CCSDS_TM_SEG_MAX] __attribute__((aligned(8)));
+
+/* TC reassembly (IgnuTask) */
+typedef struct {
+    UInt32 uiActive;
+    UInt16 usApid;
+    UInt16 usNextSeq;
+    UInt8 ucSvc;
+    UInt8 ucSub;
+    UInt32 uiLen;
+    TickType_t xLastTick;
+} CcsdsReasm_t;
+static CcsdsReasm_t stTcReasm;
+static UInt8 ucTcReasmBuf[CCSDS_TC_REASM_MAX] __attribute__((aligned(8)));
+static CcsdsSegStats_t stSegStats;
+
 /*==============================================================================
  * Local Function Declarations
  *============================================================================*/
 static UInt32 Crc32Check(UInt8 *pData, UInt32 uiLen);
-static UInt16 Crc16Check(UInt8 *pData, UInt32 uiLen);
+static const UInt8 *KissScan(const UInt8 *p, const UInt8 *pEnd);
+static void KissCopyFrame(UInt8 *pFrame, UInt32 uiLen, void *pArg);
 static void CcsdsReceive(UInt8 *pCcsdsPacket, UInt32 uiLen);
-static UInt32 KissEncode(UInt8 *pInput, UInt32 uiInputLen, UInt8 *pOutput);
+static SInt32 KissEscape(const UInt8 *pInput, UInt32 uiInputLen, UInt8 *pOutput, UInt32 uiIdx, UInt32 uiMaxLen);
+static SInt32 CspEncode(UInt8 *pSlot, UInt32 uiIdx, UInt32 uiMaxLen, UInt8 dest, UInt8 dport, const TxIov_t *pIov, UInt32 uiIovCnt);
+static UInt32 CcsdsTmHeader(const TmPacket_t *pPkt, UInt16 usSeq, UInt8 *pHeader, UInt8 *pCrc);
+static UInt32 CcsdsTmEncodeRecord(TmPacket_t *pPkt, UInt32 uiCnt, UInt16 *pSeq, UInt8 *pRec, UInt32 uiMaxLen, UInt32 *pUsed);
+static SInt32 CcsdsTmSegStart(UInt8 ucSvc, UInt8 ucSub, const UInt8 *pData, UInt32 uiLen, UInt8 ucAck);
+static UInt8 CcsdsTmPort(UInt8 ucSvc, UInt8 ucSub);
+static SInt32 CcsdsReassemble(UInt16 usApid, UInt8 ucSeqFlags, UInt16 usSeq, UInt8 *pSvc, UInt8 *pSub,
+                              UInt8 **ppData, UInt32 *pLen);
 static void SendCcsdsTm(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiDataLen);
 
+/* Periodic TM builders (TmSchedTick) */
+static void BuildTestData(TestData_t *pTestData, UInt8 ucPeriodic);
+static void BuildHkStatus(PayloadStatus_t *pStatus);
+static UInt32 TmBuildTestData(UInt8 *pBuf, UInt32 uiMax);
+static UInt32 TmBuildHk(UInt8 *pBuf, UInt32 uiMax);
+static UInt32 TmBuildImu(UInt8 *pBuf, UInt32 uiMax);
+static UInt32 TmBuildGps(UInt8 *pBuf, UInt32 uiMax);
+static UInt32 TmBuildNav(UInt8 *pBuf, UInt32 uiMax);
+
 /* Handler Functions */
-static void ProcTestStart(void);
-static void ProcTestStop(void);
-static void ProcSetTestParam(void);
-static void ProcSaveTpvaw(UInt8 *pData, UInt32 uiLen);
-static void ProcReqTestData(UInt8 ucType);
-static void ProcHkReq(void);
-static void ProcFuncExec(void);
-static void ProcPing(UInt8 *pUserData, UInt32 uiUserDataLen);
+static void ProcTestStart(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen);
+static void ProcTestStop(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen);
+static void ProcSetTestParam(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen);
+static void ProcSaveTpvaw(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen);
+static void ProcReqTestData(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen);
+static void ProcHkReq(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen);
+static void ProcSetTmRate(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen);
+static void ProcFuncExec(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen);
+static void ProcPing(UInt8 ucSvc, UInt8 ucSub, UInt8 *pUserData, UInt32 uiUserDataLen);
 
 /*==============================================================================
  * Functions
  *============================================================================*/
 
-SInt32 KissDecode(UInt8 ucByte, UInt8 *pDecodedBuf)
+/**
+ * @brief Find next FEND/FESC (4 Bytes per step, SWAR zero-byte test)
+ * @return Pointer to the delimiter, or pEnd if none
+ */
+static const UInt8 *KissScan(const UInt8 *p, const UInt8 *pEnd)
 {
-    SInt32 siRetLen = 0;
+    UInt32 uiWord, uiFend, uiFesc;
+
+    while ((pEnd - p) >= 4) {
+        uiWord = (UInt32)p[0] | ((UInt32)p[1] << 8) | ((UInt32)p[2] << 16) | ((UInt32)p[3] << 24);
+        uiFend = uiWord ^ 0xC0C0C0C0;
+        uiFesc = uiWord ^ 0xDBDBDBDB;
+        if ((((uiFend - 0x01010101) & ~uiFend) | ((uiFesc - 0x01010101) & ~uiFesc)) & 0x80808080) break;
+        p += 4;
+    }
+    while ((p < pEnd) && (*p != KISS_FEND) && (*p != KISS_FESC)) p++;
+
+    return p;
+}
 
-    switch (eKissState)
+/**
+ * @brief Block KISS Decoder
+ * Copies unescaped runs in bulk and calls pfnFrame for every completed frame.
+ * Decoder state is kept across calls, so a frame may span several blocks.
+ * @return Number of frames emitted
+ */
+SInt32 KissDecodeBlock(const UInt8 *pData, UInt32 uiLen, KissFrameHandler_t pfnFrame, void *pArg)
+{
+    const UInt8 *p = pData;
+    const UInt8 *pEnd = pData + uiLen;
+    const UInt8 *pRun;
+    UInt32 uiRun;
+    UInt8 ucByte;
+    SInt32 siFrames = 0;
+
+    if (pData == NULL || pfnFrame == NULL) return 0;
+
+    while (p < pEnd)
     {
-    case KISS_STATE_WAIT_FEND:
-        if (ucByte == KISS_FEND) {
+        switch (eKissState)
+        {
+        case KISS_STATE_WAIT_FEND:
+            pRun = memchr(p, KISS_FEND, pEnd - p);
+            if (pRun == NULL) return siFrames;
+            p = pRun + 1;
             uiKissIdx = 0;
             eKissState = KISS_STATE_DATA;
-        }
-        break;
+            break;
+
+        case KISS_STATE_DATA:
+            /* Bulk copy up to the next delimiter */
+            pRun = p;
+            p = KissScan(p, pEnd);
+            uiRun = p - pRun;
+            if (uiRun > 0) {
+                if ((uiKissIdx + uiRun) > MAX_KISS_BUF) {
+                    uiKissIdx = 0;
+                    eKissState = KISS_STATE_WAIT_FEND;
+                    break;
+                }
+                memcpy(&ucKissBuf[uiKissIdx], pRun, uiRun);
+                uiKissIdx += uiRun;
+            }
+            if (p >= pEnd) break;
 
-    case KISS_STATE_DATA:
-        if (ucByte == KISS_FEND) {
-            if (uiKissIdx > 0) {
+            if (*p == KISS_FEND) {
                 /* Allow any CMD_CODE for debugging */
-                if (1) {
-                    if (uiKissIdx > 1) {
-                        siRetLen = uiKissIdx - 1;
-                        memcpy(pDecodedBuf, &ucKissBuf[1], siRetLen);
-                    }
+                if (uiKissIdx > 1) {
+                    pfnFrame(&ucKissBuf[1], uiKissIdx - 1, pArg);
+                    siFrames++;
                 }
+                uiKissIdx = 0;
             }
-            uiKissIdx = 0;
-        }
-        else if (ucByte == KISS_FESC) {
-            eKissState = KISS_STATE_ESCAPE;
-        }
-        else {
+            else {
+                eKissState = KISS_STATE_ESCAPE;
+            }
+            p++;
+            break;
+
+        case KISS_STATE_ESCAPE:
+            ucByte = *p++;
+            if (ucByte == KISS_TFEND) ucByte = KISS_FEND;
+            else if (ucByte == KISS_TFESC) ucByte = KISS_FESC;
             if (uiKissIdx < MAX_KISS_BUF) ucKissBuf[uiKissIdx++] = ucByte;
-            else { uiKissIdx = 0; eKissState = KISS_STATE_WAIT_FEND; }
-        }
-        break;
+            eKissState = KISS_STATE_DATA;
+            break;
 
-    case KISS_STATE_ESCAPE:
-        if (ucByte == KISS_TFEND) {
-            if (uiKissIdx < MAX_KISS_BUF) ucKissBuf[uiKissIdx++] = KISS_FEND;
-        }
-        else if (ucByte == KISS_TFESC) {
-            if (uiKissIdx < MAX_KISS_BUF) ucKissBuf[uiKissIdx++] = KISS_FESC;
+        default:
+            eKissState = KISS_STATE_WAIT_FEND;
+            break;
         }
-        else {
-             if (uiKissIdx < MAX_KISS_BUF) ucKissBuf[uiKissIdx++] = ucByte;
-        }
-        eKissState = KISS_STATE_DATA;
-        break;
-
-    default:
-        eKissState = KISS_STATE_WAIT_FEND;
-        break;
     }
 
-    return siRetLen;
+    return siFrames;
 }
 
-/* CCSDS CRC-16 (CCITT-FALSE) */
-static UInt16 Crc16Check(UInt8 *pData, UInt32 uiLen)
+/* KissDecode: copy the completed frame out for the byte-wise API */
+static void KissCopyFrame(UInt8 *pFrame, UInt32 uiLen, void *pArg)
 {
-    UInt16 crc = 0xFFFF;
-    UInt32 i, j;
-    
-    for (i = 0; i < uiLen; i++) {
-        crc ^= (UInt16)(pData[i] << 8);
-        for (j = 0; j < 8; j++) {
-            if (crc & 0x8000) crc = (crc << 1) ^ 0x1021;
-            else crc <<= 1;
-        }
-    }
-    return crc;
+    KissCopy_t *pCopy = (KissCopy_t *)pArg;
+
+    memcpy(pCopy->pBuf, pFrame, uiLen);
+    pCopy->siLen = (SInt32)uiLen;
+}
+
+SInt32 KissDecode(UInt8 ucByte, UInt8 *pDecodedBuf)
+{
+    KissCopy_t stCopy;
+
+    stCopy.pBuf = pDecodedBuf;
+    stCopy.siLen = 0;
+    KissDecodeBlock(&ucByte, 1, KissCopyFrame, &stCopy);
+
+    return stCopy.siLen;
 }
 
 /* CSP CRC-32C (Castagnoli Reflected) */
 static UInt32 Crc32Check(UInt8 *pData, UInt32 uiLen)
 {
-    UInt32 crc = 0xFFFFFFFF;
-    UInt32 i, j;
-    
-    for (i = 0; i < uiLen; i++) {
-        crc ^= pData[i];
-        for (j = 0; j < 8; j++) {
-            if (crc & 1) crc = (crc >> 1) ^ 0x82F63B78;
-            else crc = (crc >> 1);
-        }
-    }
-    return ~crc;
+    return Crc32cFinal(Crc32cUpdate(Crc32cInit(), pData, uiLen));
 }
 
-static UInt32 KissEncode(UInt8 *pInput, UInt32 uiInputLen, UInt8 *pOutput)
+/**
+ * @brief KISS-escape one segment directly into the TX slot
+ * Unescaped runs are copied in bulk (KissScan).
+ * @return Output index after the segment, or -1 if the slot is too small
+ */
+static SInt32 KissEscape(const UInt8 *pInput, UInt32 uiInputLen, UInt8 *pOutput, UInt32 uiIdx, UInt32 uiMaxLen)
 {
-    UInt32 i;
-    UInt32 uiIdx = 0;
-    pOutput[uiIdx++] = KISS_FEND;
-    pOutput[uiIdx++] = KISS_CMD_DATA;
-    for(i=0; i<uiInputLen; i++) {
-        if(pInput[i] == KISS_FEND) {
-            pOutput[uiIdx++] = KISS_FESC; pOutput[uiIdx++] = KISS_TFEND;
-        } else if(pInput[i] == KISS_FESC) {
-            pOutput[uiIdx++] = KISS_FESC; pOutput[uiIdx++] = KISS_TFESC;
-        } else {
-            pOutput[uiIdx++] = pInput[i];
+    const UInt8 *p = pInput;
+    const UInt8 *pEnd = pInput + uiInputLen;
+    const UInt8 *pRun;
+    UInt32 uiRun;
+
+    while (p < pEnd) {
+        pRun = p;
+        p = KissScan(p, pEnd);
+        uiRun = p - pRun;
+        if ((uiIdx + uiRun) > uiMaxLen) return -1;
+        memcpy(&pOutput[uiIdx], pRun, uiRun);
+        uiIdx += uiRun;
+
+        if (p < pEnd) {
+            if ((uiIdx + 2) > uiMaxLen) return -1;
+            pOutput[uiIdx++] = KISS_FESC;
+            pOutput[uiIdx++] = (*p == KISS_FEND) ? KISS_TFEND : KISS_TFESC;
+            p++;
         }
     }
-    pOutput[uiIdx++] = KISS_FEND;
-    return uiIdx;
+    return (SInt32)uiIdx;
 }
 
-SInt32 CspSend(UInt8 dest, UInt8 dport, UInt8 *pData, UInt32 uiLen)
+/**
+ * @brief KISS-encode one CSP frame into a TX ring slot at uiIdx
+ * Header, iovec chain and CRC-32C trailer are written straight into the
+ * slot; each segment is CRC'd and escaped while it is cache-hot.
+ * @return Slot index after the frame, or -1 if it does not fit in uiMaxLen
+ */
+static SInt32 CspEncode(UInt8 *pSlot, UInt32 uiIdx, UInt32 uiMaxLen, UInt8 dest, UInt8 dport, const TxIov_t *pIov, UInt32 uiIovCnt)
 {
-    UInt8 ucRawPkt[MAX_KISS_BUF];
-    UInt8 ucKissFrame[MAX_KISS_BUF * 2];
-    UInt32 uiPktLen = 0;
-    UInt32 uiKissLen = 0;
+    UInt8 ucHeader[CSP_HEADER_SIZE];
+    UInt8 ucTrailer[CSP_CRC32_SIZE];
+    UInt32 uiCrc;
+    UInt32 i;
+    SInt32 siIdx;
+
+    if ((uiIdx + 3) > uiMaxLen) return -1;
+    uiMaxLen -= 1; // Room for closing FEND
 
     /* 1. CSP Header (4 Bytes, Big Endian) */
     UInt32 uiHeader = 0;
@@ -194,91 +315,399 @@ SInt32 CspSend(UInt8 dest, UInt8 dport, UInt8 *pData, UInt32 uiLen)
     uiHeader |= (CSP_PORT_CMD_RX & 0x3F) << 8; // Source Port
     uiHeader |= 0x00; // Flags
 
-    ucRawPkt[0] = (uiHeader >> 24) & 0xFF;
-    ucRawPkt[1] = (uiHeader >> 16) & 0xFF;
-    ucRawPkt[2] = (uiHeader >> 8) & 0xFF;
-    ucRawPkt[3] = uiHeader & 0xFF;
-    uiPktLen += 4;
-
-    /* 2. Payload */
-    memcpy(&ucRawPkt[uiPktLen], pData, uiLen);
-    uiPktLen += uiLen;
+    ucHeader[0] = (uiHeader >> 24) & 0xFF;
+    ucHeader[1] = (uiHeader >> 16) & 0xFF;
+    ucHeader[2] = (uiHeader >> 8) & 0xFF;
+    ucHeader[3] = uiHeader & 0xFF;
+
+    pSlot[uiIdx++] = KISS_FEND;
+    pSlot[uiIdx++] = KISS_CMD_DATA;
+    siIdx = KissEscape(ucHeader, CSP_HEADER_SIZE, pSlot, uiIdx, uiMaxLen);
+
+    /* 2. Payload (CRC: Payload Only, same as receive) */
+    uiCrc = Crc32cInit();
+    for (i = 0; (i < uiIovCnt) && (siIdx >= 0); i++) {
+        if (pIov[i].pData == NULL || pIov[i].uiLen == 0) continue;
+        uiCrc = Crc32cUpdate(uiCrc, pIov[i].pData, pIov[i].uiLen);
+        siIdx = KissEscape(pIov[i].pData, pIov[i].uiLen, pSlot, (UInt32)siIdx, uiMaxLen);
+    }
 
     /* 3. CRC32 */
-    /* Checksum: Calculate over Payload Only (same as receive) */
-    UInt32 uiCrc = Crc32Check(&ucRawPkt[CSP_HEADER_SIZE], uiLen); // Payload Only
-    // UInt32 uiCrc = Crc32Check(ucRawPkt, uiPktLen); // Header + Payload (Standard CSP)
+    if (siIdx >= 0) {
+        uiCrc = Crc32cFinal(uiCrc);
+        ucTrailer[0] = (uiCrc >> 24) & 0xFF;
+        ucTrailer[1] = (uiCrc >> 16) & 0xFF;
+        ucTrailer[2] = (uiCrc >> 8) & 0xFF;
+        ucTrailer[3] = uiCrc & 0xFF;
+        siIdx = KissEscape(ucTrailer, CSP_CRC32_SIZE, pSlot, (UInt32)siIdx, uiMaxLen);
+    }
+
+    /* 4. Close */
+    if (siIdx >= 0) {
+        pSlot[siIdx++] = KISS_FEND;
+    }
+    return siIdx;
+}
+
+/**
+ * @brief Scatter-gather CSP Send (one frame per COM1 TX ring record)
+ * @return 0 on success, -1 if the ring is full or the frame does not fit
+ */
+SInt32 CspSendv(UInt8 dest, UInt8 dport, const TxIov_t *pIov, UInt32 uiIovCnt)
+{
+    UInt8 *pSlot;
+    UInt32 uiMaxLen = 0;
+    SInt32 siIdx;
+    SInt32 siRet = -1;
+
+    /* The slot belongs to this frame until commit: keep other producers out */
+    if (SerialTxLock(0) < 0) {
+        xil_printf("[CSP] Error: TX Frame Dropped\r\n");
+        return -1;
+    }
 
-    ucRawPkt[uiPktLen++] = (uiCrc >> 24) & 0xFF;
-    ucRawPkt[uiPktLen++] = (uiCrc >> 16) & 0xFF;
-    ucRawPkt[uiPktLen++] = (uiCrc >> 8) & 0xFF;
-    ucRawPkt[uiPktLen++] = uiCrc & 0xFF;
+    pSlot = SerialTxReserve(0, &uiMaxLen);
+    if (pSlot != NULL) {
+        siIdx = CspEncode(pSlot, 0, uiMaxLen, dest, dport, pIov, uiIovCnt);
 
-    /* 4. Encode & Send */
-    uiKissLen = KissEncode(ucRawPkt, uiPktLen, ucKissFrame);
+        /* Queue for tx_thread */
+        if (siIdx >= 0) {
+            siRet = SerialTxCommit(0, (UInt32)siIdx);
+        }
+    }
 
-    SendToCom1(ucKissFrame, uiKissLen);
+    SerialTxUnlock(0);
 
-    return 0;
+    if (siRet < 0) {
+        xil_printf("[CSP] Error: TX Frame Dropped\r\n");
+    }
+    return siRet;
+}
+
+SInt32 CspSend(UInt8 dest, UInt8 dport, UInt8 *pData, UInt32 uiLen)
+{
+    TxIov_t stIov;
+
+    stIov.pData = pData;
+    stIov.uiLen = uiLen;
+
+    return CspSendv(dest, dport, &stIov, 1);
 }
 
 /**
- * @brief Universal Helper to send correct CCSDS Telemetry Packet (R06.6)
+ * @brief Build the CCSDS TM headers and CRC of a packet (R06.6)
  * Handles:
+ * - APID and sequence flags / count of the packet
  * - 12 Bytes Secondary Header (Svc, Sub, Src, Time, Flags, Pad)
- * - Correct APID (0x550)
  * - CRC-16 (2 Bytes) at the end
+ * @return Header length (CCSDS_PRI_HEADER_SIZE + CCSDS_TM_SEC_HEADER_SIZE)
  */
-static void SendCcsdsTm(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiDataLen)
+static UInt32 CcsdsTmHeader(const TmPacket_t *pPkt, UInt16 usSeq, UInt8 *pHeader, UInt8 *pCrc)
 {
-    UInt8 ucBuffer[MAX_TM_DATA + 32];
     UInt32 uiLen = 0;
 
     /* 1. Primary Header (6 Bytes) */
     /* Packet ID: Version(0) | Type(0=TM) | SecHdr(1) | APID(11) */
-    UInt16 usPacketId = 0x0800 | (0x023B & 0x07FF); // APID fixed to 0x023B for PDHS
-    ucBuffer[uiLen++] = (usPacketId >> 8) & 0xFF;
-    ucBuffer[uiLen++] = usPacketId & 0xFF;
-
-    /* Sequence Control (Unsegmented) */
-    ucBuffer[uiLen++] = 0xC0;
-    ucBuffer[uiLen++] = 0x00;
+    UInt16 usPacketId = 0x0800 | (stTmApid[pPkt->ucApid].usApid & 0x07FF);
+    pHeader[uiLen++] = (usPacketId >> 8) & 0xFF;
+    pHeader[uiLen++] = usPacketId & 0xFF;
+
+    /* Sequence Control: Flags(2) | Count(14) */
+    UInt16 usSeqCtrl = ((UInt16)(pPkt->ucSeqFlags & 0x03) << 14) | (usSeq & CCSDS_SEQ_CNT_MASK);
+    pHeader[uiLen++] = (usSeqCtrl >> 8) & 0xFF;
+    pHeader[uiLen++] = usSeqCtrl & 0xFF;
     
     /* Length Field = SecHdr(12) + UserData(N) + CRC(2) - 1 */
-    UInt16 usPktLen = (UInt16)(CCSDS_TM_SEC_HEADER_SIZE + uiDataLen + 2 - 1);
-    ucBuffer[uiLen++] = (usPktLen >> 8) & 0xFF;
-    ucBuffer[uiLen++] = usPktLen & 0xFF;
+    UInt16 usPktLen = (UInt16)(CCSDS_TM_SEC_HEADER_SIZE + pPkt->uiLen + 2 - 1);
+    pHeader[uiLen++] = (usPktLen >> 8) & 0xFF;
+    pHeader[uiLen++] = usPktLen & 0xFF;
 
     /* 2. Secondary Header (12 Bytes - R06.6) */
-    ucBuffer[uiLen++] = ucSvc;
-    ucBuffer[uiLen++] = ucSub;
+    pHeader[uiLen++] = pPkt->ucSvc;
+    pHeader[uiLen++] = pPkt->ucSub;
     /* Source ID (2B) */
-    ucBuffer[uiLen++] = (CCSDS_APID_IGNU >> 8) & 0xFF;
-    ucBuffer[uiLen++] = CCSDS_APID_IGNU & 0xFF;
+    pHeader[uiLen++] = (CCSDS_APID_IGNU >> 8) & 0xFF;
+    pHeader[uiLen++] = CCSDS_APID_IGNU & 0xFF;
     
-    /* Time Stamp (6 Bytes) - Zero Padding */
-    memset(&ucBuffer[uiLen], 0, 6);
-    uiLen += 6;
+    /* Time Stamp (6 Bytes) - CUC: GPS seconds (4B) + 2^-16 s fraction (2B) */
+    TimeSyncCuc(HistNow(), &pHeader[uiLen]);
+    uiLen += TIME_CUC_SIZE;
     
     /* Flags(1B) + Padding(1B) = 2 Bytes */
-    ucBuffer[uiLen++] = 0x00; // Flags (E_CRC=0) + Pad
-    ucBuffer[uiLen++] = 0x00; // Padding (Spare)
+    pHeader[uiLen++] = 0x00; // Flags (E_CRC=0) + Pad
+    pHeader[uiLen++] = 0x00; // Padding (Spare)
+
+    /* 3. CRC-16 (Packet Error Control) over Header + User Data */
+    UInt16 usCrc = Crc16Update(Crc16Init(), pHeader, uiLen);
+    usCrc = Crc16Final(Crc16Update(usCrc, pPkt->pData, pPkt->uiLen));
+    pCrc[0] = (usCrc >> 8) & 0xFF;
+    pCrc[1] = usCrc & 0xFF;
+
+    return uiLen;
+}
+
+/**
+ * @brief CSP destination port of a TM packet
+ * Unsolicited TM (test data, periodic HK products) uses port 11 (async), others port 10 (sync)
+ */
+static UInt8 CcsdsTmPort(UInt8 ucSvc, UInt8 ucSub)
+{
+    if ((ucSvc == PUS_SVC_TEST) && (ucSub == PUS_SUB_TEST_REQ_DATA)) return CSP_PORT_ASYNC_TX;
+    if ((ucSvc == PUS_SVC_HK) && (ucSub >= PUS_SUB_HK_IMU) && (ucSub <= PUS_SUB_HK_NAV)) return CSP_PORT_ASYNC_TX;
+    return CSP_PORT_CMD_RX;
+}
+
+/**
+ * @brief Universal Helper to send correct CCSDS Telemetry Packet (R06.6)
+ * User data above CCSDS_SEG_DATA_MAX goes out segmented (handed to TxTask, see CcsdsTmSegPump).
+ */
+static void SendCcsdsTm(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiDataLen)
+{
+    TmPacket_t stPkt;
+
+    if (pData == NULL) uiDataLen = 0;
+
+    if (uiDataLen > CCSDS_SEG_DATA_MAX) {
+        /* Sent by TxTask; the probe closes when the first segments are queued */
+        if (CcsdsTmSegStart(ucSvc, ucSub, pData, uiDataLen, TRUE) < 0) {
+            xil_printf("[CCSDS] Error: Segmented TM Dropped (Len:%d)\r\n", uiDataLen);
+        }
+        return;
+    }
+
+    stPkt.ucSvc = ucSvc;
+    stPkt.ucSub = ucSub;
+    stPkt.ucApid = TM_APID_STD;
+    stPkt.ucSeqFlags = CCSDS_SEQ_UNSEG;
+    stPkt.pData = pData;
+    stPkt.uiLen = uiDataLen;
+
+    /* Send via CSP */
+    if (SendCcsdsTmBurst(&stPkt, 1) == 0) {
+        xil_printf("[CSP] Error: TX Frame Dropped\r\n");
+    } else {
+        /* Response in the COM1 TX ring: close the command-to-ack probe */
+        IgnuCmdAckStamp();
+    }
+}
+
+/**
+ * @brief Encode consecutive TM packets into one COM1 TX record (the reserved ring slot)
+ * @param pSeq Next sequence count per APID, advanced for every packet encoded
+ * @param pRec Record (uiMaxLen bytes)
+ * @param pUsed Record bytes used
+ * @return Packets consumed from pPkt (the encoded ones have ucSent = 1, oversize ones count in uiTmOversize)
+ */
+static UInt32 CcsdsTmEncodeRecord(TmPacket_t *pPkt, UInt32 uiCnt, UInt16 *pSeq, UInt8 *pRec, UInt32 uiMaxLen, UInt32 *pUsed)
+{
+    UInt8 ucHeader[CCSDS_PRI_HEADER_SIZE + CCSDS_TM_SEC_HEADER_SIZE];
+    UInt8 ucCrc[2];
+    TxIov_t stIov[3];
+    UInt32 uiUsed = 0;
+    UInt32 i;
+    SInt32 siIdx;
+
+    stIov[0].pData = ucHeader;
+    stIov[2].pData = ucCrc;
+    stIov[2].uiLen = 2;
+
+    for (i = 0; i < uiCnt; i++) {
+        pPkt[i].ucSent = 0;
+        if (pPkt[i].uiLen > CCSDS_SEG_DATA_MAX) {
+            stSegStats.uiTmOversize++;  // Not sent: large TM goes through SendCcsdsTmSeg
+            continue;
+        }
+        stIov[0].uiLen = CcsdsTmHeader(&pPkt[i], pSeq[pPkt[i].ucApid], ucHeader, ucCrc);
+        stIov[1].pData = pPkt[i].pData;
+        stIov[1].uiLen = pPkt[i].uiLen;
+
+        siIdx = CspEncode(pRec, uiUsed, uiMaxLen, CSP_PDHS_ADDR, CcsdsTmPort(pPkt[i].ucSvc, pPkt[i].ucSub), stIov, 3);
+        if (siIdx < 0) {
+            if (uiUsed > 0) break;  // Record full: the rest goes into the next one
+            stSegStats.uiTmOversize++;  // Does not fit an empty record: not sent
+            continue;
+        }
+
+        uiUsed = (UInt32)siIdx;
+        pSeq[pPkt[i].ucApid] = (pSeq[pPkt[i].ucApid] + 1) & CCSDS_SEQ_CNT_MASK;
+        pPkt[i].ucSent = 1;
+    }
+
+    *pUsed = uiUsed;
+    return i;
+}
+
+/**
+ * @brief Send several TM packets as one TX burst
+ * The KISS frames are encoded straight into COM1 ring slots, packed back
+ * to back into as few records as possible (normally one), so tx_thread
+ * moves them in one UART BRAM write. The COM1 producer lock (a mutex, the
+ * scheduler keeps running) is held from reserve to commit, and every TM
+ * sequence count is taken under it, so counts follow link order and
+ * advance only with a successful commit: a packet that is not queued
+ * leaves no gap in the sequence.
+ * @return Packets queued (pPkt[i].ucSent marks which)
+ */
+UInt32 SendCcsdsTmBurst(TmPacket_t *pPkt, UInt32 uiCnt)
+{
+    UInt16 usSeq[TM_APID_NUM];
+    UInt8 *pSlot;
+    UInt32 uiMaxLen = 0;
+    UInt32 uiDone = 0, uiNum, uiUsed, uiSent = 0;
+    UInt32 i, a;
+    SInt32 siRet;
+
+    for (i = 0; i < uiCnt; i++) {
+        pPkt[i].ucSent = 0;
+        if (pPkt[i].pData == NULL) pPkt[i].uiLen = 0;
+        if (pPkt[i].ucApid >= TM_APID_NUM) pPkt[i].ucApid = TM_APID_STD;
+    }
+    if (uiCnt > TM_BURST_MAX) uiCnt = TM_BURST_MAX;
+
+    if (SerialTxLock(0) < 0) return 0;
+
+    while (uiDone < uiCnt) {
+        pSlot = SerialTxReserve(0, &uiMaxLen);
+        if (pSlot == NULL) break;   // Ring full: the rest of the burst is not queued
+
+        for (a = 0; a < TM_APID_NUM; a++) usSeq[a] = stTmApid[a].usSeq;
+        uiNum = CcsdsTmEncodeRecord(&pPkt[uiDone], uiCnt - uiDone, usSeq, pSlot, uiMaxLen, &uiUsed);
 
-    /* 3. User Data */
-    if (pData != NULL && uiDataLen > 0) {
-        memcpy(&ucBuffer[uiLen], pData, uiDataLen);
-        uiLen += uiDataLen;
+        siRet = (uiUsed > 0) ? SerialTxCommit(0, uiUsed) : 0;
+        if (siRet < 0) {
+            for (i = uiDone; i < uiCnt; i++) pPkt[i].ucSent = 0;
+            break;
+        }
+        for (a = 0; a < TM_APID_NUM; a++) {
+            stTmApid[a].uiPkt += (UInt32)((usSeq[a] - stTmApid[a].usSeq) & CCSDS_SEQ_CNT_MASK);
+            stTmApid[a].usSeq = usSeq[a];
+        }
+
+        for (i = uiDone; i < (uiDone + uiNum); i++) {
+            if (pPkt[i].ucSent != 0) uiSent++;
+        }
+        uiDone += uiNum;
     }
 
-    /* 4. CRC-16 (Packet Error Control) */
-    UInt16 usCrc = Crc16Check(ucBuffer, uiLen);
-    ucBuffer[uiLen++] = (usCrc >> 8) & 0xFF;
-    ucBuffer[uiLen++] = usCrc & 0xFF;
+    SerialTxUnlock(0);
 
-    /* 5. Send via CSP */
-    /* Test data (Svc 1, Sub 10) uses port 11 (async), others use port 10 (sync) */
-    UInt8 dport = ((ucSvc == PUS_SVC_TEST) && (ucSub == PUS_SUB_TEST_REQ_DATA)) ? CSP_PORT_ASYNC_TX : CSP_PORT_CMD_RX;
-    CspSend(CSP_PDHS_ADDR, dport, ucBuffer, uiLen);
+    return uiSent;
+}
+
+/**
+ * @brief Start a segmented TM transfer on the bulk APID (never blocks)
+ * The user data is copied; TxTask sends the segments (CcsdsTmSegPump).
+ * One transfer at a time.
+ * @return SInt32 0 if accepted, -1 if a transfer is running or uiLen is 0 / above CCSDS_TM_SEG_MAX
+ */
+SInt32 SendCcsdsTmSeg(UInt8 ucSvc, UInt8 ucSub, const UInt8 *pData, UInt32 uiLen)
+{
+    return CcsdsTmSegStart(ucSvc, ucSub, pData, uiLen, FALSE);
+}
+
+/**
+ * @brief SendCcsdsTmSeg; ucAck: TC response, the first queued segments close the command-to-ack probe
+ */
+static SInt32 CcsdsTmSegStart(UInt8 ucSvc, UInt8 ucSub, const UInt8 *pData, UInt32 uiLen, UInt8 ucAck)
+{
+    if ((pData == NULL) || (uiLen == 0) || (uiLen > CCSDS_TM_SEG_MAX)) return -1;
+
+    taskENTER_CRITICAL();
+    if (stTmSeg.uiBusy != 0) {
+        taskEXIT_CRITICAL();
+        return -1;
+    }
+    stTmSeg.uiBusy = 1;
+    taskEXIT_CRITICAL();
+
+    memcpy(ucTmSegBuf, pData, uiLen);
+    stTmSeg.ucSvc = ucSvc;
+    stTmSeg.ucSub = ucSub;
+    stTmSeg.uiLen = uiLen;
+    stTmSeg.uiOff = 0;
+    stTmSeg.ucAck = ucAck;
+    stTmSeg.xStart = xTaskGetTickCount();
+    stTmSeg.xLastProgress = stTmSeg.xStart;
+    __sync_synchronize();   // Transfer set up before TxTask sees it
+    stTmSeg.uiReady = 1;
+
+    return 0;
+}
+
+/**
+ * @brief Transfer still running (started, not yet sent or aborted)
+ */
+UInt32 CcsdsTmSegBusy(void)
+{
+    return stTmSeg.uiBusy;
+}
+
+/**
+ * @brief Queue the segments of the running transfer (TxTask, every tick)
+ * Segments (CCSDS_SEG_DATA_MAX bytes, each with the full secondary header)
+ * go out TM_BURST_MAX at a time until the COM1 ring is full; the rest
+ * follows on the next ticks, so the transfer runs at link speed. After
+ * CCSDS_SEG_TIMEOUT_MS without progress it is aborted. The bulk APID has
+ * its own sequence count, so other TM may interleave without breaking the
+ * segment sequence.
+ */
+void CcsdsTmSegPump(void)
+{
+    TmPacket_t stPkt[TM_BURST_MAX];
+    UInt32 uiGroupOff, uiSegOff, uiSegLen;
+    UInt32 uiCnt, uiDone, uiMs;
+    UInt32 uiLen;
+
+    if (stTmSeg.uiReady == 0) return;
+    __sync_synchronize();   // Transfer fields only after uiReady (see CcsdsTmSegStart)
+    uiLen = stTmSeg.uiLen;
+
+    while (stTmSeg.uiOff < uiLen) {
+        /* Next group of segments */
+        uiGroupOff = stTmSeg.uiOff;
+        uiSegOff = uiGroupOff;
+        for (uiCnt = 0; uiCnt < TM_BURST_MAX; uiCnt++) {
+            uiSegLen = uiLen - uiSegOff;
+            if (uiSegLen > CCSDS_SEG_DATA_MAX) uiSegLen = CCSDS_SEG_DATA_MAX;
+
+            stPkt[uiCnt].ucSvc = stTmSeg.ucSvc;
+            stPkt[uiCnt].ucSub = stTmSeg.ucSub;
+            stPkt[uiCnt].ucApid = TM_APID_BULK;
+            stPkt[uiCnt].ucSeqFlags = ((uiSegOff == 0) ? CCSDS_SEQ_FIRST : 0) |
+                                      (((uiSegOff + uiSegLen) == uiLen) ? CCSDS_SEQ_LAST : 0);
+            stPkt[uiCnt].pData = &ucTmSegBuf[uiSegOff];
+            stPkt[uiCnt].uiLen = uiSegLen;
+            uiSegOff += uiSegLen;
+            if (uiSegOff >= uiLen) { uiCnt++; break; }
+        }
+
+        SendCcsdsTmBurst(stPkt, uiCnt);
+
+        /* Segments must leave in order: advance over the leading queued ones */
+        for (uiDone = 0; (uiDone < uiCnt) && (stPkt[uiDone].ucSent != 0); uiDone++) {
+            stTmSeg.uiOff += stPkt[uiDone].uiLen;
+        }
+        if (uiDone == 0) break;     // Ring full: next tick
+
+        /* First segments of a TC response in the COM1 TX ring: close the command-to-ack probe */
+        if ((uiGroupOff == 0) && (stTmSeg.ucAck != 0)) IgnuCmdAckStamp();
+        stSegStats.uiTmSeg += uiDone;
+        stTmSeg.xLastProgress = xTaskGetTickCount();
+    }
+
+    if (stTmSeg.uiOff < uiLen) {
+        uiMs = (UInt32)((xTaskGetTickCount() - stTmSeg.xLastProgress) * portTICK_PERIOD_MS);
+        if (uiMs < CCSDS_SEG_TIMEOUT_MS) return;
+        stSegStats.uiTmAbort++;
+    } else {
+        stSegStats.uiTmXfer++;
+        uiMs = (UInt32)((xTaskGetTickCount() - stTmSeg.xStart) * portTICK_PERIOD_MS);
+        if (uiMs > stSegStats.uiTmMaxMs) stSegStats.uiTmMaxMs = uiMs;
+    }
+
+    stTmSeg.uiReady = 0;
+    __sync_synchronize();
+    stTmSeg.uiBusy = 0;
 }
 
 /**
@@ -334,8 +763,8 @@ SInt32 CspReceive(UInt8 *pPacket, SInt32 siLen)
 
 static void CcsdsReceive(UInt8 *pCcsdsPacket, UInt32 uiLen)
 {
-    /* Check Minimum Length: Pri(6) + TC_Sec(4) = 10 */
-    if (uiLen < (CCSDS_PRI_HEADER_SIZE + CCSDS_TC_SEC_HEADER_SIZE)) return;
+    /* Check Minimum Length: Pri(6) + TC_Sec(4) + CRC(2) = 12 */
+    if (uiLen < (CCSDS_PRI_HEADER_SIZE + CCSDS_TC_SEC_HEADER_SIZE + 2)) return;
 
     UInt16 usApid = ((pCcsdsPacket[0] & 0x07) << 8) | pCcsdsPacket[1];
     UInt8 *pSecHeader = &pCcsdsPacket[CCSDS_PRI_HEADER_SIZE];
@@ -349,69 +778,173 @@ static void CcsdsReceive(UInt8 *pCcsdsPacket, UInt32 uiLen)
 
     xil_printf("[CCSDS] APID:0x%X Svc:%d Sub:%d\r\n", usApid, ucServiceId, ucSubtypeId);
 
-    /* Use 0xFF for Success/Valid Ack */
-    switch (ucServiceId)
-    {
-    case PUS_SVC_TEST:
-        if (ucSubtypeId == PUS_SUB_TEST_START) ProcTestStart();
-        else if (ucSubtypeId == PUS_SUB_TEST_STOP) ProcTestStop();
-        else if (ucSubtypeId == PUS_SUB_TEST_SET_PARAM) ProcSetTestParam();
-        else if (ucSubtypeId == PUS_SUB_TEST_SEND_TPVAW) ProcSaveTpvaw(pUserData, uiUserDataLen);
-        else if (ucSubtypeId >= PUS_SUB_TEST_DATA_MIN && ucSubtypeId <= PUS_SUB_TEST_DATA_MAX) ProcReqTestData(ucSubtypeId);
-        else {
-            xil_printf("[CCSDS] Unknown Subtype %d for Svc 1\r\n", ucSubtypeId);
+    /* Segmented TC: collect until the last segment, then dispatch the whole user data */
+    UInt8 ucSeqFlags = (pCcsdsPacket[2] >> 6) & 0x03;
+    if (ucSeqFlags != CCSDS_SEQ_UNSEG) {
+        UInt16 usSeq = ((UInt16)(pCcsdsPacket[2] & 0x3F) << 8) | pCcsdsPacket[3];
+        SInt32 siSeg = CcsdsReassemble(usApid, ucSeqFlags, usSeq, &ucServiceId, &ucSubtypeId, &pUserData, &uiUserDataLen);
+        if (siSeg < 0) {
             SendResponse(ucServiceId, ucSubtypeId, TM_ACK_INVALID);
+            return;
         }
-        break;
-    case PUS_SVC_HK:
-        if (ucSubtypeId == PUS_SUB_HK_REQ) ProcHkReq();
-        else SendResponse(ucServiceId, ucSubtypeId, TM_ACK_INVALID);
-        break;
-    case PUS_SVC_FUNCTION:
-        if (ucSubtypeId == PUS_SUB_FUNC_EXEC) ProcFuncExec();
-        else SendResponse(ucServiceId, ucSubtypeId, TM_ACK_INVALID);
-        break;
-    case PUS_SVC_DIAGNOSE:
-        if (ucSubtypeId == PUS_SUB_DIAG_PING) ProcPing(pUserData, uiUserDataLen);
-        else SendResponse(ucServiceId, ucSubtypeId, TM_ACK_INVALID);
-        break;
-    default:
-        /* Invalid Service */
+        if (siSeg == 0) return; // More segments to come
+    }
+
+    /* Registered handler (length checked); unknown or malformed TC -> Invalid Ack */
+    SInt32 siRet = PusDispatch(ucServiceId, ucSubtypeId, pUserData, uiUserDataLen);
+    if (siRet != PUS_OK) {
+        if (siRet == PUS_ERR_SUBTYPE) xil_printf("[CCSDS] Unknown Subtype %d for Svc %d\r\n", ucSubtypeId, ucServiceId);
         SendResponse(ucServiceId, ucSubtypeId, TM_ACK_INVALID);
-        break;
     }
 }
 
-static void ProcTestStart(void) {
+/**
+ * @brief Add one TC segment to the reassembly buffer (IgnuTask)
+ * Segments repeat the primary and secondary header; the user data of the
+ * first to the last segment is concatenated. Service / subtype are those
+ * of the first segment. On completion *ppData / *pLen point to the whole
+ * user data (valid until the next TC).
+ * @param ppData / pLen In: user data of this segment
+ * @return SInt32 1: complete, 0: collecting, -1: error (reassembly dropped)
+ */
+static SInt32 CcsdsReassemble(UInt16 usApid, UInt8 ucSeqFlags, UInt16 usSeq, UInt8 *pSvc, UInt8 *pSub,
+                              UInt8 **ppData, UInt32 *pLen)
+{
+    CcsdsReasm_t *pR = &stTcReasm;
+    TickType_t xNow = xTaskGetTickCount();
+
+    stSegStats.uiTcSeg++;
+
+    if ((pR->uiActive != 0) && ((xNow - pR->xLastTick) > pdMS_TO_TICKS(CCSDS_TC_REASM_TIMEOUT_MS))) {
+        xil_printf("[CCSDS] TC Reassembly Timeout (Svc:%d Sub:%d, %d Bytes)\r\n", pR->ucSvc, pR->ucSub, pR->uiLen);
+        stSegStats.uiTcTimeout++;
+        pR->uiActive = 0;
+    }
+
+    if (ucSeqFlags == CCSDS_SEQ_FIRST) {
+        if (pR->uiActive != 0) stSegStats.uiTcSeqErr++; // Previous one never completed
+        pR->uiActive = 1;
+        pR->usApid = usApid;
+        pR->ucSvc = *pSvc;
+        pR->ucSub = *pSub;
+        pR->uiLen = 0;
+    } else if ((pR->uiActive == 0) || (usApid != pR->usApid) || (usSeq != pR->usNextSeq)) {
+        xil_printf("[CCSDS] TC Segment Out of Sequence (APID:0x%X Seq:%d)\r\n", usApid, usSeq);
+        stSegStats.uiTcSeqErr++;
+        if (pR->uiActive != 0) {
+            *pSvc = pR->ucSvc;
+            *pSub = pR->ucSub;
+        }
+        pR->uiActive = 0;
+        return -1;
+    }
+
+    *pSvc = pR->ucSvc;
+    *pSub = pR->ucSub;
+
+    if ((pR->uiLen + *pLen) > CCSDS_TC_REASM_MAX) {
+        xil_printf("[CCSDS] TC Reassembly Overflow (%d Bytes)\r\n", pR->uiLen + *pLen);
+        stSegStats.uiTcOverflow++;
+        pR->uiActive = 0;
+        return -1;
+    }
+
+    memcpy(&ucTcReasmBuf[pR->uiLen], *ppData, *pLen);
+    pR->uiLen += *pLen;
+    pR->usNextSeq = (usSeq + 1) & CCSDS_SEQ_CNT_MASK;
+    pR->xLastTick = xNow;
+
+    if (ucSeqFlags != CCSDS_SEQ_LAST) return 0;
+
+    pR->uiActive = 0;
+    stSegStats.uiTcDone++;
+    *ppData = ucTcReasmBuf;
+    *pLen = pR->uiLen;
+    return 1;
+}
+
+/**
+ * @brief TM sequence counters, segmented TM and TC reassembly (DBG "ccsds")
+ */
+void CcsdsReport(void)
+{
+    CcsdsSegStats_t stStats = stSegStats;
+    UInt32 i;
+
+    for (i = 0; i < TM_APID_NUM; i++) {
+        xil_printf("[CCSDS] TM APID 0x%03X: next seq %u, packets %u\r\n",
+            stTmApid[i].usApid, stTmApid[i].usSeq, stTmApid[i].uiPkt);
+    }
+    xil_printf("[CCSDS] TM segmented: %u transfers, %u segments (%u B each), %u aborted, max %u ms\r\n",
+        stStats.uiTmXfer, stStats.uiTmSeg, (UInt32)CCSDS_SEG_DATA_MAX, stStats.uiTmAbort, stStats.uiTmMaxMs);
+    xil_printf("[CCSDS] TM burst: %u oversize packets dropped (above %u B)\r\n",
+        stStats.uiTmOversize, (UInt32)CCSDS_SEG_DATA_MAX);
+    xil_printf("[CCSDS] TC reassembly: %u done, %u segments, seq err %u, overflow %u, timeout %u%s\r\n",
+        stStats.uiTcDone, stStats.uiTcSeg, stStats.uiTcSeqErr, stStats.uiTcOverflow, stStats.uiTcTimeout,
+        (stTcReasm.uiActive != 0) ? " (collecting)" : "");
+}
+
+/**
+ * @brief Register the TC handlers (IgnuAppInit, before the tasks start)
+ */
+void TmtcInit(void)
+{
+    /* Service 1: Test */
+    PusRegister(PUS_SVC_TEST, PUS_SUB_TEST_START, PUS_SUB_TEST_START, 0, PUS_LEN_ANY, ProcTestStart, "TestStart");
+    PusRegister(PUS_SVC_TEST, PUS_SUB_TEST_STOP, PUS_SUB_TEST_STOP, 0, PUS_LEN_ANY, ProcTestStop, "TestStop");
+    PusRegister(PUS_SVC_TEST, PUS_SUB_TEST_SET_PARAM, PUS_SUB_TEST_SET_PARAM, 0, PUS_LEN_ANY, ProcSetTestParam, "SetParam");
+    PusRegister(PUS_SVC_TEST, PUS_SUB_TEST_SEND_TPVAW, PUS_SUB_TEST_SEND_TPVAW,
+                sizeof(TpvawData_t), sizeof(TpvawData_t), ProcSaveTpvaw, "TPVAW");
+    PusRegister(PUS_SVC_TEST, PUS_SUB_TEST_DATA_MIN, PUS_SUB_TEST_DATA_MAX, 0, PUS_LEN_ANY, ProcReqTestData, "ReqTestData");
+
+    /* Service 5: Housekeeping */
+    PusRegister(PUS_SVC_HK, PUS_SUB_HK_REQ, PUS_SUB_HK_REQ, 0, PUS_LEN_ANY, ProcHkReq, "HkReq");
+    PusRegister(PUS_SVC_HK, PUS_SUB_HK_SET_RATE, PUS_SUB_HK_SET_RATE,
+                TM_RATE_CMD_SIZE, TM_RATE_CMD_SIZE, ProcSetTmRate, "SetTmRate");
+
+    /* Service 8: Function Management */
+    PusRegister(PUS_SVC_FUNCTION, PUS_SUB_FUNC_EXEC, PUS_SUB_FUNC_EXEC, 0, PUS_LEN_ANY, ProcFuncExec, "FuncExec");
+
+    /* Service 20: Diagnose */
+    PusRegister(PUS_SVC_DIAGNOSE, PUS_SUB_DIAG_PING, PUS_SUB_DIAG_PING, 0, CCSDS_TC_REASM_MAX, ProcPing, "Ping");
+
+    /* Periodic TM: Test Data at 1 Hz (as before), the others off until set by TC */
+    TmSchedRegister(TM_PROD_TEST, PUS_SVC_TEST, PUS_SUB_TEST_REQ_DATA, TmBuildTestData, sizeof(TestData_t),
+                    1, 1000, TM_PHASE_AUTO, "Test");
+    TmSchedRegister(TM_PROD_HK, PUS_SVC_HK, PUS_SUB_HK_REQ, TmBuildHk, sizeof(PayloadStatus_t),
+                    0, 0, TM_PHASE_AUTO, "HK");
+    TmSchedRegister(TM_PROD_IMU, PUS_SVC_HK, PUS_SUB_HK_IMU, TmBuildImu, sizeof(ImuSampleTm_t),
+                    1, 0, TM_PHASE_AUTO, "IMU");
+    TmSchedRegister(TM_PROD_GPS, PUS_SVC_HK, PUS_SUB_HK_GPS, TmBuildGps, sizeof(GpsFixTm_t),
+                    1, 0, TM_PHASE_AUTO, "GPS");
+    TmSchedRegister(TM_PROD_NAV, PUS_SVC_HK, PUS_SUB_HK_NAV, TmBuildNav, sizeof(NavStateTm_t),
+                    1, 0, TM_PHASE_AUTO, "Nav");
+}
+
+static void ProcTestStart(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen) {
     xil_printf("[CMD] Start Test\r\n");
     SetIgnuState(IGNU_STATE_RUN);
     SendResponse(PUS_SVC_TEST, PUS_SUB_TEST_START, TM_ACK_VALID);
 }
-static void ProcTestStop(void) {
+static void ProcTestStop(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen) {
     xil_printf("[CMD] Stop Test\r\n");
     SetIgnuState(IGNU_STATE_IDLE);
     SendResponse(PUS_SVC_TEST, PUS_SUB_TEST_STOP, TM_ACK_VALID);
 }
-static void ProcSetTestParam(void) {
+static void ProcSetTestParam(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen) {
     xil_printf("[CMD] Set Param\r\n");
     SendResponse(PUS_SVC_TEST, PUS_SUB_TEST_SET_PARAM, TM_ACK_VALID);
 }
 
 /**
  * @brief Handle TPVAW Data (Pus Service 1, Subtype 5)
- * Payload Size: 108 Bytes
+ * Payload Size: 108 Bytes (checked by PusDispatch)
  * Includes Quaternion to Euler Angle (Deg) Conversion for Debug
  */
-static void ProcSaveTpvaw(UInt8 *pData, UInt32 uiLen) 
+static void ProcSaveTpvaw(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen)
 {
     xil_printf("[CMD] TPVAW (Len:%d)\r\n", uiLen);
 
-    if (uiLen != sizeof(TpvawData_t)) {
-        xil_printf("[TPVAW] Error: Invalid Length %d (Expected %d)\r\n", uiLen, sizeof(TpvawData_t));
-        SendResponse(PUS_SVC_TEST, PUS_SUB_TEST_SEND_TPVAW, TM_ACK_INVALID);
-        return;
-    }
-
     TpvawData_t stTpvaw;
     /* Safe Copy using memcpy to prevent Unaligned Access Faults */
     memcpy(&stTpvaw, pData, sizeof(TpvawData_t));
@@ -426,28 +959,10 @@ static void ProcSaveTpvaw(UInt8 *pData, UInt32 uiLen)
 
     /* Quaternion to Euler Conversion (Deg) */
     /* Assuming q4 is scalar (w), q1,q2,q3 are vector (x,y,z) */
-    float q1 = stTpvaw.q1; // x
-    float q2 = stTpvaw.q2; // y
-    float q3 = stTpvaw.q3; // z
-    float q4 = stTpvaw.q4; // w
-
-    /* Roll (x-axis rotation) */
-    float sinr_cosp = 2 * (q4 * q1 + q2 * q3);
-    float cosr_cosp = 1 - 2 * (q1 * q1 + q2 * q2);
-    float roll = atan2(sinr_cosp, cosr_cosp) * RAD_TO_DEG;
-
-    /* Pitch (y-axis rotation) */
-    float sinp = 2 * (q4 * q2 - q3 * q1);
-    float pitch;
-    if (fabs(sinp) >= 1)
-        pitch = copysign(PI / 2, sinp) * RAD_TO_DEG; // Use 90 degrees if out of range
-    else
-        pitch = asin(sinp) * RAD_TO_DEG;
-
-    /* Yaw (z-axis rotation) */
-    float siny_cosp = 2 * (q4 * q3 + q1 * q2);
-    float cosy_cosp = 1 - 2 * (q2 * q2 + q3 * q3);
-    float yaw = atan2(siny_cosp, cosy_cosp) * RAD_TO_DEG;
+    float fQ[4] = { stTpvaw.q4, stTpvaw.q1, stTpvaw.q2, stTpvaw.q3 };
+    float roll, pitch, yaw;
+
+    QuatToEuler(fQ, &roll, &pitch, &yaw);
 
     xil_printf("[TPVAW] Attitude(Deg): Roll=");
     PrintFloat(roll);
@@ -457,39 +972,83 @@ static void ProcSaveTpvaw(UInt8 *pData, UInt32 uiLen)
     PrintFloat(yaw);
     xil_printf("\r\n");
 
-    /* TODO: Save or Process TPVAW Data here */
+    /* Reference attitude for the on-board strapdown propagation */
+    StrapdownInit(fQ[0], fQ[1], fQ[2], fQ[3]);
+
+    /* Keep for time-aligned queries (telemetry / filter) */
+    HistTpvaw_t stHist;
+    stHist.dTime1 = stTpvaw.timestamp1;
+    stHist.dTime2 = stTpvaw.timestamp2;
+    stHist.dPos[0] = stTpvaw.posX;
+    stHist.dPos[1] = stTpvaw.posY;
+    stHist.dPos[2] = stTpvaw.posZ;
+    stHist.dVel[0] = stTpvaw.velX;
+    stHist.dVel[1] = stTpvaw.velY;
+    stHist.dVel[2] = stTpvaw.velZ;
+    memcpy(stHist.fQ, fQ, sizeof(fQ));
+    HistTpvawPush(&stHist, HistNow());
 
     SendResponse(PUS_SVC_TEST, PUS_SUB_TEST_SEND_TPVAW, TM_ACK_VALID);
 }
 
-static void ProcFuncExec(void) {
+static void ProcFuncExec(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen) {
     xil_printf("[CMD] Func Exec\r\n");
     SendResponse(PUS_SVC_FUNCTION, PUS_SUB_FUNC_EXEC, TM_ACK_VALID);
 }
-static void ProcPing(UInt8 *pUserData, UInt32 uiUserDataLen) {
+static void ProcPing(UInt8 ucSvc, UInt8 ucSub, UInt8 *pUserData, UInt32 uiUserDataLen) {
     xil_printf("[CMD] Ping\r\n");
     /* Send pong with same user data as ping */
     SendCcsdsTm(PUS_SVC_DIAGNOSE, PUS_SUB_DIAG_PONG, pUserData, uiUserDataLen);
 }
 
-static void ProcReqTestData(UInt8 ucType) {
-    xil_printf("[CMD] Req Test Data %d\r\n", ucType);
+static void ProcReqTestData(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen) {
+    xil_printf("[CMD] Req Test Data %d\r\n", ucSub);
     /* For ReqTestData command, we can send a single packet */
     SendTestData();
 }
 
-static void ProcHkReq(void) {
+static void ProcHkReq(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen) {
     xil_printf("[CMD] HK Req\r\n");
     
     PayloadStatus_t stStatus;
-    memset(&stStatus, 0, sizeof(PayloadStatus_t));
-    
+    BuildHkStatus(&stStatus);
+
+    xil_printf("[HK] Temp: %d (0.1 degC)\r\n", stStatus.boardTemp);
+
+    /* Svc 5, Sub 1, Data 6 bytes */
+    SendCcsdsTm(PUS_SVC_HK, PUS_SUB_HK_REQ, (UInt8*)&stStatus, sizeof(PayloadStatus_t));
+}
+
+/**
+ * @brief Set the period / phase of a periodic TM product (Svc 5, Sub 31)
+ * Payload: [Product(1B) | Period ms(2B) | Phase ms(2B)], Big Endian
+ * Period 0 stops the product, phase 0xFFFF places it automatically.
+ */
+static void ProcSetTmRate(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen) {
+    UInt32 uiPeriodMs = ((UInt32)pData[1] << 8) | pData[2];
+    UInt32 uiPhaseMs = ((UInt32)pData[3] << 8) | pData[4];
+    SInt32 siRet;
+
+    siRet = TmSchedSetRate(pData[0], uiPeriodMs, uiPhaseMs);
+    xil_printf("[CMD] Set TM Rate: product %d, period %d ms, phase %d ms (%d)\r\n",
+        pData[0], uiPeriodMs, uiPhaseMs, siRet);
+
+    SendResponse(PUS_SVC_HK, PUS_SUB_HK_SET_RATE, (siRet == TM_SCHED_OK) ? TM_ACK_VALID : TM_ACK_INVALID);
+}
+
+/**
+ * @brief Payload Status (HK request and periodic HK)
+ */
+static void BuildHkStatus(PayloadStatus_t *pStatus)
+{
     GpsData_t stGpsData;
     ImuData_t stImuData;
-    
+
+    memset(pStatus, 0, sizeof(PayloadStatus_t));
+
     /* 1. Get GPS Error */
     GetGpsData(&stGpsData);
-    stStatus.gpsStatus = stGpsData.error;
+    pStatus->gpsStatus = stGpsData.error;
 
     /* 2. Get IMU Status (Check update within 1s) */
     UInt32 uiNow = xTaskGetTickCount();
@@ -497,83 +1056,236 @@ static void ProcHkReq(void) {
     /* Assuming tick is 1ms or close (FreeRTOS default) */
     /* Check for wrap-around or just simple diff */
     if ((uiNow - uiLastImu) <= pdMS_TO_TICKS(1000)) {
-        stStatus.imuStatus = 0; // Normal
+        pStatus->imuStatus = 0; // Normal
     } else {
-        stStatus.imuStatus = 1; // Error (Timeout)
+        pStatus->imuStatus = 1; // Error (Timeout)
     }
 
     /* 3. Board Temp (Use IMU Gyro X-Axis Temperature) */
     GetImuData(&stImuData);
     /* Convert Float Temp to SInt16 with 0.1 degC unit (e.g. 25.5 C -> 255) */
-    stStatus.boardTemp = (SInt16)(stImuData.fTemp * 10.0f); 
-    
-    xil_printf("[HK] Temp: %d (Float: ", stStatus.boardTemp);
-    PrintFloat(stImuData.fTemp);
-    xil_printf(")\r\n"); 
+    pStatus->boardTemp = (SInt16)(stImuData.fTemp * 10.0f); 
     
     /* 4. Payload Status */
     if (GetIgnuState() == IGNU_STATE_RUN) {
-        stStatus.payloadStatus = 1; // Testing
+        pStatus->payloadStatus = 1; // Testing
     } else {
-        stStatus.payloadStatus = 0; // Idle
+        pStatus->payloadStatus = 0; // Idle
     }
     
-    stStatus.gpsTrackStatus = 0; // TODO: Map GPS mode if needed
-
-    /* Svc 5, Sub 1, Data 8 bytes */
-    SendCcsdsTm(PUS_SVC_HK, 1, (UInt8*)&stStatus, sizeof(PayloadStatus_t));
+    pStatus->gpsTrackStatus = 0; // TODO: Map GPS mode if needed
 }
 
 /* ============================================================================
- * Send Test Data (1Hz Periodic Telemetry)
+ * Send Test Data (On Request; periodic copies come from the TM scheduler)
  * Service: 1, Subtype: 10
  * ============================================================================ */
 void SendTestData(void)
 {
     static TestData_t stTestData;
+
+    BuildTestData(&stTestData, FALSE);
+
+    /* Send Telemetry */
+    /* Service 1, Subtype 10 (PUS_SUB_TEST_REQ_DATA or PUS_SUB_TEST_DATA_MIN) */
+    SendCcsdsTm(PUS_SVC_TEST, PUS_SUB_TEST_REQ_DATA, (UInt8*)&stTestData, sizeof(TestData_t));
+}
+
+/**
+ * @brief Test Data contents (GPS / filter PVT, IMU mean, attitude)
+ * @param ucPeriodic TRUE: TM scheduler (TxTask), closes the IMU mean interval and
+ *                   records the sample-to-TM latency; FALSE: on-request (IgnuTask)
+ */
+static void BuildTestData(TestData_t *pTestData, UInt8 ucPeriodic)
+{
     ImuData_t stImuData;
     GpsData_t stGpsData;
+    float fRoll, fPitch, fYaw;
+    NavOutput_t stNavOut;
+    sSnapInfo stImuInfo;
+    SInt32 siImuSnap;
+    UInt64 ullSample, ullNow;
 
     /* Initialize with zeroes first */
-    memset(&stTestData, 0, sizeof(TestData_t));
+    memset(pTestData, 0, sizeof(TestData_t));
 
     /* Get Latest GPS Data (Internal: Radians) */
     GetGpsData(&stGpsData);
 
-    stTestData.gpsTime = stGpsData.tow; 
-    stTestData.gpsWeek = (UInt32)stGpsData.wnc; 
+    pTestData->gpsTime = stGpsData.tow; 
+    pTestData->gpsWeek = (UInt32)stGpsData.wnc; 
     
     /* Convert Radian to Degree for Telemetry */
-    stTestData.lat = stGpsData.latitude * RAD_TO_DEG;
-    stTestData.lon = stGpsData.longitude * RAD_TO_DEG;
+    pTestData->lat = stGpsData.latitude * RAD_TO_DEG;
+    pTestData->lon = stGpsData.longitude * RAD_TO_DEG;
     
-    stTestData.alt = (float)stGpsData.height; 
+    pTestData->alt = (float)stGpsData.height; 
     
-    stTestData.velN = stGpsData.vn;
-    stTestData.velE = stGpsData.ve;
-    stTestData.velU = stGpsData.vu;
+    pTestData->velN = stGpsData.vn;
+    pTestData->velE = stGpsData.ve;
+    pTestData->velU = stGpsData.vu;
+
+    /* GPS/INS filter solution once initialised (overrides raw GPS) */
+    if (NavFilterGetOutput(&stNavOut)) {
+        pTestData->lat = stNavOut.dLat * RAD_TO_DEG;
+        pTestData->lon = stNavOut.dLon * RAD_TO_DEG;
+        pTestData->alt = (float)stNavOut.dHeight;
+        pTestData->velN = stNavOut.fVn;
+        pTestData->velE = stNavOut.fVe;
+        pTestData->velU = stNavOut.fVu;
+    }
 
-    stTestData.mode = stGpsData.mode;
-    stTestData.error = stGpsData.error;
-    stTestData.NrSV = stGpsData.nrSv;
+    pTestData->mode = stGpsData.mode;
+    pTestData->error = stGpsData.error;
+    pTestData->NrSV = stGpsData.nrSv;
 
-    /* Get Latest IMU Data */
-    GetImuData(&stImuData);
+    /* Full-rate IMU Mean over this TM interval (latest sample if none).
+     * Only the periodic TM closes the interval; on-request TM reads it. */
+    siImuSnap = GetImuSnapshot(&stImuData, &stImuInfo);
+    if (ucPeriodic) ImuTakeMean(&stImuData);
+    else ImuPeekMean(&stImuData);
 
-    stTestData.meanAccX = stImuData.fAccX;
-    stTestData.meanAccY = stImuData.fAccY;
-    stTestData.meanAccZ = stImuData.fAccZ;
+    pTestData->meanAccX = stImuData.fAccX;
+    pTestData->meanAccY = stImuData.fAccY;
+    pTestData->meanAccZ = stImuData.fAccZ;
     
-    stTestData.meanGyroX = stImuData.fGyroX;
-    stTestData.meanGyroY = stImuData.fGyroY;
-    stTestData.meanGyroZ = stImuData.fGyroZ;
+    pTestData->meanGyroX = stImuData.fGyroX;
+    pTestData->meanGyroY = stImuData.fGyroY;
+    pTestData->meanGyroZ = stImuData.fGyroZ;
+
+    /* Attitude (Roll, Pitch, Yaw): strapdown propagation at IMU rate */
+    StrapdownGetEuler(&fRoll, &fPitch, &fYaw);
+    pTestData->roll = fRoll;
+    pTestData->pitch = fPitch;
+    pTestData->yaw = fYaw;
+
+    /* Sample-to-TM latency: GPS fix epoch (GPS time) and last IMU record.
+     * Periodic TM only: the statistics belong to TxTask. */
+    if (ucPeriodic == FALSE) return;
+
+    ullNow = HistNow();
+    if ((stGpsData.mode != 0) && (TimeSyncTowToStamp(stGpsData.tow, &ullSample) == 0)) {
+        TimeSyncLatency(TIME_LAT_GPS, ullSample, ullNow);
+    }
+    if (siImuSnap >= 0) {
+        TimeSyncLatency(TIME_LAT_IMU, stImuInfo.ullStamp, ullNow);
+    }
+}
 
-    /* Mock Attitude (Roll, Pitch, Yaw) */
-    stTestData.roll = 0.0f;
-    stTestData.pitch = 0.0f;
-    stTestData.yaw = 0.0f;
+/* ============================================================================
+ * Periodic TM Builders (TM scheduler, TxTask)
+ * ============================================================================ */
+static UInt32 TmBuildTestData(UInt8 *pBuf, UInt32 uiMax)
+{
+    if (uiMax < sizeof(TestData_t)) return 0;
 
-    /* Send Telemetry */
-    /* Service 1, Subtype 10 (PUS_SUB_TEST_REQ_DATA or PUS_SUB_TEST_DATA_MIN) */
-    SendCcsdsTm(PUS_SVC_TEST, PUS_SUB_TEST_REQ_DATA, (UInt8*)&stTestData, sizeof(TestData_t));
+    BuildTestData((TestData_t *)pBuf, TRUE);
+    return sizeof(TestData_t);
+}
+
+static UInt32 TmBuildHk(UInt8 *pBuf, UInt32 uiMax)
+{
+    if (uiMax < sizeof(PayloadStatus_t)) return 0;
+
+    BuildHkStatus((PayloadStatus_t *)pBuf);
+    return sizeof(PayloadStatus_t);
+}
+
+/**
+ * @brief IMU Sample (Svc 5, Sub 2): latest STIM record, not averaged
+ */
+static UInt32 TmBuildImu(UInt8 *pBuf, UInt32 uiMax)
+{
+    ImuSampleTm_t *pTm = (ImuSampleTm_t *)pBuf;
+    ImuData_t stImuData;
+    sSnapInfo stInfo;
+
+    if (uiMax < sizeof(ImuSampleTm_t)) return 0;
+    if (GetImuSnapshot(&stImuData, &stInfo) < 0) return 0; // No IMU data yet
+
+    memset(pTm, 0, sizeof(ImuSampleTm_t));
+    pTm->counter = stImuData.ucCounter;
+    pTm->gyroX = stImuData.fGyroX;
+    pTm->gyroY = stImuData.fGyroY;
+    pTm->gyroZ = stImuData.fGyroZ;
+    pTm->accX = stImuData.fAccX;
+    pTm->accY = stImuData.fAccY;
+    pTm->accZ = stImuData.fAccZ;
+    pTm->temp = stImuData.fTemp;
+
+    return sizeof(ImuSampleTm_t);
+}
+
+/**
+ * @brief GPS Fix (Svc 5, Sub 3): latest receiver PVT and quality
+ */
+static UInt32 TmBuildGps(UInt8 *pBuf, UInt32 uiMax)
+{
+    GpsFixTm_t *pTm = (GpsFixTm_t *)pBuf;
+    GpsData_t stGpsData;
+    sSnapInfo stInfo;
+
+    if (uiMax < sizeof(GpsFixTm_t)) return 0;
+    if (GetGpsSnapshot(&stGpsData, &stInfo) < 0) return 0; // No GPS data yet
+
+    memset(pTm, 0, sizeof(GpsFixTm_t));
+    pTm->gpsWeek = (UInt32)stGpsData.wnc;
+    pTm->gpsTime = stGpsData.tow;
+    pTm->lat = stGpsData.latitude * RAD_TO_DEG;
+    pTm->lon = stGpsData.longitude * RAD_TO_DEG;
+    pTm->alt = (float)stGpsData.height;
+    pTm->velN = stGpsData.vn;
+    pTm->velE = stGpsData.ve;
+    pTm->velU = stGpsData.vu;
+    pTm->mode = stGpsData.mode;
+    pTm->error = stGpsData.error;
+    pTm->NrSV = stGpsData.nrSv;
+    pTm->undulation = stGpsData.undulation;
+    pTm->cog = stGpsData.gog;
+    pTm->rxClkBias = stGpsData.rxClkBias;
+    pTm->rxClkDrift = stGpsData.rxClkDrift;
+    pTm->hAccuracy = stGpsData.hAccuracy;
+    pTm->vAccuracy = stGpsData.vAccuracy;
+    pTm->latency = stGpsData.latency;
+
+    return sizeof(GpsFixTm_t);
+}
+
+/**
+ * @brief Filter State (Svc 5, Sub 4): GPS/INS solution, attitude, biases, time sync
+ */
+static UInt32 TmBuildNav(UInt8 *pBuf, UInt32 uiMax)
+{
+    NavStateTm_t *pTm = (NavStateTm_t *)pBuf;
+    NavOutput_t stNavOut;
+    SInt64 sllGpsNs;
+    float fQ[4];
+    float fRoll, fPitch, fYaw;
+
+    if (uiMax < sizeof(NavStateTm_t)) return 0;
+
+    memset(pTm, 0, sizeof(NavStateTm_t));
+
+    pTm->navValid = (UInt8)NavFilterGetOutput(&stNavOut);
+    if (pTm->navValid != 0) {
+        pTm->lat = stNavOut.dLat * RAD_TO_DEG;
+        pTm->lon = stNavOut.dLon * RAD_TO_DEG;
+        pTm->alt = (float)stNavOut.dHeight;
+        pTm->velN = stNavOut.fVn;
+        pTm->velE = stNavOut.fVe;
+        pTm->velU = stNavOut.fVu;
+        memcpy(pTm->accBias, stNavOut.fAccBias, sizeof(pTm->accBias));
+        memcpy(pTm->gyroBias, stNavOut.fGyroBias, sizeof(pTm->gyroBias));
+    }
+
+    pTm->attAligned = (UInt8)StrapdownGetEuler(&fRoll, &fPitch, &fYaw);
+    StrapdownGetQuat(fQ);
+    memcpy(pTm->q, fQ, sizeof(pTm->q));
+    pTm->roll = fRoll;
+    pTm->pitch = fPitch;
+    pTm->yaw = fYaw;
+
+    pTm->timeState = (UInt8)TimeSyncToGps(HistNow(), &sllGpsNs);
+
+    return sizeof(NavStateTm_t);
 }
@@ -0,0 +1,238 @@
+/**
+ * @file crc.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief CSP CRC-32C / CCSDS CRC-16 Kernels (Bitwise, Table, Slicing-by-8)
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "../Inc/crc.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+/* Slicing-by-8 tables for the shared kernel in common.c (CRC-16 left-aligned in 32 bits) */
+static sCrcSlice8 stCrc32cTable;
+static sCrcSlice8 stCrc16Table;
+static volatile UInt8 ucCrcTableReady = FALSE;
+
+static UInt8 ucBenchBuf[CRC_BENCH_MAX_LEN];
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static UInt32 Crc32cBitwise(UInt32 uiCrc, const UInt8 *pData, UInt32 uiLen);
+static UInt32 Crc32cTable(UInt32 uiCrc, const UInt8 *pData, UInt32 uiLen);
+static UInt32 Crc32cSlice8(UInt32 uiCrc, const UInt8 *pData, UInt32 uiLen);
+static UInt16 Crc16Bitwise(UInt16 usCrc, const UInt8 *pData, UInt32 uiLen);
+static UInt16 Crc16Table(UInt16 usCrc, const UInt8 *pData, UInt32 uiLen);
+static UInt16 Crc16Slice8(UInt16 usCrc, const UInt8 *pData, UInt32 uiLen);
+static void CrcBenchPrint(const char *pName, UInt32 uiBytes, XTime xTicks, UInt8 ucOk);
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @brief Build CRC Tables (once, called from IgnuAppInit before tasks start)
+ */
+void CrcInit(void)
+{
+    if (ucCrcTableReady == TRUE) return;
+
+    CrcSlice8Init(&stCrc32cTable, CRC32C_POLY, TRUE);
+    CrcSlice8Init(&stCrc16Table, (UInt32)CRC16_POLY << 16, FALSE);
+
+    __sync_synchronize(); // Tables visible before the flag
+    ucCrcTableReady = TRUE;
+}
+
+/* ----------------------------------------------------------------------------
+ * CSP CRC-32C (Castagnoli Reflected)
+ * ---------------------------------------------------------------------------- */
+static UInt32 Crc32cBitwise(UInt32 uiCrc, const UInt8 *pData, UInt32 uiLen)
+{
+    UInt32 i, j;
+
+    for (i = 0; i < uiLen; i++) {
+        uiCrc ^= pData[i];
+        for (j = 0; j < 8; j++) {
+            if (uiCrc & 1) uiCrc = (uiCrc >> 1) ^ CRC32C_POLY;
+            else uiCrc = (uiCrc >> 1);
+        }
+    }
+    return uiCrc;
+}
+
+static UInt32 Crc32cTable(UInt32 uiCrc, const UInt8 *pData, UInt32 uiLen)
+{
+    return CrcByteUpdate(&stCrc32cTable, uiCrc, pData, uiLen);
+}
+
+static UInt32 Crc32cSlice8(UInt32 uiCrc, const UInt8 *pData, UInt32 uiLen)
+{
+    return CrcSlice8Update(&stCrc32cTable, uiCrc, pData, uiLen);
+}
+
+UInt32 Crc32cInit(void)
+{
+    return 0xFFFFFFFF;
+}
+
+UInt32 Crc32cUpdate(UInt32 uiCrc, const UInt8 *pData, UInt32 uiLen)
+{
+    if (pData == NULL || uiLen == 0) return uiCrc;
+
+#if (IGNU_CRC_IMPL == CRC_IMPL_BITWISE)
+    return Crc32cBitwise(uiCrc, pData, uiLen);
+#else
+    if (ucCrcTableReady != TRUE) CrcInit();
+#if (IGNU_CRC_IMPL == CRC_IMPL_TABLE)
+    return Crc32cTable(uiCrc, pData, uiLen);
+#else
+    return Crc32cSlice8(uiCrc, pData, uiLen);
+#endif
+#endif
+}
+
+UInt32 Crc32cFinal(UInt32 uiCrc)
+{
+    return ~uiCrc;
+}
+
+/* ----------------------------------------------------------------------------
+ * CCSDS CRC-16 (CCITT-FALSE, MSB first)
+ * ---------------------------------------------------------------------------- */
+static UInt16 Crc16Bitwise(UInt16 usCrc, const UInt8 *pData, UInt32 uiLen)
+{
+    UInt32 i, j;
+
+    for (i = 0; i < uiLen; i++) {
+        usCrc ^= (UInt16)(pData[i] << 8);
+        for (j = 0; j < 8; j++) {
+            if (usCrc & 0x8000) usCrc = (UInt16)((usCrc << 1) ^ CRC16_POLY);
+            else usCrc = (UInt16)(usCrc << 1);
+        }
+    }
+    return usCrc;
+}
+
+static UInt16 Crc16Table(UInt16 usCrc, const UInt8 *pData, UInt32 uiLen)
+{
+    return (UInt16)(CrcByteUpdate(&stCrc16Table, (UInt32)usCrc << 16, pData, uiLen) >> 16);
+}
+
+static UInt16 Crc16Slice8(UInt16 usCrc, const UInt8 *pData, UInt32 uiLen)
+{
+    return (UInt16)(CrcSlice8Update(&stCrc16Table, (UInt32)usCrc << 16, pData, uiLen) >> 16);
+}
+
+UInt16 Crc16Init(void)
+{
+    return 0xFFFF;
+}
+
+UInt16 Crc16Update(UInt16 usCrc, const UInt8 *pData, UInt32 uiLen)
+{
+    if (pData == NULL || uiLen == 0) return usCrc;
+
+#if (IGNU_CRC_IMPL == CRC_IMPL_BITWISE)
+    return Crc16Bitwise(usCrc, pData, uiLen);
+#else
+    if (ucCrcTableReady != TRUE) CrcInit();
+#if (IGNU_CRC_IMPL == CRC_IMPL_TABLE)
+    return Crc16Table(usCrc, pData, uiLen);
+#else
+    return Crc16Slice8(usCrc, pData, uiLen);
+#endif
+#endif
+}
+
+UInt16 Crc16Final(UInt16 usCrc)
+{
+    return usCrc; // CCITT-FALSE: No final XOR
+}
+
+/* ----------------------------------------------------------------------------
+ * Benchmark (DBG shell "crc <len> <iter>", target or host simulation)
+ * ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Print throughput as MB/s with 2 decimals (xil_printf has no %f)
+ */
+static void CrcBenchPrint(const char *pName, UInt32 uiBytes, XTime xTicks, UInt8 ucOk)
+{
+    UInt64 ullRate = 0;
+
+    if (xTicks > 0) ullRate = ((UInt64)uiBytes * 100ULL * COUNTS_PER_SECOND) / ((UInt64)xTicks * 1000000ULL);
+
+    xil_printf("  %-16s %5u.%02u MB/s %s\r\n", pName, (UInt32)(ullRate / 100), (UInt32)(ullRate % 100),
+               ucOk ? "" : "(MISMATCH)");
+}
+
+void CrcBenchmark(UInt32 uiLen, UInt32 uiIter)
+{
+    UInt32 i;
+    UInt32 uiRef32 = 0, uiCrc32;
+    UInt16 usRef16 = 0, usCrc16;
+    XTime xStart, xEnd;
+
+    if (uiLen == 0 || uiLen > CRC_BENCH_MAX_LEN) uiLen = CRC_BENCH_MAX_LEN;
+    if (uiIter == 0) uiIter = 1000;
+
+    CrcInit();
+    for (i = 0; i < uiLen; i++) ucBenchBuf[i] = (UInt8)(i * 131 + 7);
+
+    xil_printf("[CRC] %u Bytes x %u (Build: Variant %d)\r\n", uiLen, uiIter, IGNU_CRC_IMPL);
+
+    /* Each pass streams uiIter buffers (CRC chained), result checked against bitwise */
+
+    /* CRC-32C */
+    uiCrc32 = Crc32cInit();
+    XTime_GetTime(&xStart);
+    for (i = 0; i < uiIter; i++) uiCrc32 = Crc32cBitwise(uiCrc32, ucBenchBuf, uiLen);
+    XTime_GetTime(&xEnd);
+    uiRef32 = uiCrc32;
+    CrcBenchPrint("CRC-32C bitwise", uiLen * uiIter, xEnd - xStart, TRUE);
+
+    uiCrc32 = Crc32cInit();
+    XTime_GetTime(&xStart);
+    for (i = 0; i < uiIter; i++) uiCrc32 = Crc32cTable(uiCrc32, ucBenchBuf, uiLen);
+    XTime_GetTime(&xEnd);
+    CrcBenchPrint("CRC-32C table", uiLen * uiIter, xEnd - xStart, (uiCrc32 == uiRef32));
+
+    uiCrc32 = Crc32cInit();
+    XTime_GetTime(&xStart);
+    for (i = 0; i < uiIter; i++) uiCrc32 = Crc32cSlice8(uiCrc32, ucBenchBuf, uiLen);
+    XTime_GetTime(&xEnd);
+    CrcBenchPrint("CRC-32C slice8", uiLen * uiIter, xEnd - xStart, (uiCrc32 == uiRef32));
+
+    /* CRC-16 */
+    usCrc16 = Crc16Init();
+    XTime_GetTime(&xStart);
+    for (i = 0; i < uiIter; i++) usCrc16 = Crc16Bitwise(usCrc16, ucBenchBuf, uiLen);
+    XTime_GetTime(&xEnd);
+    usRef16 = usCrc16;
+    CrcBenchPrint("CRC-16 bitwise", uiLen * uiIter, xEnd - xStart, TRUE);
+
+    usCrc16 = Crc16Init();
+    XTime_GetTime(&xStart);
+    for (i = 0; i < uiIter; i++) usCrc16 = Crc16Table(usCrc16, ucBenchBuf, uiLen);
+    XTime_GetTime(&xEnd);
+    CrcBenchPrint("CRC-16 table", uiLen * uiIter, xEnd - xStart, (usCrc16 == usRef16));
+
+    usCrc16 = Crc16Init();
+    XTime_GetTime(&xStart);
+    for (i = 0; i < uiIter; i++) usCrc16 = Crc16Slice8(usCrc16, ucBenchBuf, uiLen);
+    XTime_GetTime(&xEnd);
+    CrcBenchPrint("CRC-16 slice8", uiLen * uiIter, xEnd - xStart, (usCrc16 == usRef16));
+
+    xil_printf("  CRC-32C %08X, CRC-16 %04X\r\n", Crc32cFinal(uiRef32), Crc16Final(usRef16));
+}
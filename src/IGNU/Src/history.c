@@ -0,0 +1,428 @@
+/**
+ * @file history.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Time-Tagged Sample History (IMU / GPS / TPVAW) Source
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "../Inc/history.h"
+#include "../Inc/strapdown.h"
+#include "../Inc/timesync.h"
+#include "task.h"
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+#include <string.h>
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define HIST_IMU_PERIOD     (COUNTS_PER_SECOND / IMU_RATE_HZ)  // XTime counts per IMU sample
+#define HIST_BENCH_DEPTH    HIST_IMU_DEPTH
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+/* IMU (writer: imu_thread) */
+static UInt64 ullHistImuStamp[HIST_IMU_DEPTH];
+static ImuData_t stHistImu[HIST_IMU_DEPTH];
+static HistRing_t stHistImuRing = HIST_RING_INIT(ullHistImuStamp, stHistImu, sizeof(ImuData_t), HIST_IMU_DEPTH);
+static UInt64 ullHistImuLast = 0;
+
+/* GPS (writer: IgnuTask) */
+static UInt64 ullHistGpsStamp[HIST_GPS_DEPTH];
+static GpsData_t stHistGps[HIST_GPS_DEPTH];
+static HistRing_t stHistGpsRing = HIST_RING_INIT(ullHistGpsStamp, stHistGps, sizeof(GpsData_t), HIST_GPS_DEPTH);
+
+/* TPVAW (writer: IgnuTask) */
+static UInt64 ullHistTpvawStamp[HIST_TPVAW_DEPTH];
+static HistTpvaw_t stHistTpvaw[HIST_TPVAW_DEPTH];
+static HistRing_t stHistTpvawRing = HIST_RING_INIT(ullHistTpvawStamp, stHistTpvaw, sizeof(HistTpvaw_t), HIST_TPVAW_DEPTH);
+
+/* Benchmark */
+static UInt64 ullHistBenchStamp[HIST_BENCH_DEPTH];
+static u32 uiHistBenchData[HIST_BENCH_DEPTH];
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static void HistPrintRing(const char *pName, HistRing_t *pRing);
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @brief Append a sample (single writer per ring)
+ * @return SInt32 0 on success, -1 if the stamp is older than the newest sample
+ */
+SInt32 HistPush(HistRing_t *pRing, UInt64 ullStamp, const void *pData)
+{
+    UInt32 uiHead = pRing->uiHead;
+    UInt32 uiSlot = uiHead & pRing->uiMask;
+
+    if ((uiHead != 0) && (ullStamp < pRing->pStamp[(uiHead - 1) & pRing->uiMask])) {
+        pRing->uiOrderErr++;
+        return -1;
+    }
+
+    pRing->pStamp[uiSlot] = ullStamp;
+    memcpy(pRing->pData + (uiSlot * pRing->uiSize), pData, pRing->uiSize);
+    SNAP_DMB();
+    pRing->uiHead = uiHead + 1;
+    SNAP_DMB();
+
+    return 0;
+}
+
+/**
+ * @brief Find the samples around ullStamp (binary search, no lock)
+ * @param pA Sample at or before ullStamp
+ * @param pB Sample after ullStamp (= pA if ullStamp is the newest stamp)
+ * @param pFrac Position of ullStamp between pA (0) and pB (1)
+ * @return SInt32 HIST_OK or HIST_ERR_xxx
+ *
+ * The search only reads slots from the oldest kept sample on. If the writer
+ * reached that slot before the copy finished, everything read may be torn
+ * and the search is repeated.
+ */
+SInt32 HistFind(HistRing_t *pRing, UInt64 ullStamp, void *pA, void *pB, float *pFrac)
+{
+    const UInt32 uiMask = pRing->uiMask;
+    const UInt32 uiKeep = (uiMask + 1) - HIST_GUARD;
+    UInt32 uiHead, uiLo, uiNum, uiBase, uiHalf, uiA, uiB, uiRetry;
+    UInt64 ullA, ullB;
+    SInt32 siRet;
+
+    pRing->uiQuery++;
+
+    for (uiRetry = 0; uiRetry < HIST_RETRY_MAX; uiRetry++) {
+        uiHead = pRing->uiHead;
+        SNAP_DMB();
+        if (uiHead == 0) return HIST_ERR_EMPTY;
+
+        uiNum = (uiHead < uiKeep) ? uiHead : uiKeep;
+        uiLo = uiHead - uiNum;
+
+        /* Last sample with stamp <= ullStamp */
+        uiBase = 0;
+        while (uiNum > 1) {
+            uiHalf = uiNum / 2;
+            if (pRing->pStamp[(uiLo + uiBase + uiHalf) & uiMask] <= ullStamp) uiBase += uiHalf;
+            uiNum -= uiHalf;
+        }
+
+        uiA = uiLo + uiBase;
+        uiB = uiA + 1;
+        ullA = pRing->pStamp[uiA & uiMask];
+        siRet = HIST_OK;
+
+        if (ullA > ullStamp) {
+            siRet = HIST_ERR_OLD;
+        } else if (uiB == uiHead) {
+            if (ullA == ullStamp) uiB = uiA;
+            else siRet = HIST_ERR_NEW;
+        }
+
+        if (siRet == HIST_OK) {
+            ullB = pRing->pStamp[uiB & uiMask];
+            memcpy(pA, pRing->pData + ((uiA & uiMask) * pRing->uiSize), pRing->uiSize);
+            memcpy(pB, pRing->pData + ((uiB & uiMask) * pRing->uiSize), pRing->uiSize);
+        }
+        SNAP_DMB();
+
+        /* Oldest slot read still intact -> result consistent */
+        if ((pRing->uiHead - uiLo) < (uiMask + 1)) {
+            if (siRet != HIST_OK) {
+                pRing->uiMiss++;
+                return siRet;
+            }
+            *pFrac = (ullB > ullA) ? ((float)(ullStamp - ullA) / (float)(ullB - ullA)) : 0.0f;
+            return HIST_OK;
+        }
+        pRing->uiRetry++;
+    }
+
+    return HIST_ERR_BUSY;
+}
+
+/**
+ * @brief Samples kept and their time span (statistics, not synchronised)
+ */
+UInt32 HistSpan(HistRing_t *pRing, UInt64 *pOldest, UInt64 *pNewest)
+{
+    UInt32 uiHead = pRing->uiHead;
+    UInt32 uiKeep = (pRing->uiMask + 1) - HIST_GUARD;
+    UInt32 uiNum = (uiHead < uiKeep) ? uiHead : uiKeep;
+
+    *pOldest = *pNewest = 0;
+    if (uiNum == 0) return 0;
+
+    *pOldest = pRing->pStamp[(uiHead - uiNum) & pRing->uiMask];
+    *pNewest = pRing->pStamp[(uiHead - 1) & pRing->uiMask];
+
+    return uiNum;
+}
+
+/*==============================================================================
+ * Timebase
+ *============================================================================*/
+
+/**
+ * @brief Current time on the history timebase (XTime counts)
+ */
+UInt64 HistNow(void)
+{
+    XTime xNow;
+
+    XTime_GetTime(&xNow);
+
+    return (UInt64)xNow;
+}
+
+/**
+ * @brief FreeRTOS tick to history time (resolution: one tick)
+ */
+UInt64 HistTickToStamp(UInt32 uiTick)
+{
+    UInt32 uiTickNow = (UInt32)xTaskGetTickCount();
+    UInt64 ullNow = HistNow();
+    SInt64 sllAge = (SInt64)(int)(uiTickNow - uiTick);
+
+    return ullNow - (UInt64)((sllAge * (SInt64)COUNTS_PER_SECOND) / configTICK_RATE_HZ);
+}
+
+/**
+ * @brief GPS time of week to history time (GPS time correlation)
+ * @return SInt32 HIST_OK, HIST_ERR_EMPTY before the first GPS fix
+ */
+SInt32 HistTowToStamp(UInt32 uiTowMs, UInt64 *pStamp)
+{
+    return (TimeSyncTowToStamp(uiTowMs, pStamp) == 0) ? HIST_OK : HIST_ERR_EMPTY;
+}
+
+/*==============================================================================
+ * Streams
+ *============================================================================*/
+
+/**
+ * @brief Record an IMU batch (imu_thread)
+ * @param ullStampLast Time of the last record; earlier records are spaced
+ *                     by the nominal sample period
+ */
+void HistImuPush(const ImuData_t *pImu, UInt32 uiCnt, UInt64 ullStampLast)
+{
+    UInt64 ullStamp;
+    UInt32 i;
+
+    for (i = 0; i < uiCnt; i++) {
+        ullStamp = ullStampLast - ((UInt64)(uiCnt - 1 - i) * HIST_IMU_PERIOD);
+
+        /* Batches delivered late overlap the previous one: keep the order */
+        if (ullStamp <= ullHistImuLast) ullStamp = ullHistImuLast + 1;
+
+        HistPush(&stHistImuRing, ullStamp, &pImu[i]);
+        ullHistImuLast = ullStamp;
+    }
+}
+
+void HistGpsPush(const GpsData_t *pGps, UInt64 ullStamp)
+{
+    HistPush(&stHistGpsRing, ullStamp, pGps);
+}
+
+void HistTpvawPush(const HistTpvaw_t *pTpvaw, UInt64 ullStamp)
+{
+    HistPush(&stHistTpvawRing, ullStamp, pTpvaw);
+}
+
+/**
+ * @brief IMU sample at ullStamp (linear, counter of the nearer sample)
+ */
+SInt32 HistImuAt(UInt64 ullStamp, ImuData_t *pImu)
+{
+    ImuData_t stA, stB;
+    float fT;
+    SInt32 siRet = HistFind(&stHistImuRing, ullStamp, &stA, &stB, &fT);
+
+    if (siRet != HIST_OK) return siRet;
+
+    pImu->fGyroX = stA.fGyroX + fT * (stB.fGyroX - stA.fGyroX);
+    pImu->fGyroY = stA.fGyroY + fT * (stB.fGyroY - stA.fGyroY);
+    pImu->fGyroZ = stA.fGyroZ + fT * (stB.fGyroZ - stA.fGyroZ);
+    pImu->fAccX = stA.fAccX + fT * (stB.fAccX - stA.fAccX);
+    pImu->fAccY = stA.fAccY + fT * (stB.fAccY - stA.fAccY);
+    pImu->fAccZ = stA.fAccZ + fT * (stB.fAccZ - stA.fAccZ);
+    pImu->fTemp = stA.fTemp + fT * (stB.fTemp - stA.fTemp);
+    pImu->ucCounter = (fT < 0.5f) ? stA.ucCounter : stB.ucCounter;
+
+    return HIST_OK;
+}
+
+/**
+ * @brief GPS fix at ullStamp (position / velocity / TOW linear, status of the earlier fix)
+ */
+SInt32 HistGpsAt(UInt64 ullStamp, GpsData_t *pGps)
+{
+    GpsData_t stA, stB;
+    float fT;
+    double dT;
+    SInt32 siRet = HistFind(&stHistGpsRing, ullStamp, &stA, &stB, &fT);
+
+    if (siRet != HIST_OK) return siRet;
+
+    dT = (double)fT;
+    *pGps = stA;
+    pGps->latitude = stA.latitude + dT * (stB.latitude - stA.latitude);
+    pGps->longitude = stA.longitude + dT * (stB.longitude - stA.longitude);
+    pGps->height = stA.height + dT * (stB.height - stA.height);
+    pGps->vn = stA.vn + fT * (stB.vn - stA.vn);
+    pGps->ve = stA.ve + fT * (stB.ve - stA.ve);
+    pGps->vu = stA.vu + fT * (stB.vu - stA.vu);
+    pGps->tow = stA.tow + (UInt32)(SInt32)(fT * (float)(SInt32)(stB.tow - stA.tow) + 0.5f);
+
+    return HIST_OK;
+}
+
+/**
+ * @brief TPVAW at ullStamp (position / velocity linear, attitude SLERP)
+ */
+SInt32 HistTpvawAt(UInt64 ullStamp, HistTpvaw_t *pTpvaw)
+{
+    HistTpvaw_t stA, stB;
+    float fT;
+    double dT;
+    UInt32 i;
+    SInt32 siRet = HistFind(&stHistTpvawRing, ullStamp, &stA, &stB, &fT);
+
+    if (siRet != HIST_OK) return siRet;
+
+    dT = (double)fT;
+    pTpvaw->dTime1 = stA.dTime1 + dT * (stB.dTime1 - stA.dTime1);
+    pTpvaw->dTime2 = stA.dTime2 + dT * (stB.dTime2 - stA.dTime2);
+    for (i = 0; i < 3; i++) {
+        pTpvaw->dPos[i] = stA.dPos[i] + dT * (stB.dPos[i] - stA.dPos[i]);
+        pTpvaw->dVel[i] = stA.dVel[i] + dT * (stB.dVel[i] - stA.dVel[i]);
+    }
+    QuatSlerp(stA.fQ, stB.fQ, fT, pTpvaw->fQ);
+
+    return HIST_OK;
+}
+
+/*==============================================================================
+ * Report / Benchmark
+ *============================================================================*/
+
+static void HistPrintRing(const char *pName, HistRing_t *pRing)
+{
+    UInt64 ullOldest, ullNewest;
+    UInt32 uiNum = HistSpan(pRing, &ullOldest, &ullNewest);
+    UInt64 ullNow = HistNow();
+
+    xil_printf("[HIST] %s: %u/%u samples, span %u ms, age %u ms, query %u (miss %u, retry %u), order err %u\r\n",
+        pName, uiNum, pRing->uiMask + 1,
+        (UInt32)(((ullNewest - ullOldest) * 1000ULL) / COUNTS_PER_SECOND),
+        ((uiNum != 0) && (ullNow > ullNewest)) ? (UInt32)(((ullNow - ullNewest) * 1000ULL) / COUNTS_PER_SECOND) : 0,
+        pRing->uiQuery, pRing->uiMiss, pRing->uiRetry, pRing->uiOrderErr);
+}
+
+/**
+ * @brief Ring occupancy and an interpolated query uiAgeMs in the past (DBG "hist [age ms]")
+ */
+void HistReport(UInt32 uiAgeMs)
+{
+    UInt64 ullQuery = HistNow() - (((UInt64)uiAgeMs * COUNTS_PER_SECOND) / 1000ULL);
+    ImuData_t stImu;
+    GpsData_t stGps;
+    HistTpvaw_t stTpvaw;
+    float fRoll, fPitch, fYaw;
+    SInt32 siRet;
+
+    HistPrintRing("IMU  ", &stHistImuRing);
+    HistPrintRing("GPS  ", &stHistGpsRing);
+    HistPrintRing("TPVAW", &stHistTpvawRing);
+
+    xil_printf("[HIST] now - %u ms:\r\n", uiAgeMs);
+
+    siRet = HistImuAt(ullQuery, &stImu);
+    xil_printf("  IMU   (%d) Gyro=", siRet);
+    if (siRet == HIST_OK) {
+        PrintFloat(stImu.fGyroX); xil_printf(",");
+        PrintFloat(stImu.fGyroY); xil_printf(",");
+        PrintFloat(stImu.fGyroZ); xil_printf(" Acc=");
+        PrintFloat(stImu.fAccX); xil_printf(",");
+        PrintFloat(stImu.fAccY); xil_printf(",");
+        PrintFloat(stImu.fAccZ);
+    }
+    xil_printf("\r\n");
+
+    siRet = HistGpsAt(ullQuery, &stGps);
+    xil_printf("  GPS   (%d) TOW=%u Lat=", siRet, (siRet == HIST_OK) ? stGps.tow : 0);
+    if (siRet == HIST_OK) {
+        PrintDouble(stGps.latitude); xil_printf(" Lon=");
+        PrintDouble(stGps.longitude); xil_printf(" H=");
+        PrintDouble(stGps.height);
+    }
+    xil_printf("\r\n");
+
+    siRet = HistTpvawAt(ullQuery, &stTpvaw);
+    xil_printf("  TPVAW (%d) Roll=", siRet);
+    if (siRet == HIST_OK) {
+        QuatToEuler(stTpvaw.fQ, &fRoll, &fPitch, &fYaw);
+        PrintFloat(fRoll); xil_printf(" Pitch=");
+        PrintFloat(fPitch); xil_printf(" Yaw=");
+        PrintFloat(fYaw);
+    }
+    xil_printf("\r\n");
+}
+
+/**
+ * @brief Time random queries on a full ring at IMU rate (DBG "hisbench <queries>")
+ *
+ * Sample i holds i at i * period with a little jitter; every query must
+ * land between sample k and k + 1 and interpolate back to its own time.
+ */
+void HistBenchmark(UInt32 uiQueries)
+{
+    HistRing_t stRing = HIST_RING_INIT(ullHistBenchStamp, uiHistBenchData, sizeof(u32), HIST_BENCH_DEPTH);
+    const UInt32 uiKeep = HIST_BENCH_DEPTH - HIST_GUARD;
+    UInt64 ullStamp = 0;
+    UInt64 ullQuery, ullNs;
+    UInt32 uiSeed = 12345;
+    UInt32 uiErr = 0;
+    UInt32 uiK, i;
+    u32 uiVal, uiA, uiB;
+    float fT;
+    XTime xStart, xEnd;
+
+    if (uiQueries == 0) uiQueries = 100000;
+
+    for (i = 0; i < HIST_BENCH_DEPTH; i++) {
+        ullStamp += HIST_IMU_PERIOD + (i & 7);
+        uiVal = (u32)i;
+        HistPush(&stRing, ullStamp, &uiVal);
+    }
+
+    XTime_GetTime(&xStart);
+    for (i = 0; i < uiQueries; i++) {
+        uiSeed = uiSeed * 1103515245U + 12345U;
+        uiK = (HIST_BENCH_DEPTH - uiKeep) + ((uiSeed >> 8) % (uiKeep - 1));
+        ullQuery = ullHistBenchStamp[uiK] + ((uiSeed & 0xFF) * (ullHistBenchStamp[uiK + 1] - ullHistBenchStamp[uiK])) / 256;
+
+        if ((HistFind(&stRing, ullQuery, &uiA, &uiB, &fT) != HIST_OK) || (uiA != uiK) || (uiB != uiK + 1)) {
+            uiErr++;
+        }
+    }
+    XTime_GetTime(&xEnd);
+
+    ullNs = ((UInt64)(xEnd - xStart) * 1000000000ULL) / COUNTS_PER_SECOND;
+
+    xil_printf("[HIST] %u queries on %u samples: %u ns/query, err %u -> %s\r\n",
+        uiQueries, uiKeep, (UInt32)(ullNs / uiQueries), uiErr, (uiErr == 0) ? "PASS" : "FAIL");
+}
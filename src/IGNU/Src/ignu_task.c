@@ -14,7 +14,17 @@
 #include "../Inc/ignu_task.h"
 #include "../Inc/TMTC.h"
 #include "../Inc/ins_gps.h"
+#include "../Inc/navfilter.h"
+#include "../Inc/history.h"
+#include "../Inc/timesync.h"
+#include "../Inc/tmsched.h"
+#include "../Inc/crc.h"
 #include "xil_printf.h"
+#include "xtime_l.h"
+
+#if ( configUSE_QUEUE_SETS != 1 )
+#error "IGNU pipeline needs configUSE_QUEUE_SETS = 1 (BSP: use_queue_sets)"
+#endif
 
 /*==============================================================================
  * Gloabal Variables
@@ -22,12 +32,43 @@
 QueueHandle_t xImuDataQueue = NULL;
 QueueHandle_t xGpsDataQueue = NULL;
 QueueHandle_t xCom1DataQueue = NULL;
+sBufPool stIgnuRbPool;
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+typedef struct {
+    UInt32 uiCnt;
+    UInt32 uiMinUs;
+    UInt32 uiMaxUs;
+    UInt64 ullSumUs;
+} IgnuLatency_t;
 
 /*==============================================================================
  * Local Variables
  *============================================================================*/
 static IgnuState_t eCurrentState = IGNU_STATE_IDLE;
 
+/* sRbData blocks passed by pointer through the IGNU queues */
+static UInt8 ucIgnuRbPoolMem[BUFPOOL_MEM_SIZE(sizeof(sRbData), IGNU_RB_POOL_CNT)] __attribute__((aligned(8)));
+
+/* IgnuTask blocks on all three queues at once */
+static QueueSetHandle_t xIgnuQueueSet = NULL;
+
+/* 64-bit stamp: written by uart_thread, taken by IgnuTask, both under taskENTER_CRITICAL */
+static XTime xCmdRxTime = 0;               // 0: no command pending
+static IgnuLatency_t stCmdLatency;
+
+/* Every STIM record of a forwarded IMU payload */
+static ImuData_t stIgnuImuBatch[IMU_BATCH_MAX];
+static ImuParseStat_t stIgnuImuStat;
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static void IgnuImuProcess(sRbData *pImuData);
+static void IgnuGpsProcess(sRbData *pGpsData);
+
 /*==============================================================================
  * Functions
  *============================================================================*/
@@ -38,20 +79,39 @@ static IgnuState_t eCurrentState = IGNU_STATE_IDLE;
  */
 void IgnuAppInit(void)
 {
-    /* Create IMU Data Queue (Reduced Size: 2 to save Heap) */
+    /* Buffer Pool for queued data (queues carry pointers only) */
+    if (stIgnuRbPool.pBase == NULL) {
+        BufPoolInit(&stIgnuRbPool, ucIgnuRbPoolMem, sizeof(ucIgnuRbPoolMem), sizeof(sRbData));
+    }
+
+    /* Create IMU Data Queue */
     if (xImuDataQueue == NULL) {
-        xImuDataQueue = xQueueCreate( 2, sizeof(sRbData) );
+        xImuDataQueue = xQueueCreate( IGNU_IMU_QUEUE_LEN, sizeof(sRbData *) );
     }
 
-    /* Create GPS Data Queue (Reduced Size: 2) */
+    /* Create GPS Data Queue */
     if (xGpsDataQueue == NULL) {
-        xGpsDataQueue = xQueueCreate( 2, sizeof(sRbData) );
+        xGpsDataQueue = xQueueCreate( IGNU_GPS_QUEUE_LEN, sizeof(sRbData *) );
     }
 
-    /* Create COM1 Data Queue (Reduced Size: 4) */
+    /* Create COM1 Data Queue */
     if (xCom1DataQueue == NULL) {
-        xCom1DataQueue = xQueueCreate( 4, sizeof(sRbData) );
+        xCom1DataQueue = xQueueCreate( IGNU_COM1_QUEUE_LEN, sizeof(sRbData *) );
     }
+
+    /* Queue Set (queues must still be empty when added) */
+    if (xIgnuQueueSet == NULL) {
+        xIgnuQueueSet = xQueueCreateSet( IGNU_IMU_QUEUE_LEN + IGNU_GPS_QUEUE_LEN + IGNU_COM1_QUEUE_LEN );
+        xQueueAddToSet( xCom1DataQueue, xIgnuQueueSet );
+        xQueueAddToSet( xImuDataQueue, xIgnuQueueSet );
+        xQueueAddToSet( xGpsDataQueue, xIgnuQueueSet );
+    }
+
+    /* CSP/CCSDS CRC Tables */
+    CrcInit();
+
+    /* PUS Telecommand Handlers */
+    TmtcInit();
     
     xil_printf("[IGNU] Queues Initialized.\r\n");
 }
@@ -67,15 +127,112 @@ IgnuState_t GetIgnuState(void)
     return eCurrentState;
 }
 
+/**
+ * @brief Take one sRbData block from the IGNU pool
+ * @return sRbData* Block, NULL if the pool is exhausted
+ */
+sRbData *IgnuRbAlloc(void)
+{
+    return (sRbData *)BufPoolAlloc(&stIgnuRbPool);
+}
+
+/**
+ * @brief Queue a pool block (non-blocking); the block is released if the queue is full
+ * @param xQueue xImuDataQueue / xGpsDataQueue / xCom1DataQueue
+ * @param pRbData Block from IgnuRbAlloc
+ * @return SInt32 0 on success, -1 if dropped
+ */
+SInt32 IgnuRbPost(QueueHandle_t xQueue, sRbData *pRbData)
+{
+    if ((xQueue == NULL) || (xQueueSend(xQueue, &pRbData, 0) != pdTRUE)) {
+        BufPoolRelease(&stIgnuRbPool, pRbData);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Print pool occupancy (DBG "pool")
+ */
+void IgnuPoolReport(void)
+{
+    sBufPoolStats stStats;
+
+    BufPoolGetStats(&stIgnuRbPool, &stStats);
+    xil_printf("[IGNU] Pool %u x %u B: used %u, high-water %u, alloc fail %u\r\n",
+        stStats.uiBlkCnt, (UInt32)sizeof(sRbData), stStats.uiUsed, stStats.uiHighWater, stStats.uiAllocFail);
+}
+
+/**
+ * @brief Stamp COM1 command arrival (uart_thread, before xCom1DataQueue)
+ */
+void IgnuCmdRxStamp(void)
+{
+    XTime xNow;
+
+    XTime_GetTime(&xNow);
+
+    taskENTER_CRITICAL();
+    if (xCmdRxTime == 0) xCmdRxTime = xNow;   // Otherwise previous command not answered yet
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Close the pending command: its response TM was committed to the COM1 TX ring
+ * (SendCcsdsTm, IgnuTask)
+ */
+void IgnuCmdAckStamp(void)
+{
+    XTime xNow, xRx;
+    UInt32 uiUs;
+
+    XTime_GetTime(&xNow);
+
+    taskENTER_CRITICAL();
+    xRx = xCmdRxTime;
+    xCmdRxTime = 0;
+    taskEXIT_CRITICAL();
+
+    if (xRx == 0) return;
+    uiUs = (UInt32)((xNow - xRx) / (COUNTS_PER_SECOND / 1000000));
+
+    taskENTER_CRITICAL();
+    if ((stCmdLatency.uiCnt == 0) || (uiUs < stCmdLatency.uiMinUs)) stCmdLatency.uiMinUs = uiUs;
+    if (uiUs > stCmdLatency.uiMaxUs) stCmdLatency.uiMaxUs = uiUs;
+    stCmdLatency.ullSumUs += uiUs;
+    stCmdLatency.uiCnt++;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Print and reset Command-to-Ack latency (DBG "lat")
+ */
+void IgnuLatencyReport(void)
+{
+    IgnuLatency_t stLat;
+
+    taskENTER_CRITICAL();
+    stLat = stCmdLatency;
+    memset(&stCmdLatency, 0, sizeof(stCmdLatency));
+    taskEXIT_CRITICAL();
+
+    if (stLat.uiCnt == 0) {
+        xil_printf("[IGNU] Cmd->Ack: no samples\r\n");
+        return;
+    }
+    xil_printf("[IGNU] Cmd->Ack (%u cmds) us: min %u avg %u max %u\r\n",
+        stLat.uiCnt, stLat.uiMinUs, (UInt32)(stLat.ullSumUs / stLat.uiCnt), stLat.uiMaxUs);
+}
+
 /**
  * @fn TxTask
- * @brief Periodic Telemetry Transmission Task (1Hz)
+ * @brief Periodic Telemetry Transmission Task (TM scheduler and segmented TM, TM_SCHED_TICK_MS)
  * @param pvParameters Task parameters
  * @return void
  */
 void TxTask( void *pvParameters )
 {
-    const TickType_t x1000ms = pdMS_TO_TICKS( 1000 ); // 1Hz
+    const TickType_t xTick = pdMS_TO_TICKS( TM_SCHED_TICK_MS );
     TickType_t xLastWakeTime;
 
     xil_printf("[IGNU] TxTask Started.\r\n");
@@ -85,12 +242,102 @@ void TxTask( void *pvParameters )
 
     while(1)
     {
-        /* Wait for 1 second */
-        vTaskDelayUntil( &xLastWakeTime, x1000ms );
+        vTaskDelayUntil( &xLastWakeTime, xTick );
+
+        /* Products due in this tick go out as one burst */
+        TmSchedTick( (eCurrentState == IGNU_STATE_RUN) ? 1 : 0 );
+
+        /* Then the running segmented TM transfer, as far as the COM1 ring takes it */
+        CcsdsTmSegPump();
+    }
+}
+
+/**
+ * @fn IgnuKissFrame
+ * @brief KISS Frame Handler (Pass to CSP Layer)
+ */
+static void IgnuKissFrame(UInt8 *pFrame, UInt32 uiLen, void *pArg)
+{
+    TickType_t xCurrentTick = xTaskGetTickCount();
+    xil_printf("[%u] [IGNU] KISS Frame Decoded (Len: %d)\r\n", xCurrentTick, uiLen);
+
+    CspReceive(pFrame, (SInt32)uiLen);
+}
+
+/**
+ * @fn IgnuImuProcess
+ * @brief Decode every IMU record of one payload and update the global IMU data
+ */
+static void IgnuImuProcess(sRbData *pImuData)
+{
+    UInt32 uiSyncErr = stIgnuImuStat.uiSyncErr;
+    UInt32 uiCntGap = stIgnuImuStat.uiCntGap;
+    UInt32 uiCnt;
+
+    /* Decimated payloads are not consecutive: check the counter within the payload only */
+    if (ImuGetDecimation() != 1) stIgnuImuStat.ucCntValid = 0;
+
+    uiCnt = ParseImuPayload(pImuData->ucData, pImuData->usSize, stIgnuImuBatch, IMU_BATCH_MAX, &stIgnuImuStat);
+
+    if ((stIgnuImuStat.uiSyncErr != uiSyncErr) || (stIgnuImuStat.uiCntGap != uiCntGap)) {
+        xil_printf("[IGNU] IMU payload %u B: %u ok, %u sync error, %u counter gap (Byte0: 0x%02X)\r\n",
+            pImuData->usSize, uiCnt, stIgnuImuStat.uiSyncErr - uiSyncErr,
+            stIgnuImuStat.uiCntGap - uiCntGap, pImuData->ucData[0]);
+    }
+
+    /* Update Global IMU Data (latest record) */
+    if (uiCnt > 0) {
+        SetImuData(&stIgnuImuBatch[uiCnt - 1]);
+    }
+}
+
+/**
+ * @fn IgnuGpsProcess
+ * @brief Parse one GPS record and update the global GPS data
+ */
+static void IgnuGpsProcess(sRbData *pGpsData)
+{
+    /* Extract 90 bytes (1 GPS Packet) from the received data */
+    /* Note: Assuming usSize holds the packet size */
+    if (pGpsData->usSize >= 90)
+    {
+        UInt8 ucGpsPacket[90];
+        memcpy(ucGpsPacket, pGpsData->ucData, 90);
+
+        GpsData_t stDecodedGps;
+        memset(&stDecodedGps, 0, sizeof(GpsData_t));
+        if (ParseGpsPacket(ucGpsPacket, &stDecodedGps) == 0)
+        {
+            if (stDecodedGps.mode == 0) {
+                stDecodedGps.latitude = 0;
+                stDecodedGps.longitude = 0;
+                stDecodedGps.height = 0;
+                stDecodedGps.vn = 0;
+                stDecodedGps.ve = 0;
+                stDecodedGps.vu = 0;
+                stDecodedGps.nrSv = 0;
+                stDecodedGps.hAccuracy = 0;
+                stDecodedGps.vAccuracy = 0;
+            }
+
+            /* Update Global GPS Data */
+            UInt64 ullRxStamp = HistNow();
+            SetGpsData(&stDecodedGps);
+            HistGpsPush(&stDecodedGps, ullRxStamp);
+            TimeSyncGpsPost(&stDecodedGps, ullRxStamp);
+            NavFilterGpsPost(&stDecodedGps);
 
-        /* Check State */
-        if (eCurrentState == IGNU_STATE_RUN) {
-            SendTestData();
+            TickType_t xCurrentTick = xTaskGetTickCount();
+
+            xil_printf("[%u] [GPS] TOW: %u Lat:", xCurrentTick, stDecodedGps.tow);
+            PrintDouble(stDecodedGps.latitude);
+            xil_printf(" Lon:");
+            PrintDouble(stDecodedGps.longitude);
+            xil_printf(" NrSV: %u\r\n", stDecodedGps.nrSv);
+        }
+        else
+        {
+            xil_printf("[IGNU] GPS Sync/Parse Error!\r\n");
         }
     }
 }
@@ -100,20 +347,18 @@ void TxTask( void *pvParameters )
  * @brief IGNU Processing Task (GPS, IMU, TM/TC Reception)
  * @param pvParameters Task parameters
  * @return void
+ *
+ * Blocks on the queue set until uart_thread / gps_thread / imu_thread post
+ * data, so a command is handled as soon as it is queued.
  */
 void IgnuTask( void *pvParameters )
 {
-    const TickType_t x10ms = pdMS_TO_TICKS( DELAY_10_MSECOND );
-    sRbData stImuData; // Buffer for received IMU data
-    sRbData stGpsData; // Buffer for received GPS data
-    sRbData stCom1Data; // Buffer for received Com1 data
-
-    /* Static buffer for decoded packet to save stack size */
-    static UInt8 ucDecodedPacket[MAX_KISS_BUF]; 
+    QueueSetMemberHandle_t xActive;
+    sRbData *pRxData; // Pool block from COM1 / IMU / GPS queue
 
     /* Note: Queues are now initialized in IgnuAppInit() called from main */
     /* Safety check in case Init wasn't called */
-    if (xImuDataQueue == NULL || xGpsDataQueue == NULL || xCom1DataQueue == NULL) {
+    if (xIgnuQueueSet == NULL) {
         IgnuAppInit();
     }
 
@@ -121,166 +366,23 @@ void IgnuTask( void *pvParameters )
 
     while(1)
     {
-        /* 1. Receive COM1 Data (Queue) - Always process Commands */
-        if( xCom1DataQueue != NULL )
+        xActive = xQueueSelectFromSet( xIgnuQueueSet, portMAX_DELAY );
+
+        /* Exactly one item is taken per selection */
+        if( (xActive == NULL) || (xQueueReceive( (QueueHandle_t)xActive, &pRxData, 0 ) != pdTRUE) ) continue;
+
+        if( xActive == (QueueSetMemberHandle_t)xCom1DataQueue )
         {
-            /* Receive data from queue (Wait time 0 = Non-blocking) */
-            if( xQueueReceive( xCom1DataQueue, &stCom1Data, 0 ) == pdTRUE )
-            {
-                /* Debug: Print Raw Data size */
-                /*
-                xil_printf("[IGNU] Raw Com1 (%d): ", stCom1Data.usSize);
-                for(int i=0; i<stCom1Data.usSize; i++)
-                {
-                    xil_printf("%02X ", stCom1Data.ucData[i]);
-                }
-                xil_printf("\r\n");
-                */
-                
-                /* Process received Com1 data via KISS Decoder */
-                SInt32 siDecodedLen;
-                for(int i=0; i<stCom1Data.usSize; i++)
-                {
-                    /* Feed byte into state machine */
-                    siDecodedLen = KissDecode(stCom1Data.ucData[i], ucDecodedPacket);
-                    
-                    /* If a packet is completed */
-                    if( siDecodedLen > 0 )
-                    {
-                        TickType_t xCurrentTick = xTaskGetTickCount();
-                        xil_printf("[%u] [IGNU] KISS Frame Decoded (Len: %d)\r\n", xCurrentTick, siDecodedLen);
-                        
-                        /* Pass to CSP Layer */
-                        CspReceive(ucDecodedPacket, siDecodedLen);
-                    }
-                }
-            }
+            /* 1. COM1 Data - Always process Commands (all KISS frames in the block) */
+            KissDecodeBlock(pRxData->ucData, pRxData->usSize, IgnuKissFrame, NULL);
         }
-
-        /* 2. State Machine */
-        switch (eCurrentState)
+        else if( eCurrentState == IGNU_STATE_RUN )
         {
-        case IGNU_STATE_IDLE:
-            /* Idle State: Drain Sensor Queues but don't process/send */
-            if( xImuDataQueue != NULL ) xQueueReceive( xImuDataQueue, &stImuData, 0 );
-            if( xGpsDataQueue != NULL ) xQueueReceive( xGpsDataQueue, &stGpsData, 0 );
-            break;
-
-        case IGNU_STATE_RUN:
-            /* Run State: Process Sensor Data */
-            
-            /* Receive IMU Data (Queue) */
-            if( xImuDataQueue != NULL )
-            {
-                /* Receive data from queue (Wait time 0 = Non-blocking) */
-                if( xQueueReceive( xImuDataQueue, &stImuData, 0 ) == pdTRUE )
-                {
-                    /* Extract 42 bytes (1 IMU Packet) from the received data */
-                    if (stImuData.usSize >= 42)
-                    {
-                        UInt8 ucImuPacket[42];
-                        memcpy(ucImuPacket, stImuData.ucData, 42);
-
-                        /* Check Identifier (Fixed: 0xA5) */
-                        if (ucImuPacket[0] != 0xA5) {
-                            xil_printf("[IGNU] IMU Sync Error! Byte0: 0x%02X (Expected 0xA5)\r\n", ucImuPacket[0]);
-                        }
-                        else {
-                            ImuData_t stDecodedImu;
-                            ProcessImuPacket(ucImuPacket, &stDecodedImu);
-                            
-                            /* Update Global IMU Data */
-                            SetImuData(&stDecodedImu);
-
-                            /* Debug Log Reduced */
-                            /*
-                            TickType_t xCurrentTick = xTaskGetTickCount();
-                            xil_printf("[%u] [IMU] Acc(g): X=", xCurrentTick);
-                            PrintFloat(stDecodedImu.fAccX);
-                            xil_printf(" Y=");
-                            PrintFloat(stDecodedImu.fAccY);
-                            xil_printf(" Z=");
-                            PrintFloat(stDecodedImu.fAccZ);
-                            
-                            xil_printf(" | Gyro(dps): X=");
-                            PrintFloat(stDecodedImu.fGyroX);
-                            xil_printf(" Y=");
-                            PrintFloat(stDecodedImu.fGyroY);
-                            xil_printf(" Z=");
-                            PrintFloat(stDecodedImu.fGyroZ);
-                            xil_printf("\r\n");
-                            */
-                        }
-                    }
-                }
-            }
-
-            /* Receive GPS Data (Queue) */
-            if( xGpsDataQueue != NULL )
-            {
-                /* Receive data from queue (Wait time 0 = Non-blocking) */
-                if( xQueueReceive( xGpsDataQueue, &stGpsData, 0 ) == pdTRUE )
-                {
-                    /* Extract 90 bytes (1 GPS Packet) from the received data */
-                    /* Note: Assuming stGpsData.usSize holds the packet size */
-                    if (stGpsData.usSize >= 90)
-                    {
-                        UInt8 ucGpsPacket[90];
-                        memcpy(ucGpsPacket, stGpsData.ucData, 90);
-                        
-                        GpsData_t stDecodedGps;
-                        memset(&stDecodedGps, 0, sizeof(GpsData_t));
-                        if (ParseGpsPacket(ucGpsPacket, &stDecodedGps) == 0)
-                        {
-                            if (stDecodedGps.mode == 0) {
-                                stDecodedGps.latitude = 0;
-                                stDecodedGps.longitude = 0;
-                                stDecodedGps.height = 0;
-                                stDecodedGps.vn = 0;
-                                stDecodedGps.ve = 0;
-                                stDecodedGps.vu = 0;
-                                stDecodedGps.nrSv = 0;
-                                stDecodedGps.hAccuracy = 0;
-                                stDecodedGps.vAccuracy = 0;                                                                
-                            }
-
-                            /* Update Global GPS Data */
-                            SetGpsData(&stDecodedGps);
-
-                            TickType_t xCurrentTick = xTaskGetTickCount();
-                            
-                            /* Debug: Print Raw Hex for Lat/Lon to verify data */
-                            /*
-                            xil_printf("[%u] [GPS Raw] Lat: %02X %02X %02X %02X %02X %02X %02X %02X\r\n", 
-                                xCurrentTick,
-                                ucGpsPacket[10], ucGpsPacket[11], ucGpsPacket[12], ucGpsPacket[13],
-                                ucGpsPacket[14], ucGpsPacket[15], ucGpsPacket[16], ucGpsPacket[17]);
-                            */
-
-                            /* Debug: Dump Full Packet (Offset 0-89) for thorough check */
-                            /*
-                            xil_printf("[GPS Dump] Sync:%02X%02X TOW:%02X%02X%02X%02X Mode:%02X Err:%02X\r\n",
-                                ucGpsPacket[0], ucGpsPacket[1], 
-                                ucGpsPacket[2], ucGpsPacket[3], ucGpsPacket[4], ucGpsPacket[5],
-                                ucGpsPacket[8], ucGpsPacket[9]);
-                            */
-
-                            xil_printf("[%u] [GPS] TOW: %u Lat:", xCurrentTick, stDecodedGps.tow);
-                            PrintDouble(stDecodedGps.latitude);
-                            xil_printf(" Lon:");
-                            PrintDouble(stDecodedGps.longitude);
-                            xil_printf(" NrSV: %u\r\n", stDecodedGps.nrSv);
-                        }
-                        else
-                        {
-                            xil_printf("[IGNU] GPS Sync/Parse Error!\r\n");
-                        }
-                    }
-                }
-            }
-            break;
+            /* 2. Sensor Data: Run State processes, Idle State only drains */
+            if( xActive == (QueueSetMemberHandle_t)xImuDataQueue ) IgnuImuProcess(pRxData);
+            else IgnuGpsProcess(pRxData);
         }
 
-        vTaskDelay( x10ms );
+        BufPoolRelease(&stIgnuRbPool, pRxData);
     }
 }
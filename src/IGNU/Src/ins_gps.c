@@ -9,14 +9,38 @@
  * Include Files
  *============================================================================*/
 #include "../Inc/ins_gps.h"
+#include "task.h"
 #include "xil_printf.h"
+#include "xtime_l.h"
+
+#if IMU_UNPACK_NEON
+#include <arm_neon.h>
+#endif
 
 /*==============================================================================
  * Local Variables
  *============================================================================*/
-static ImuData_t stGlobalImuData;
-static GpsData_t stGlobalGpsData;
-static UInt32 uiLastImuUpdateTick = 0; /* Timestamp of last IMU update */
+/* Latest IMU / GPS (written by IgnuTask, read by TxTask / HK without locking) */
+static UInt8 ucImuSnapMem[SNAP_STORE_MEM(sizeof(ImuData_t))] __attribute__((aligned(8)));
+static UInt8 ucGpsSnapMem[SNAP_STORE_MEM(sizeof(GpsData_t))] __attribute__((aligned(8)));
+static sSnapStore stImuSnap = SNAP_STORE_INIT(ucImuSnapMem, sizeof(ImuData_t));
+static sSnapStore stGpsSnap = SNAP_STORE_INIT(ucGpsSnapMem, sizeof(GpsData_t));
+
+/* Full-rate IMU (imu_thread accumulates, TxTask takes the mean) */
+static ImuAccum_t stImuAccum;
+static ImuParseStat_t stImuRateStat;    // Written by imu_thread only
+static volatile UInt32 uiImuDecim = IMU_DECIM_DEFAULT;
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static SInt32 ImuRaw24(const UInt8 *pRaw);
+static void ImuUnpackAxes(const UInt8 *pRec, SInt32 *pAxis);
+static UInt32 ImuCheckRecord(ImuParseStat_t *pStat, const UInt8 *pRec);
+static void ImuDecodeRecord(const UInt8 *pRec, ImuData_t *pOutput);
+static UInt32 ImuAccumRecords(ImuAccum_t *pAcc, ImuParseStat_t *pStat, const UInt8 *pData, UInt32 uiLen,
+                              ImuData_t *pOutput, UInt32 uiMaxOut);
+static UInt32 ImuAccumMean(const ImuAccum_t *pAccum, ImuData_t *pMean);
 
 /*==============================================================================
  * Functions
@@ -25,53 +49,511 @@ static UInt32 uiLastImuUpdateTick = 0; /* Timestamp of last IMU update */
 void SetImuData(ImuData_t *pData)
 {
     if (pData) {
-        memcpy(&stGlobalImuData, pData, sizeof(ImuData_t));
-        uiLastImuUpdateTick = xTaskGetTickCount(); /* Update Timestamp */
+        SnapStoreWrite(&stImuSnap, pData);
     }
 }
 
 void GetImuData(ImuData_t *pData)
 {
-    if (pData) {
-        memcpy(pData, &stGlobalImuData, sizeof(ImuData_t));
-    }
+    GetImuSnapshot(pData, NULL);
+}
+
+/**
+ * @brief Consistent copy of the latest IMU data (zero before the first update)
+ * @return SInt32 -1 if never updated, otherwise reader retries
+ */
+SInt32 GetImuSnapshot(ImuData_t *pData, sSnapInfo *pInfo)
+{
+    SInt32 siRet;
+
+    if (pData == NULL) return -1;
+
+    siRet = SnapStoreRead(&stImuSnap, pData, pInfo);
+    if (siRet < 0) memset(pData, 0, sizeof(ImuData_t));
+
+    return siRet;
 }
 
 UInt32 GetImuLastTick(void)
 {
-    return uiLastImuUpdateTick;
+    sSnapInfo stInfo;
+
+    /* Tick of the last SetImuData (0: never) */
+    if (SnapStoreRead(&stImuSnap, NULL, &stInfo) < 0) return 0;
+
+    return stInfo.uiTick;
 }
 
 void SetGpsData(GpsData_t *pData)
 {
     if (pData) {
-        memcpy(&stGlobalGpsData, pData, sizeof(GpsData_t));
+        SnapStoreWrite(&stGpsSnap, pData);
     }
 }
 
 void GetGpsData(GpsData_t *pData)
 {
-    if (pData) {
-        memcpy(pData, &stGlobalGpsData, sizeof(GpsData_t));
+    GetGpsSnapshot(pData, NULL);
+}
+
+/**
+ * @brief Consistent copy of the latest GPS data (zero before the first update)
+ * @return SInt32 -1 if never updated, otherwise reader retries
+ */
+SInt32 GetGpsSnapshot(GpsData_t *pData, sSnapInfo *pInfo)
+{
+    SInt32 siRet;
+
+    if (pData == NULL) return -1;
+
+    siRet = SnapStoreRead(&stGpsSnap, pData, pInfo);
+    if (siRet < 0) memset(pData, 0, sizeof(GpsData_t));
+
+    return siRet;
+}
+
+/**
+ * @brief Sequence / age / reader retries of the latest-value stores (DBG "snap")
+ */
+void ImuGpsSnapReport(void)
+{
+    sSnapInfo stImu, stGps;
+    UInt32 uiNow = (UInt32)xTaskGetTickCount();
+    SInt32 siImu = SnapStoreRead(&stImuSnap, NULL, &stImu);
+    SInt32 siGps = SnapStoreRead(&stGpsSnap, NULL, &stGps);
+
+    xil_printf("[SNAP] IMU seq %u age %u ms retry %u | GPS seq %u age %u ms retry %u\r\n",
+        (siImu < 0) ? 0 : stImu.uiSeq, (siImu < 0) ? 0 : (UInt32)((uiNow - stImu.uiTick) * portTICK_PERIOD_MS), stImuSnap.uiRetry,
+        (siGps < 0) ? 0 : stGps.uiSeq, (siGps < 0) ? 0 : (UInt32)((uiNow - stGps.uiTick) * portTICK_PERIOD_MS), stGpsSnap.uiRetry);
+}
+
+/**
+ * @brief 3-byte Big Endian 24-bit Signed Integer (branch-free sign extension)
+ */
+static SInt32 ImuRaw24(const UInt8 *pRaw)
+{
+    UInt32 uiRaw = ((UInt32)pRaw[0] << 16) | ((UInt32)pRaw[1] << 8) | pRaw[2];
+
+    return (SInt32)(uiRaw ^ 0x800000U) - 0x800000;
+}
+
+/**
+ * @brief Unpack all six axes of one record in a single pass
+ * pAxis[0..2]: Gyro (Offset 1, 4, 7), pAxis[3..5]: Accel (Offset 11, 14, 17)
+ */
+static void ImuUnpackAxes(const UInt8 *pRec, SInt32 *pAxis)
+{
+    pAxis[0] = ImuRaw24(&pRec[1]);
+    pAxis[1] = ImuRaw24(&pRec[4]);
+    pAxis[2] = ImuRaw24(&pRec[7]);
+    pAxis[3] = ImuRaw24(&pRec[11]);
+    pAxis[4] = ImuRaw24(&pRec[14]);
+    pAxis[5] = ImuRaw24(&pRec[17]);
+}
+
+/**
+ * @brief Sync byte and counter continuity of one record
+ * @return UInt32 1: record usable, 0: sync error (counter check untouched)
+ */
+static UInt32 ImuCheckRecord(ImuParseStat_t *pStat, const UInt8 *pRec)
+{
+    UInt8 ucGap;
+
+    if (pRec[0] != IMU_SYNC_BYTE) {
+        pStat->uiSyncErr++;
+        return 0;
     }
+
+    /* Counter wraps at 256; a gap of N means N records never reached the PS */
+    ucGap = (UInt8)(pRec[IMU_COUNTER_OFFSET] - pStat->ucNextCnt);
+    pStat->uiCntGap += (UInt32)(ucGap != 0) & pStat->ucCntValid;
+    pStat->uiCntLost += (UInt32)ucGap * pStat->ucCntValid;
+    pStat->ucNextCnt = (UInt8)(pRec[IMU_COUNTER_OFFSET] + 1);
+    pStat->ucCntValid = 1;
+    pStat->uiRecords++;
+
+    return 1;
 }
 
+#if IMU_UNPACK_NEON
 /**
- * @brief Convert 3-byte Big Endian 24-bit Signed Integer to Float
+ * @brief Unpack uiRecords records x 6 channels to float (NEON)
+ *
+ * 24 bytes from record offset 1 are used as a vtbl table. Each 32-bit lane
+ * is built as [0, b2, b1, b0] (little endian), i.e. raw24 << 8, so an
+ * arithmetic shift by 8 sign-extends; index 0xFF yields the zero byte.
  */
-float ConvertRaw24(UInt8 *pRaw, float fScale)
+void ImuUnpackBatch(const UInt8 *pData, UInt32 uiRecords, float *pOut)
 {
-    /* 1. Combine 3 Bytes (Big Endian) into 32-bit Integer */
-    /* pRaw[0]: MSB, pRaw[2]: LSB */
-    SInt32 raw24 = (pRaw[0] << 16) | (pRaw[1] << 8) | pRaw[2];
-    
-    /* 2. Sign Extension: 24-bit to 32-bit */
-    if (raw24 & 0x800000) {
-        raw24 |= 0xFF000000;
+    static const UInt8 ucIdxGxy[8] = { 0xFF, 2, 1, 0, 0xFF, 5, 4, 3 };
+    static const UInt8 ucIdxGzAx[8] = { 0xFF, 8, 7, 6, 0xFF, 12, 11, 10 };
+    static const UInt8 ucIdxAyz[8] = { 0xFF, 15, 14, 13, 0xFF, 18, 17, 16 };
+    const float32x4_t vScaleLo = { 1.0f / GYRO_SCALE_FACTOR, 1.0f / GYRO_SCALE_FACTOR,
+                                   1.0f / GYRO_SCALE_FACTOR, 1.0f / ACCEL_SCALE_FACTOR };
+    const float32x2_t vScaleHi = vdup_n_f32(1.0f / ACCEL_SCALE_FACTOR);
+    const uint8x8_t vIdx0 = vld1_u8(ucIdxGxy);
+    const uint8x8_t vIdx1 = vld1_u8(ucIdxGzAx);
+    const uint8x8_t vIdx2 = vld1_u8(ucIdxAyz);
+    uint8x8x3_t vTbl;
+    int32x4_t vLo;
+    int32x2_t vHi;
+    UInt32 i;
+
+    for (i = 0; i < uiRecords; i++, pData += IMU_PACKET_SIZE, pOut += IMU_AXES) {
+        vTbl.val[0] = vld1_u8(&pData[1]);
+        vTbl.val[1] = vld1_u8(&pData[9]);
+        vTbl.val[2] = vld1_u8(&pData[17]);
+
+        /* Gyro X/Y/Z + Accel X | Accel Y/Z */
+        vLo = vcombine_s32(vreinterpret_s32_u8(vtbl3_u8(vTbl, vIdx0)),
+                           vreinterpret_s32_u8(vtbl3_u8(vTbl, vIdx1)));
+        vHi = vreinterpret_s32_u8(vtbl3_u8(vTbl, vIdx2));
+
+        vst1q_f32(&pOut[0], vmulq_f32(vcvtq_f32_s32(vshrq_n_s32(vLo, 8)), vScaleLo));
+        vst1_f32(&pOut[4], vmul_f32(vcvt_f32_s32(vshr_n_s32(vHi, 8)), vScaleHi));
+    }
+}
+#else
+/**
+ * @brief Unpack uiRecords records x 6 channels to float (portable)
+ * @param pData Records (IMU_PACKET_SIZE each, sync not checked)
+ * @param uiRecords Number of Records
+ * @param pOut uiRecords x IMU_AXES floats: Gyro X/Y/Z (deg/s), Accel X/Y/Z (g)
+ */
+void ImuUnpackBatch(const UInt8 *pData, UInt32 uiRecords, float *pOut)
+{
+    SInt32 siAxis[IMU_AXES];
+    UInt32 i;
+
+    for (i = 0; i < uiRecords; i++, pData += IMU_PACKET_SIZE, pOut += IMU_AXES) {
+        ImuUnpackAxes(pData, siAxis);
+
+        pOut[0] = (float)siAxis[0] * (1.0f / GYRO_SCALE_FACTOR);
+        pOut[1] = (float)siAxis[1] * (1.0f / GYRO_SCALE_FACTOR);
+        pOut[2] = (float)siAxis[2] * (1.0f / GYRO_SCALE_FACTOR);
+        pOut[3] = (float)siAxis[3] * (1.0f / ACCEL_SCALE_FACTOR);
+        pOut[4] = (float)siAxis[4] * (1.0f / ACCEL_SCALE_FACTOR);
+        pOut[5] = (float)siAxis[5] * (1.0f / ACCEL_SCALE_FACTOR);
     }
+}
+#endif
+
+/**
+ * @brief Decode one record (sync already checked)
+ */
+static void ImuDecodeRecord(const UInt8 *pRec, ImuData_t *pOutput)
+{
+    float fAxis[IMU_AXES];
 
-    /* 3. Apply Scale Factor */
-    return (float)raw24 / fScale;
+    ImuUnpackBatch(pRec, 1, fAxis);
+
+    pOutput->fGyroX = fAxis[0];
+    pOutput->fGyroY = fAxis[1];
+    pOutput->fGyroZ = fAxis[2];
+    pOutput->fAccX = fAxis[3];
+    pOutput->fAccY = fAxis[4];
+    pOutput->fAccZ = fAxis[5];
+
+    /* Temperature (Offset 21, 22), Counter (Offset 35) */
+    pOutput->fTemp = GetImuGyroTempX(pRec);
+    pOutput->ucCounter = pRec[IMU_COUNTER_OFFSET];
+}
+
+/**
+ * @brief Add every 42-byte record of a payload to the raw sums
+ * @return UInt32 Records also decoded to pOutput (NULL: sums only)
+ */
+static UInt32 ImuAccumRecords(ImuAccum_t *pAcc, ImuParseStat_t *pStat, const UInt8 *pData, UInt32 uiLen,
+                              ImuData_t *pOutput, UInt32 uiMaxOut)
+{
+    const UInt8 *pEnd = pData + uiLen;
+    SInt32 siAxis[IMU_AXES];
+    UInt32 uiOut = 0;
+
+    for (; (pData + IMU_PACKET_SIZE) <= pEnd; pData += IMU_PACKET_SIZE) {
+        if (ImuCheckRecord(pStat, pData) == 0) {
+            pAcc->uiSyncErr++;
+            continue;
+        }
+
+        ImuUnpackAxes(pData, siAxis);
+        pAcc->sllSumGyro[0] += siAxis[0];
+        pAcc->sllSumGyro[1] += siAxis[1];
+        pAcc->sllSumGyro[2] += siAxis[2];
+        pAcc->sllSumAcc[0] += siAxis[3];
+        pAcc->sllSumAcc[1] += siAxis[4];
+        pAcc->sllSumAcc[2] += siAxis[5];
+        pAcc->uiCnt++;
+
+        if ((pOutput != NULL) && (uiOut < uiMaxOut)) {
+            ImuDecodeRecord(pData, &pOutput[uiOut]);
+            uiOut++;
+        }
+    }
+    if (pData != pEnd) pStat->uiTrailing++;
+
+    return uiOut;
+}
+
+/**
+ * @brief Decode every STIM record of one slot payload
+ * @param pData Payload (records back to back, IMU_PACKET_SIZE each)
+ * @param uiLen Payload Length
+ * @param pOutput Decoded records (sync errors are skipped, not stored)
+ * @param uiMaxOut Capacity of pOutput (IMU_BATCH_MAX covers any sRbData)
+ * @param pStat Running statistics / counter check of this stream
+ * @return UInt32 Number of records written to pOutput
+ */
+UInt32 ParseImuPayload(const UInt8 *pData, UInt32 uiLen, ImuData_t *pOutput, UInt32 uiMaxOut, ImuParseStat_t *pStat)
+{
+    const UInt8 *pEnd;
+    UInt32 uiOut = 0;
+
+    if ((pData == NULL) || (pOutput == NULL) || (pStat == NULL)) return 0;
+
+    pEnd = pData + uiLen;
+    for (; ((pData + IMU_PACKET_SIZE) <= pEnd) && (uiOut < uiMaxOut); pData += IMU_PACKET_SIZE) {
+        if (ImuCheckRecord(pStat, pData) == 0) continue;
+
+        ImuDecodeRecord(pData, &pOutput[uiOut]);
+        uiOut++;
+    }
+    if (pData != pEnd) pStat->uiTrailing++;
+
+    return uiOut;
+}
+
+/**
+ * @brief Accumulate one STIM payload at sensor rate (imu_thread, every packet)
+ * @param pData Payload
+ * @param uiLen Payload Length
+ * @param pOutput Decoded records for the full-rate consumers (NULL: none)
+ * @param uiMaxOut Capacity of pOutput
+ * @return UInt32 Number of records written to pOutput
+ */
+UInt32 ImuAccumulate(const UInt8 *pData, UInt32 uiLen, ImuData_t *pOutput, UInt32 uiMaxOut)
+{
+    ImuAccum_t stAdd;
+    UInt32 uiOut;
+
+    if (pData == NULL) return 0;
+
+    /* Decode outside the critical section, merge inside */
+    memset(&stAdd, 0, sizeof(stAdd));
+    uiOut = ImuAccumRecords(&stAdd, &stImuRateStat, pData, uiLen, pOutput, uiMaxOut);
+
+    taskENTER_CRITICAL();
+    stImuAccum.sllSumGyro[0] += stAdd.sllSumGyro[0];
+    stImuAccum.sllSumGyro[1] += stAdd.sllSumGyro[1];
+    stImuAccum.sllSumGyro[2] += stAdd.sllSumGyro[2];
+    stImuAccum.sllSumAcc[0] += stAdd.sllSumAcc[0];
+    stImuAccum.sllSumAcc[1] += stAdd.sllSumAcc[1];
+    stImuAccum.sllSumAcc[2] += stAdd.sllSumAcc[2];
+    stImuAccum.uiCnt += stAdd.uiCnt;
+    stImuAccum.uiSyncErr += stAdd.uiSyncErr;
+    taskEXIT_CRITICAL();
+
+    return uiOut;
+}
+
+/**
+ * @brief Mean of an accumulated interval
+ * @return UInt32 Number of records; pMean untouched if none
+ */
+static UInt32 ImuAccumMean(const ImuAccum_t *pAccum, ImuData_t *pMean)
+{
+    UInt32 i;
+    float fGyro[3], fAcc[3];
+
+    if ((pAccum->uiCnt == 0) || (pMean == NULL)) return pAccum->uiCnt;
+
+    for (i = 0; i < 3; i++) {
+        fGyro[i] = (float)((double)pAccum->sllSumGyro[i] / pAccum->uiCnt) / GYRO_SCALE_FACTOR;
+        fAcc[i] = (float)((double)pAccum->sllSumAcc[i] / pAccum->uiCnt) / ACCEL_SCALE_FACTOR;
+    }
+    pMean->fGyroX = fGyro[0];
+    pMean->fGyroY = fGyro[1];
+    pMean->fGyroZ = fGyro[2];
+    pMean->fAccX = fAcc[0];
+    pMean->fAccY = fAcc[1];
+    pMean->fAccZ = fAcc[2];
+
+    return pAccum->uiCnt;
+}
+
+/**
+ * @brief Mean since the previous call, then restart the interval (TM scheduler, TxTask only)
+ * @param pMean Mean Gyro (deg/s) / Accel (g); untouched if no samples
+ * @return UInt32 Number of records in the interval
+ */
+UInt32 ImuTakeMean(ImuData_t *pMean)
+{
+    ImuAccum_t stSnap;
+
+    taskENTER_CRITICAL();
+    stSnap = stImuAccum;
+    memset(&stImuAccum, 0, sizeof(stImuAccum));
+    taskEXIT_CRITICAL();
+
+    return ImuAccumMean(&stSnap, pMean);
+}
+
+/**
+ * @brief Mean of the running interval, without restarting it (on-request TM)
+ * @param pMean Mean Gyro (deg/s) / Accel (g); untouched if no samples
+ * @return UInt32 Number of records so far in the interval
+ */
+UInt32 ImuPeekMean(ImuData_t *pMean)
+{
+    ImuAccum_t stSnap;
+
+    taskENTER_CRITICAL();
+    stSnap = stImuAccum;
+    taskEXIT_CRITICAL();
+
+    return ImuAccumMean(&stSnap, pMean);
+}
+
+/**
+ * @brief Forward every uiRatio-th IMU packet to IgnuTask (latest-sample path)
+ */
+void ImuSetDecimation(UInt32 uiRatio)
+{
+    uiImuDecim = (uiRatio == 0) ? 1 : uiRatio;
+}
+
+UInt32 ImuGetDecimation(void)
+{
+    return uiImuDecim;
+}
+
+/**
+ * @brief Parse statistics of the full-rate (every packet) IMU stream
+ */
+void ImuGetRateStats(ImuParseStat_t *pStat)
+{
+    if (pStat) {
+        taskENTER_CRITICAL();
+        memcpy(pStat, &stImuRateStat, sizeof(ImuParseStat_t));
+        taskEXIT_CRITICAL();
+    }
+}
+
+/**
+ * @brief Time the full-rate path and report its CPU share at IMU_RATE_HZ
+ * (DBG shell "imubench <records>")
+ */
+void ImuAccumBenchmark(UInt32 uiRecords)
+{
+    static UInt8 ucRec[IMU_PACKET_SIZE];
+    ImuAccum_t stAcc;
+    ImuParseStat_t stStat;
+    XTime xStart, xEnd;
+    UInt64 ullNs;
+    UInt32 i;
+
+    if (uiRecords == 0) uiRecords = IMU_RATE_HZ;
+
+    /* One synthetic record: Gyro 1.0 deg/s, Accel -1.0 g on every axis */
+    memset(ucRec, 0, sizeof(ucRec));
+    ucRec[0] = IMU_SYNC_BYTE;
+    for (i = 0; i < 3; i++) {
+        ucRec[1 + (i * 3)] = 0x08;                                                          // +524288
+        ucRec[11 + (i * 3)] = 0xF8;                                                         // -524288
+    }
+
+    memset(&stAcc, 0, sizeof(stAcc));
+    memset(&stStat, 0, sizeof(stStat));
+    XTime_GetTime(&xStart);
+    for (i = 0; i < uiRecords; i++) {
+        ucRec[IMU_COUNTER_OFFSET] = (UInt8)i;
+        ImuAccumRecords(&stAcc, &stStat, ucRec, IMU_PACKET_SIZE, NULL, 0);
+    }
+    XTime_GetTime(&xEnd);
+
+    ullNs = ((UInt64)(xEnd - xStart) * 1000000000ULL) / COUNTS_PER_SECOND;
+
+    xil_printf("[IMU] %u records: %u ns/record, %u.%03u %% CPU at %u Hz, mean gyro %d acc %d -> %s\r\n",
+        uiRecords, (UInt32)(ullNs / uiRecords),
+        (UInt32)((ullNs * IMU_RATE_HZ / uiRecords) / 10000000ULL),
+        (UInt32)(((ullNs * IMU_RATE_HZ / uiRecords) / 10000ULL) % 1000ULL), IMU_RATE_HZ,
+        (int)(stAcc.sllSumGyro[0] / (SInt64)uiRecords), (int)(stAcc.sllSumAcc[0] / (SInt64)uiRecords),
+        ((stAcc.uiCnt == uiRecords) && (stStat.uiCntGap == 0) && (stAcc.sllSumGyro[0] == (SInt64)uiRecords * 524288)) ? "OK" : "MISMATCH");
+}
+
+/**
+ * @brief ImuUnpackBatch vs. per-axis ConvertRaw24 (DBG shell "upkbench <packets>")
+ * @param uiPackets Records to convert (0: 1k and 10k)
+ */
+void ImuUnpackBenchmark(UInt32 uiPackets)
+{
+    static UInt8 ucPayload[IMU_BATCH_MAX * IMU_PACKET_SIZE];
+    static float fRef[IMU_BATCH_MAX * IMU_AXES];
+    static float fOut[IMU_BATCH_MAX * IMU_AXES];
+    const UInt32 uiRuns[2] = { 1000, 10000 };
+    XTime xStart, xMid, xEnd;
+    UInt64 ullRefNs, ullNewNs;
+    UInt32 uiRun, uiDone, uiChunk, i;
+    UInt8 *pRec;
+    UInt32 uiMismatch;
+
+    /* Synthetic records covering both signs and full 24-bit range */
+    for (i = 0; i < sizeof(ucPayload); i++) {
+        ucPayload[i] = (UInt8)((i * 131U) + 7U);
+    }
+    for (i = 0; i < IMU_BATCH_MAX; i++) {
+        ucPayload[i * IMU_PACKET_SIZE] = IMU_SYNC_BYTE;
+    }
+
+    for (uiRun = 0; uiRun < 2; uiRun++) {
+        UInt32 uiTotal = (uiPackets != 0) ? uiPackets : uiRuns[uiRun];
+
+        uiMismatch = 0;
+        XTime_GetTime(&xStart);
+        for (uiDone = 0; uiDone < uiTotal; uiDone += uiChunk) {
+            uiChunk = ((uiTotal - uiDone) < IMU_BATCH_MAX) ? (uiTotal - uiDone) : IMU_BATCH_MAX;
+            for (i = 0; i < uiChunk; i++) {
+                pRec = &ucPayload[i * IMU_PACKET_SIZE];
+                fRef[(i * IMU_AXES) + 0] = ConvertRaw24(&pRec[1], GYRO_SCALE_FACTOR);
+                fRef[(i * IMU_AXES) + 1] = ConvertRaw24(&pRec[4], GYRO_SCALE_FACTOR);
+                fRef[(i * IMU_AXES) + 2] = ConvertRaw24(&pRec[7], GYRO_SCALE_FACTOR);
+                fRef[(i * IMU_AXES) + 3] = ConvertRaw24(&pRec[11], ACCEL_SCALE_FACTOR);
+                fRef[(i * IMU_AXES) + 4] = ConvertRaw24(&pRec[14], ACCEL_SCALE_FACTOR);
+                fRef[(i * IMU_AXES) + 5] = ConvertRaw24(&pRec[17], ACCEL_SCALE_FACTOR);
+            }
+        }
+        XTime_GetTime(&xMid);
+        for (uiDone = 0; uiDone < uiTotal; uiDone += uiChunk) {
+            uiChunk = ((uiTotal - uiDone) < IMU_BATCH_MAX) ? (uiTotal - uiDone) : IMU_BATCH_MAX;
+            ImuUnpackBatch(ucPayload, uiChunk, fOut);
+        }
+        XTime_GetTime(&xEnd);
+
+        /* Scales are powers of two: both paths must agree exactly */
+        uiChunk = (uiTotal < IMU_BATCH_MAX) ? uiTotal : IMU_BATCH_MAX;
+        for (i = 0; i < (uiChunk * IMU_AXES); i++) {
+            if (fRef[i] != fOut[i]) uiMismatch++;
+        }
+
+        ullRefNs = ((UInt64)(xMid - xStart) * 1000000000ULL) / COUNTS_PER_SECOND;
+        ullNewNs = ((UInt64)(xEnd - xMid) * 1000000000ULL) / COUNTS_PER_SECOND;
+        xil_printf("[IMU] unpack %u packets (%s): ConvertRaw24 %u ns/pkt, batch %u ns/pkt, x%u.%02u -> %s\r\n",
+            uiTotal, IMU_UNPACK_NEON ? "NEON" : "scalar",
+            (UInt32)(ullRefNs / uiTotal), (UInt32)(ullNewNs / uiTotal),
+            (UInt32)((ullNewNs != 0) ? (ullRefNs / ullNewNs) : 0),
+            (UInt32)((ullNewNs != 0) ? ((ullRefNs * 100ULL / ullNewNs) % 100ULL) : 0),
+            (uiMismatch == 0) ? "OK" : "MISMATCH");
+
+        if (uiPackets != 0) break;
+    }
+}
+
+/**
+ * @brief Convert 3-byte Big Endian 24-bit Signed Integer to Float
+ */
+float ConvertRaw24(UInt8 *pRaw, float fScale)
+{
+    return (float)ImuRaw24(pRaw) / fScale;
 }
 
 /**
@@ -98,21 +580,7 @@ void ProcessImuPacket(UInt8 *pRawData, ImuData_t *pOutput)
     /* Verify Sync Byte */
     if (pRawData[0] != IMU_SYNC_BYTE) return;
 
-    /* Gyro Parsing (Offset 1, 4, 7) */
-    pOutput->fGyroX = ConvertRaw24(&pRawData[1], GYRO_SCALE_FACTOR);
-    pOutput->fGyroY = ConvertRaw24(&pRawData[4], GYRO_SCALE_FACTOR);
-    pOutput->fGyroZ = ConvertRaw24(&pRawData[7], GYRO_SCALE_FACTOR);
-
-    /* Accel Parsing (Offset 11, 14, 17) */
-    pOutput->fAccX = ConvertRaw24(&pRawData[11], ACCEL_SCALE_FACTOR);
-    pOutput->fAccY = ConvertRaw24(&pRawData[14], ACCEL_SCALE_FACTOR);
-    pOutput->fAccZ = ConvertRaw24(&pRawData[17], ACCEL_SCALE_FACTOR);
-
-    /* Temperature Parsing (Offset 21, 22) */
-    pOutput->fTemp = GetImuGyroTempX(pRawData);
-
-    /* Counter (Offset 35) */
-    pOutput->ucCounter = pRawData[35];
+    ImuDecodeRecord(pRawData, pOutput);
 }
 
 /**
@@ -218,6 +686,9 @@ SInt32 ParseGpsPacket(const UInt8 *pRawData, GpsData_t *pOutput)
     /* Offset 68: NrSV (UInt8) */
     pOutput->nrSv = pRawData[68];
 
+    /* Offset 82: Latency (UInt16, 0.1 ms) */
+    memcpy(&pOutput->latency, &pRawData[82], 2);
+
     /* Offset 84: H-Accuracy (UInt16) */
     memcpy(&pOutput->hAccuracy, &pRawData[84], 2);
 
@@ -0,0 +1,532 @@
+/**
+ * @file navfilter.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Loosely Coupled GPS/INS Error-State Kalman Filter Source
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "../Inc/navfilter.h"
+#include "../Inc/strapdown.h"
+#include "task.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+#include <math.h>
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+/* WGS-84 */
+#define WGS84_A             6378137.0
+#define WGS84_E2            6.69437999014e-3
+
+/* Process Noise (1 sigma, STIM300 class) */
+#define NAV_SIGMA_ACC       0.05f       // m/s^2 / sqrt(Hz)
+#define NAV_SIGMA_GYRO      1.0e-4f     // rad/s / sqrt(Hz)
+#define NAV_SIGMA_BA_RW     1.0e-4f     // m/s^3 / sqrt(Hz)
+#define NAV_SIGMA_BG_RW     1.0e-6f     // rad/s^2 / sqrt(Hz)
+
+/* Measurement Noise */
+#define NAV_SIGMA_POS_MIN   0.5f        // m
+#define NAV_SIGMA_POS_DNU   5.0f        // m, accuracy field not available
+#define NAV_SIGMA_VEL       0.1f        // m/s
+
+/* Initial Uncertainty */
+#define NAV_P0_POS          25.0f       // (5 m)^2
+#define NAV_P0_VEL          0.25f       // (0.5 m/s)^2
+#define NAV_P0_PSI          0.03f       // (10 deg)^2
+#define NAV_P0_BG           3.0e-8f     // (0.01 deg/s)^2
+#define NAV_P0_BA           2.5e-3f     // (0.05 m/s^2)^2
+
+#define NAV_RAD_TO_DEG      57.2957795f
+#define NAV_NS(t0, t1)      ((UInt32)((((UInt64)((t1) - (t0))) * 1000000000ULL) / COUNTS_PER_SECOND))
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+/* Filter, owned by imu_thread */
+static NavFilter_t stNav;
+static NavTiming_t stNavTiming;
+
+/* GPS hand-off (IgnuTask -> imu_thread) and published output (critical section) */
+static GpsData_t stNavGps;
+static UInt32 uiNavGpsPending = 0;
+static NavOutput_t stNavOut;
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static float SymGet(const float *pP, UInt32 i, UInt32 j);
+static void SymPropagate(NavFilter_t *pNav, const float *pQd);
+static UInt32 SymScalarUpdate(float *pP, float *pDx, UInt32 k, float fY, float fR);
+
+static void NavQuatToDcm(const float *pQ, float (*pC)[3]);
+static void NavCovPropagate(NavFilter_t *pNav, float (*pC)[3], NavTiming_t *pTim);
+static void NavMechanize(NavFilter_t *pNav, const ImuData_t *pImu, UInt32 uiCnt, const float *pQ, NavTiming_t *pTim);
+static void NavInitFromFix(NavFilter_t *pNav, const GpsData_t *pGps);
+static UInt32 NavGpsUpdate(NavFilter_t *pNav, const GpsData_t *pGps, float *pDPsi, float *pDGyroBias, NavTiming_t *pTim);
+static void NavPublish(const NavFilter_t *pNav);
+
+/*==============================================================================
+ * Matrix Kernels (fixed size, packed symmetric storage)
+ *============================================================================*/
+
+/**
+ * @brief P(i, j) from the packed upper triangle
+ */
+static float SymGet(const float *pP, UInt32 i, UInt32 j)
+{
+    return (i <= j) ? pP[NAV_SYM_ROW(i) + j - i] : pP[NAV_SYM_ROW(j) + i - j];
+}
+
+/**
+ * @brief P = Phi P Phi' + diag(Qd), upper triangle only
+ *
+ * P is unpacked once into fTmp. Each row of Phi P is formed from the
+ * non-zero entries of that Phi row and immediately multiplied with Phi',
+ * so a single dense scratch matrix is enough.
+ */
+static void SymPropagate(NavFilter_t *pNav, const float *pQd)
+{
+    float fRow[NAV_STATES];
+    float fSum, fPhi;
+    UInt32 i, j, k;
+
+    for (i = 0; i < NAV_STATES; i++) {
+        for (j = i; j < NAV_STATES; j++) {
+            pNav->fTmp[i][j] = pNav->fP[NAV_SYM_ROW(i) + j - i];
+            pNav->fTmp[j][i] = pNav->fTmp[i][j];
+        }
+    }
+
+    for (i = 0; i < NAV_STATES; i++) {
+        /* fRow = Phi(i,:) * P (Phi is identity plus a few blocks) */
+        for (k = 0; k < NAV_STATES; k++) fRow[k] = 0.0f;
+        for (j = 0; j < NAV_STATES; j++) {
+            fPhi = pNav->fPhi[i][j];
+            if (fPhi == 0.0f) continue;
+            for (k = 0; k < NAV_STATES; k++) fRow[k] += fPhi * pNav->fTmp[j][k];
+        }
+
+        /* P(i, k>=i) = fRow * Phi(k,:)' */
+        for (k = i; k < NAV_STATES; k++) {
+            fSum = 0.0f;
+            for (j = 0; j < NAV_STATES; j++) fSum += fRow[j] * pNav->fPhi[k][j];
+            pNav->fP[NAV_SYM_ROW(i) + k - i] = fSum;
+        }
+        pNav->fP[NAV_SYM_ROW(i)] += pQd[i];
+    }
+}
+
+/**
+ * @brief Scalar measurement z = x(k) + v, var(v) = fR
+ * @param fY Innovation against the nominal state (dx(k) is subtracted here)
+ * @return UInt32 1: applied, 0: rejected by the innovation gate
+ */
+static UInt32 SymScalarUpdate(float *pP, float *pDx, UInt32 k, float fY, float fR)
+{
+    float fCol[NAV_STATES];
+    float fS, fInvS, fGain;
+    UInt32 i, j;
+
+    fS = pP[NAV_SYM_ROW(k)] + fR;
+    fY -= pDx[k];
+    if ((fY * fY) > (NAV_GATE_SIGMA2 * fS)) return 0;
+
+    fInvS = 1.0f / fS;
+    for (i = 0; i < NAV_STATES; i++) fCol[i] = SymGet(pP, i, k);
+
+    /* dx += K y, P -= K S K' (stays symmetric by construction) */
+    for (i = 0; i < NAV_STATES; i++) {
+        fGain = fCol[i] * fInvS;
+        pDx[i] += fGain * fY;
+        for (j = i; j < NAV_STATES; j++) {
+            pP[NAV_SYM_ROW(i) + j - i] -= fGain * fCol[j];
+        }
+    }
+
+    return 1;
+}
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @brief Quaternion [w, x, y, z] (body -> nav) to DCM C_nb
+ */
+static void NavQuatToDcm(const float *pQ, float (*pC)[3])
+{
+    float w = pQ[0], x = pQ[1], y = pQ[2], z = pQ[3];
+
+    pC[0][0] = 1.0f - 2.0f * (y * y + z * z);
+    pC[0][1] = 2.0f * (x * y - w * z);
+    pC[0][2] = 2.0f * (x * z + w * y);
+    pC[1][0] = 2.0f * (x * y + w * z);
+    pC[1][1] = 1.0f - 2.0f * (x * x + z * z);
+    pC[1][2] = 2.0f * (y * z - w * x);
+    pC[2][0] = 2.0f * (x * z - w * y);
+    pC[2][1] = 2.0f * (y * z + w * x);
+    pC[2][2] = 1.0f - 2.0f * (x * x + y * y);
+}
+
+/**
+ * @brief Covariance propagation over the last uiCovCnt samples
+ *
+ * dPos' = dVel, dVel' = -[fn x] dPsi - C dBa, dPsi' = -C dBg, biases: random walk
+ */
+static void NavCovPropagate(NavFilter_t *pNav, float (*pC)[3], NavTiming_t *pTim)
+{
+    float fQd[NAV_STATES];
+    float fDt = (float)pNav->uiCovCnt * STRAPDOWN_DT;
+    float fFn[3];
+    XTime xStart, xEnd;
+    UInt32 i, j, uiNs;
+
+    XTime_GetTime(&xStart);
+
+    for (i = 0; i < 3; i++) fFn[i] = pNav->fFnSum[i] / (float)pNav->uiCovCnt;
+
+    memset(pNav->fPhi, 0, sizeof(pNav->fPhi));
+    for (i = 0; i < NAV_STATES; i++) pNav->fPhi[i][i] = 1.0f;
+
+    for (i = 0; i < 3; i++) {
+        pNav->fPhi[NAV_X_POS + i][NAV_X_VEL + i] = fDt;
+        for (j = 0; j < 3; j++) {
+            pNav->fPhi[NAV_X_VEL + i][NAV_X_BA + j] = -pC[i][j] * fDt;
+            pNav->fPhi[NAV_X_PSI + i][NAV_X_BG + j] = -pC[i][j] * fDt;
+        }
+    }
+
+    /* -[fn x] */
+    pNav->fPhi[NAV_X_VEL + 0][NAV_X_PSI + 1] = fFn[2] * fDt;
+    pNav->fPhi[NAV_X_VEL + 0][NAV_X_PSI + 2] = -fFn[1] * fDt;
+    pNav->fPhi[NAV_X_VEL + 1][NAV_X_PSI + 0] = -fFn[2] * fDt;
+    pNav->fPhi[NAV_X_VEL + 1][NAV_X_PSI + 2] = fFn[0] * fDt;
+    pNav->fPhi[NAV_X_VEL + 2][NAV_X_PSI + 0] = fFn[1] * fDt;
+    pNav->fPhi[NAV_X_VEL + 2][NAV_X_PSI + 1] = -fFn[0] * fDt;
+
+    for (i = 0; i < 3; i++) {
+        fQd[NAV_X_POS + i] = 0.0f;
+        fQd[NAV_X_VEL + i] = NAV_SIGMA_ACC * NAV_SIGMA_ACC * fDt;
+        fQd[NAV_X_PSI + i] = NAV_SIGMA_GYRO * NAV_SIGMA_GYRO * fDt;
+        fQd[NAV_X_BG + i] = NAV_SIGMA_BG_RW * NAV_SIGMA_BG_RW * fDt;
+        fQd[NAV_X_BA + i] = NAV_SIGMA_BA_RW * NAV_SIGMA_BA_RW * fDt;
+    }
+
+    SymPropagate(pNav, fQd);
+
+    pNav->fFnSum[0] = pNav->fFnSum[1] = pNav->fFnSum[2] = 0.0f;
+    pNav->uiCovCnt = 0;
+
+    XTime_GetTime(&xEnd);
+    uiNs = NAV_NS(xStart, xEnd);
+    if (uiNs > pTim->uiPropMaxNs) pTim->uiPropMaxNs = uiNs;
+    pTim->ullPropNs += uiNs;
+    pTim->uiPropCnt++;
+}
+
+/**
+ * @brief INS mechanisation (NED, flat earth, no earth rate) at IMU rate
+ */
+static void NavMechanize(NavFilter_t *pNav, const ImuData_t *pImu, UInt32 uiCnt, const float *pQ, NavTiming_t *pTim)
+{
+    float fC[3][3];
+    float fFb[3], fFn[3];
+    UInt32 i, k;
+
+    NavQuatToDcm(pQ, fC);
+
+    for (k = 0; k < uiCnt; k++, pImu++) {
+        fFb[0] = (pImu->fAccX * NAV_GRAVITY) - pNav->fAccBias[0];
+        fFb[1] = (pImu->fAccY * NAV_GRAVITY) - pNav->fAccBias[1];
+        fFb[2] = (pImu->fAccZ * NAV_GRAVITY) - pNav->fAccBias[2];
+
+        for (i = 0; i < 3; i++) {
+            fFn[i] = (fC[i][0] * fFb[0]) + (fC[i][1] * fFb[1]) + (fC[i][2] * fFb[2]);
+            pNav->fFnSum[i] += fFn[i];
+        }
+        fFn[2] += NAV_GRAVITY;
+
+        for (i = 0; i < 3; i++) {
+            pNav->fVel[i] += fFn[i] * STRAPDOWN_DT;
+            pNav->dPos[i] += (double)(pNav->fVel[i] * STRAPDOWN_DT);
+        }
+
+        if (++pNav->uiCovCnt >= NAV_COV_DECIM) {
+            NavCovPropagate(pNav, fC, pTim);
+        }
+    }
+}
+
+/**
+ * @brief Local frame and state from the first valid fix
+ */
+static void NavInitFromFix(NavFilter_t *pNav, const GpsData_t *pGps)
+{
+    double dSin = sin(pGps->latitude);
+    double dDen = 1.0 - (WGS84_E2 * dSin * dSin);
+    UInt32 i;
+
+    memset(pNav, 0, sizeof(NavFilter_t));
+
+    pNav->dLat0 = pGps->latitude;
+    pNav->dLon0 = pGps->longitude;
+    pNav->dH0 = pGps->height;
+    pNav->dCosLat0 = cos(pGps->latitude);
+    pNav->dRn = (WGS84_A * (1.0 - WGS84_E2)) / (dDen * sqrt(dDen)) + pGps->height;
+    pNav->dRe = WGS84_A / sqrt(dDen) + pGps->height;
+
+    pNav->fVel[0] = pGps->vn;
+    pNav->fVel[1] = pGps->ve;
+    pNav->fVel[2] = -pGps->vu;
+
+    for (i = 0; i < 3; i++) {
+        pNav->fP[NAV_SYM_ROW(NAV_X_POS + i)] = NAV_P0_POS;
+        pNav->fP[NAV_SYM_ROW(NAV_X_VEL + i)] = NAV_P0_VEL;
+        pNav->fP[NAV_SYM_ROW(NAV_X_PSI + i)] = NAV_P0_PSI;
+        pNav->fP[NAV_SYM_ROW(NAV_X_BG + i)] = NAV_P0_BG;
+        pNav->fP[NAV_SYM_ROW(NAV_X_BA + i)] = NAV_P0_BA;
+    }
+
+    pNav->uiInit = 1;
+}
+
+/**
+ * @brief GPS position / velocity update (6 sequential scalar updates) and injection
+ * @param pDPsi Attitude correction for the strapdown (rad)
+ * @param pDGyroBias Gyro bias increment for the strapdown (rad/s)
+ * @return UInt32 1: filter corrected, 0: fix unusable / filter (re)initialised
+ */
+static UInt32 NavGpsUpdate(NavFilter_t *pNav, const GpsData_t *pGps, float *pDPsi, float *pDGyroBias, NavTiming_t *pTim)
+{
+    float fDx[NAV_STATES];
+    float fY[6], fR[6];
+    float fSigH, fSigV;
+    XTime xStart, xEnd;
+    UInt32 i, uiUsed = 0, uiNs;
+
+    /* PVT mode 0 = no solution, latitude DNU = -2e10 */
+    if (((pGps->mode & 0x0F) == 0) || (pGps->error != 0) || (pGps->latitude < -10.0)) {
+        pTim->uiGpsInvalid++;
+        return 0;
+    }
+
+    if (pNav->uiInit == 0) {
+        NavInitFromFix(pNav, pGps);
+        return 0;
+    }
+
+    XTime_GetTime(&xStart);
+
+    /* Accuracy in 0.01 m (2DRMS), 65535 = not available */
+    fSigH = (pGps->hAccuracy == 0xFFFF) ? NAV_SIGMA_POS_DNU : ((float)pGps->hAccuracy * 0.005f);
+    fSigV = (pGps->vAccuracy == 0xFFFF) ? NAV_SIGMA_POS_DNU : ((float)pGps->vAccuracy * 0.005f);
+    if (fSigH < NAV_SIGMA_POS_MIN) fSigH = NAV_SIGMA_POS_MIN;
+    if (fSigV < NAV_SIGMA_POS_MIN) fSigV = NAV_SIGMA_POS_MIN;
+
+    /* Innovations against the nominal state (NED) */
+    fY[0] = (float)(((pGps->latitude - pNav->dLat0) * pNav->dRn) - pNav->dPos[0]);
+    fY[1] = (float)(((pGps->longitude - pNav->dLon0) * pNav->dRe * pNav->dCosLat0) - pNav->dPos[1]);
+    fY[2] = (float)((pNav->dH0 - pGps->height) - pNav->dPos[2]);
+    fY[3] = pGps->vn - pNav->fVel[0];
+    fY[4] = pGps->ve - pNav->fVel[1];
+    fY[5] = -pGps->vu - pNav->fVel[2];
+    fR[0] = fR[1] = fSigH * fSigH;
+    fR[2] = fSigV * fSigV;
+    fR[3] = fR[4] = fR[5] = NAV_SIGMA_VEL * NAV_SIGMA_VEL;
+
+    memset(fDx, 0, sizeof(fDx));
+    for (i = 0; i < 6; i++) {
+        if (SymScalarUpdate(pNav->fP, fDx, NAV_X_POS + i, fY[i], fR[i])) {
+            uiUsed++;
+        } else {
+            pTim->uiGpsRejected++;
+        }
+    }
+
+    /* Inject the error estimate, error state back to zero */
+    for (i = 0; i < 3; i++) {
+        pNav->dPos[i] += fDx[NAV_X_POS + i];
+        pNav->fVel[i] += fDx[NAV_X_VEL + i];
+        pNav->fGyroBias[i] += fDx[NAV_X_BG + i];
+        pNav->fAccBias[i] += fDx[NAV_X_BA + i];
+        pDPsi[i] = fDx[NAV_X_PSI + i];
+        pDGyroBias[i] = fDx[NAV_X_BG + i];
+    }
+
+    XTime_GetTime(&xEnd);
+    uiNs = NAV_NS(xStart, xEnd);
+    if (uiNs > pTim->uiUpdMaxNs) pTim->uiUpdMaxNs = uiNs;
+    pTim->ullUpdNs += uiNs;
+    pTim->uiUpdCnt++;
+
+    return (uiUsed > 0) ? 1 : 0;
+}
+
+/**
+ * @brief Publish the nominal state as geodetic output
+ */
+static void NavPublish(const NavFilter_t *pNav)
+{
+    NavOutput_t stOut;
+
+    stOut.dLat = pNav->dLat0 + (pNav->dPos[0] / pNav->dRn);
+    stOut.dLon = pNav->dLon0 + (pNav->dPos[1] / (pNav->dRe * pNav->dCosLat0));
+    stOut.dHeight = pNav->dH0 - pNav->dPos[2];
+    stOut.fVn = pNav->fVel[0];
+    stOut.fVe = pNav->fVel[1];
+    stOut.fVu = -pNav->fVel[2];
+    memcpy(stOut.fAccBias, pNav->fAccBias, sizeof(stOut.fAccBias));
+    memcpy(stOut.fGyroBias, pNav->fGyroBias, sizeof(stOut.fGyroBias));
+    stOut.uiValid = 1;
+
+    taskENTER_CRITICAL();
+    memcpy(&stNavOut, &stOut, sizeof(NavOutput_t));
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Hand a decoded GPS fix to the filter (IgnuTask)
+ */
+void NavFilterGpsPost(const GpsData_t *pGps)
+{
+    if (pGps == NULL) return;
+
+    taskENTER_CRITICAL();
+    memcpy(&stNavGps, pGps, sizeof(GpsData_t));
+    uiNavGpsPending = 1;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief GPS update (if a fix is pending) and mechanisation of one IMU batch
+ * (imu_thread, after StrapdownUpdate)
+ */
+void NavFilterUpdate(const ImuData_t *pImu, UInt32 uiCnt)
+{
+    GpsData_t stGps;
+    UInt32 uiGps;
+    float fQ[4], fDPsi[3], fDBg[3];
+
+    taskENTER_CRITICAL();
+    uiGps = uiNavGpsPending;
+    if (uiGps) {
+        memcpy(&stGps, &stNavGps, sizeof(GpsData_t));
+        uiNavGpsPending = 0;
+    }
+    taskEXIT_CRITICAL();
+
+    if (uiGps && NavGpsUpdate(&stNav, &stGps, fDPsi, fDBg, &stNavTiming)) {
+        StrapdownApplyCorrection(fDPsi, fDBg);
+    }
+
+    if ((stNav.uiInit == 0) || (pImu == NULL) || (uiCnt == 0)) return;
+
+    StrapdownGetQuat(fQ);
+    NavMechanize(&stNav, pImu, uiCnt, fQ, &stNavTiming);
+    NavPublish(&stNav);
+}
+
+/**
+ * @brief Latest filtered position / velocity (TxTask)
+ * @return UInt32 1: valid, 0: no GPS fix yet
+ */
+UInt32 NavFilterGetOutput(NavOutput_t *pOut)
+{
+    if (pOut == NULL) return 0;
+
+    taskENTER_CRITICAL();
+    memcpy(pOut, &stNavOut, sizeof(NavOutput_t));
+    taskEXIT_CRITICAL();
+
+    return pOut->uiValid;
+}
+
+/**
+ * @brief Print filter state and step timing (DBG "nav")
+ */
+void NavFilterReport(void)
+{
+    NavTiming_t stTim = stNavTiming;
+    NavOutput_t stOut;
+    UInt32 i;
+
+    if (NavFilterGetOutput(&stOut) == 0) {
+        xil_printf("[NAV] Waiting for GPS fix (invalid %u)\r\n", stTim.uiGpsInvalid);
+    } else {
+        xil_printf("[NAV] Pos NED ");
+        for (i = 0; i < 3; i++) { PrintDouble(stNav.dPos[i]); xil_printf(" "); }
+        xil_printf("m, Vel NED ");
+        for (i = 0; i < 3; i++) { PrintFloat(stNav.fVel[i]); xil_printf(" "); }
+        xil_printf("m/s\r\n[NAV] Acc bias ");
+        for (i = 0; i < 3; i++) { PrintFloat(stNav.fAccBias[i]); xil_printf(" "); }
+        xil_printf("m/s2, Gyro bias ");
+        for (i = 0; i < 3; i++) { PrintFloat(stNav.fGyroBias[i] * NAV_RAD_TO_DEG); xil_printf(" "); }
+        xil_printf("deg/s\r\n");
+    }
+
+    xil_printf("[NAV] Propagate %u x avg %u ns max %u ns | GPS update %u x avg %u ns max %u ns | rejected %u invalid %u\r\n",
+        stTim.uiPropCnt, (UInt32)((stTim.uiPropCnt != 0) ? (stTim.ullPropNs / stTim.uiPropCnt) : 0), stTim.uiPropMaxNs,
+        stTim.uiUpdCnt, (UInt32)((stTim.uiUpdCnt != 0) ? (stTim.ullUpdNs / stTim.uiUpdCnt) : 0), stTim.uiUpdMaxNs,
+        stTim.uiGpsRejected, stTim.uiGpsInvalid);
+}
+
+/**
+ * @brief Stationary run with a 1 m/s initial velocity error, 10 Hz GPS
+ * (DBG "navbench <gps cycles>")
+ */
+void NavFilterBenchmark(UInt32 uiCycles)
+{
+    static NavFilter_t stBench;
+    static ImuData_t stBatch[NAV_COV_DECIM];
+    const float fQ[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+    NavTiming_t stTim;
+    GpsData_t stGps;
+    float fDPsi[3], fDBg[3];
+    UInt32 uiCycle, k;
+
+    if (uiCycles == 0) uiCycles = 100;
+
+    memset(&stTim, 0, sizeof(stTim));
+    memset(&stGps, 0, sizeof(stGps));
+    stGps.latitude = 37.5 / NAV_RAD_TO_DEG;
+    stGps.longitude = 127.0 / NAV_RAD_TO_DEG;
+    stGps.height = 50.0;
+    stGps.mode = 1;
+    stGps.hAccuracy = 200;
+    stGps.vAccuracy = 300;
+
+    /* Level, at rest: specific force -1 g on the down axis */
+    memset(stBatch, 0, sizeof(stBatch));
+    for (k = 0; k < NAV_COV_DECIM; k++) stBatch[k].fAccZ = -1.0f;
+
+    stBench.uiInit = 0;
+    NavGpsUpdate(&stBench, &stGps, fDPsi, fDBg, &stTim);
+    stBench.fVel[0] = 1.0f;
+
+    for (uiCycle = 0; uiCycle < uiCycles; uiCycle++) {
+        for (k = 0; k < (IMU_RATE_HZ / 10) / NAV_COV_DECIM; k++) {
+            NavMechanize(&stBench, stBatch, NAV_COV_DECIM, fQ, &stTim);
+        }
+        NavGpsUpdate(&stBench, &stGps, fDPsi, fDBg, &stTim);
+    }
+
+    xil_printf("[NAV] %u GPS cycles: propagate avg %u ns max %u ns, update avg %u ns max %u ns, %u.%03u %% CPU (%u Hz IMU / 10 Hz GPS)\r\n",
+        uiCycles,
+        (UInt32)(stTim.ullPropNs / stTim.uiPropCnt), stTim.uiPropMaxNs,
+        (UInt32)(stTim.ullUpdNs / stTim.uiUpdCnt), stTim.uiUpdMaxNs,
+        (UInt32)(((stTim.ullPropNs + stTim.ullUpdNs) / uiCycles) / 1000000ULL),
+        (UInt32)((((stTim.ullPropNs + stTim.ullUpdNs) / uiCycles) / 1000ULL) % 1000ULL),
+        IMU_RATE_HZ);
+    xil_printf("[NAV] Vel N ");
+    PrintFloat(stBench.fVel[0]);
+    xil_printf(" m/s (from 1.0), Pos N ");
+    PrintDouble(stBench.dPos[0]);
+    xil_printf(" m -> %s\r\n", ((fabsf(stBench.fVel[0]) < 0.05f) && (fabs(stBench.dPos[0]) < 0.5)) ? "OK" : "MISMATCH");
+}
@@ -0,0 +1,145 @@
+/**
+ * @file pus.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief PUS Service / Subtype Dispatch Registry Source
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "../Inc/pus.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+/* Lookup tables, 0 = not registered (index + 1 otherwise) */
+static UInt8 ucPusSvcSlot[256];
+static UInt8 ucPusSubIdx[PUS_SVC_SLOTS][256];
+static UInt32 uiPusSvcCnt = 0;
+
+static PusEntry_t stPusEntry[PUS_HANDLER_MAX];
+static UInt32 uiPusEntryCnt = 0;
+
+/* Dispatch errors */
+static UInt32 uiPusSvcErr = 0;
+static UInt32 uiPusSubErr = 0;
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @brief Register a handler for service ucSvc, subtypes ucSubMin..ucSubMax
+ * @param usMinLen / usMaxLen Accepted user data length (PUS_LEN_ANY: no limit)
+ * @return SInt32 Handler index, PUS_ERR_FULL or PUS_ERR_OVERLAP
+ */
+SInt32 PusRegister(UInt8 ucSvc, UInt8 ucSubMin, UInt8 ucSubMax, UInt16 usMinLen, UInt16 usMaxLen,
+                   PusHandler_t pfnHandler, const char *pName)
+{
+    PusEntry_t *pEntry;
+    UInt32 uiSlot, uiSub;
+
+    if ((pfnHandler == NULL) || (ucSubMin > ucSubMax)) return PUS_ERR_FULL;
+    if (uiPusEntryCnt >= PUS_HANDLER_MAX) return PUS_ERR_FULL;
+
+    /* Service slot (new services take the next one) */
+    uiSlot = ucPusSvcSlot[ucSvc];
+    if (uiSlot == 0) {
+        if (uiPusSvcCnt >= PUS_SVC_SLOTS) return PUS_ERR_FULL;
+        uiSlot = ++uiPusSvcCnt;
+    }
+
+    for (uiSub = ucSubMin; uiSub <= ucSubMax; uiSub++) {
+        if (ucPusSubIdx[uiSlot - 1][uiSub] != 0) {
+            xil_printf("[PUS] Svc %d Sub %d already registered (%s)\r\n", ucSvc, uiSub,
+                stPusEntry[ucPusSubIdx[uiSlot - 1][uiSub] - 1].pName);
+            return PUS_ERR_OVERLAP;
+        }
+    }
+
+    pEntry = &stPusEntry[uiPusEntryCnt];
+    pEntry->pfnHandler = pfnHandler;
+    pEntry->pName = pName;
+    pEntry->ucSvc = ucSvc;
+    pEntry->ucSubMin = ucSubMin;
+    pEntry->ucSubMax = ucSubMax;
+    pEntry->usMinLen = usMinLen;
+    pEntry->usMaxLen = usMaxLen;
+    uiPusEntryCnt++;
+
+    ucPusSvcSlot[ucSvc] = (UInt8)uiSlot;
+    for (uiSub = ucSubMin; uiSub <= ucSubMax; uiSub++) {
+        ucPusSubIdx[uiSlot - 1][uiSub] = (UInt8)uiPusEntryCnt;
+    }
+
+    return (SInt32)(uiPusEntryCnt - 1);
+}
+
+/**
+ * @brief Look up, length-check and run the handler of a TC
+ * @return SInt32 PUS_OK or PUS_ERR_xxx (handler not called, caller NACKs)
+ */
+SInt32 PusDispatch(UInt8 ucSvc, UInt8 ucSub, UInt8 *pData, UInt32 uiLen)
+{
+    PusEntry_t *pEntry;
+    UInt32 uiSlot, uiIdx, uiNs;
+    XTime xStart, xEnd;
+
+    uiSlot = ucPusSvcSlot[ucSvc];
+    if (uiSlot == 0) {
+        uiPusSvcErr++;
+        return PUS_ERR_SERVICE;
+    }
+
+    uiIdx = ucPusSubIdx[uiSlot - 1][ucSub];
+    if (uiIdx == 0) {
+        uiPusSubErr++;
+        return PUS_ERR_SUBTYPE;
+    }
+
+    pEntry = &stPusEntry[uiIdx - 1];
+    if ((uiLen < pEntry->usMinLen) || ((pEntry->usMaxLen != PUS_LEN_ANY) && (uiLen > pEntry->usMaxLen))) {
+        pEntry->uiLenErr++;
+        xil_printf("[PUS] %s: Invalid Length %d (Expected %d..%d)\r\n", pEntry->pName, uiLen,
+            pEntry->usMinLen, pEntry->usMaxLen);
+        return PUS_ERR_LENGTH;
+    }
+
+    XTime_GetTime(&xStart);
+    pEntry->pfnHandler(ucSvc, ucSub, pData, uiLen);
+    XTime_GetTime(&xEnd);
+
+    uiNs = (UInt32)(((UInt64)(xEnd - xStart) * 1000000000ULL) / COUNTS_PER_SECOND);
+    if (uiNs > pEntry->uiMaxNs) pEntry->uiMaxNs = uiNs;
+    pEntry->ullSumNs += uiNs;
+    pEntry->uiCnt++;
+
+    return PUS_OK;
+}
+
+/**
+ * @brief Registered handlers with call counts and execution time (DBG "pus")
+ */
+void PusReport(void)
+{
+    PusEntry_t *pEntry;
+    UInt32 i;
+
+    xil_printf("[PUS] %u handlers, %u services, unknown service %u, unknown subtype %u\r\n",
+        uiPusEntryCnt, uiPusSvcCnt, uiPusSvcErr, uiPusSubErr);
+
+    for (i = 0; i < uiPusEntryCnt; i++) {
+        pEntry = &stPusEntry[i];
+        xil_printf("  Svc %2d Sub %3d-%3d %-12s calls %u, len err %u, avg %u us, max %u us\r\n",
+            pEntry->ucSvc, pEntry->ucSubMin, pEntry->ucSubMax, pEntry->pName,
+            pEntry->uiCnt, pEntry->uiLenErr,
+            (UInt32)((pEntry->uiCnt != 0) ? ((pEntry->ullSumNs / pEntry->uiCnt) / 1000) : 0),
+            pEntry->uiMaxNs / 1000);
+    }
+}
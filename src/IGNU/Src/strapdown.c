@@ -0,0 +1,384 @@
+/**
+ * @file strapdown.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Quaternion Strapdown Attitude Propagation Source
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "../Inc/strapdown.h"
+#include "task.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+#include <math.h>
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#ifndef PI
+#define PI 3.14159265358979323846f
+#endif
+#define RAD_TO_DEG  (180.0f / PI)
+#define DEG_TO_RAD  (PI / 180.0f)
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+/* Propagation state, owned by imu_thread */
+static StrapdownState_t stSdState = { { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, 0 };
+
+/* Published attitude / pending TPVAW initialisation (critical section) */
+static float fSdPubQ[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+static float fSdInitQ[4];
+static UInt32 uiSdInitPending = 0;
+static UInt32 uiSdAligned = 0;              // 0: no TPVAW received yet
+
+/* Pending navigation filter correction (summed until imu_thread applies it) */
+static float fSdCorrPsi[3];                 // Nav-frame attitude error (rad)
+static float fSdCorrBias[3];                // Gyro bias increment (deg/s)
+static UInt32 uiSdCorrPending = 0;
+
+static StrapdownStats_t stSdStats;
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static void StrapdownStep(StrapdownState_t *pSt, const ImuData_t *pImu, UInt32 uiCnt);
+static void StrapdownCorrect(StrapdownState_t *pSt, const float *pDPsi, const float *pDBias);
+static void QuatNormalize(float *pQ);
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @brief One-step renormalisation, |q| = 1 to first order (no sqrt)
+ */
+static void QuatNormalize(float *pQ)
+{
+    float fK = 1.5f - 0.5f * (pQ[0] * pQ[0] + pQ[1] * pQ[1] + pQ[2] * pQ[2] + pQ[3] * pQ[3]);
+
+    pQ[0] *= fK;
+    pQ[1] *= fK;
+    pQ[2] *= fK;
+    pQ[3] *= fK;
+}
+
+/**
+ * @brief Propagate uiCnt samples (fixed cost per sample)
+ *
+ * alpha_k = w_k * dt, phi = alpha_k + (alpha_{k-1} x alpha_k) / 12,
+ * q = q * [cos(|phi|/2), sin(|phi|/2) phi/|phi|] (4th-order series).
+ */
+static void StrapdownStep(StrapdownState_t *pSt, const ImuData_t *pImu, UInt32 uiCnt)
+{
+    const float fScale = DEG_TO_RAD * STRAPDOWN_DT;
+    float fA[3], fPhi[3];
+    float fN2, fC, fS;
+    float w, x, y, z;
+    UInt32 i;
+
+    for (i = 0; i < uiCnt; i++, pImu++) {
+        /* Delta angle (rad), bias compensated */
+        fA[0] = (pImu->fGyroX - pSt->fGyroBias[0]) * fScale;
+        fA[1] = (pImu->fGyroY - pSt->fGyroBias[1]) * fScale;
+        fA[2] = (pImu->fGyroZ - pSt->fGyroBias[2]) * fScale;
+
+        /* Coning correction (zero on the first sample after init) */
+        if (pSt->uiPrevValid) {
+            fPhi[0] = fA[0] + (pSt->fPrevAlpha[1] * fA[2] - pSt->fPrevAlpha[2] * fA[1]) * (1.0f / 12.0f);
+            fPhi[1] = fA[1] + (pSt->fPrevAlpha[2] * fA[0] - pSt->fPrevAlpha[0] * fA[2]) * (1.0f / 12.0f);
+            fPhi[2] = fA[2] + (pSt->fPrevAlpha[0] * fA[1] - pSt->fPrevAlpha[1] * fA[0]) * (1.0f / 12.0f);
+        } else {
+            fPhi[0] = fA[0];
+            fPhi[1] = fA[1];
+            fPhi[2] = fA[2];
+        }
+        pSt->fPrevAlpha[0] = fA[0];
+        pSt->fPrevAlpha[1] = fA[1];
+        pSt->fPrevAlpha[2] = fA[2];
+        pSt->uiPrevValid = 1;
+
+        /* Rotation quaternion */
+        fN2 = fPhi[0] * fPhi[0] + fPhi[1] * fPhi[1] + fPhi[2] * fPhi[2];
+        fC = 1.0f - fN2 * (1.0f / 8.0f) + fN2 * fN2 * (1.0f / 384.0f);
+        fS = 0.5f - fN2 * (1.0f / 48.0f);
+        fPhi[0] *= fS;
+        fPhi[1] *= fS;
+        fPhi[2] *= fS;
+
+        /* q = q * dq */
+        w = pSt->fQ[0];
+        x = pSt->fQ[1];
+        y = pSt->fQ[2];
+        z = pSt->fQ[3];
+        pSt->fQ[0] = w * fC - x * fPhi[0] - y * fPhi[1] - z * fPhi[2];
+        pSt->fQ[1] = x * fC + w * fPhi[0] + y * fPhi[2] - z * fPhi[1];
+        pSt->fQ[2] = y * fC + w * fPhi[1] + z * fPhi[0] - x * fPhi[2];
+        pSt->fQ[3] = z * fC + w * fPhi[2] + x * fPhi[1] - y * fPhi[0];
+
+        QuatNormalize(pSt->fQ);
+    }
+}
+
+/**
+ * @brief Apply a filter correction: q = [1, dPsi/2] * q (nav frame), bias += dBias
+ */
+static void StrapdownCorrect(StrapdownState_t *pSt, const float *pDPsi, const float *pDBias)
+{
+    float w = pSt->fQ[0], x = pSt->fQ[1], y = pSt->fQ[2], z = pSt->fQ[3];
+    float a = 0.5f * pDPsi[0], b = 0.5f * pDPsi[1], c = 0.5f * pDPsi[2];
+
+    pSt->fQ[0] = w - a * x - b * y - c * z;
+    pSt->fQ[1] = x + a * w + b * z - c * y;
+    pSt->fQ[2] = y + b * w + c * x - a * z;
+    pSt->fQ[3] = z + c * w + a * y - b * x;
+    QuatNormalize(pSt->fQ);
+
+    pSt->fGyroBias[0] += pDBias[0];
+    pSt->fGyroBias[1] += pDBias[1];
+    pSt->fGyroBias[2] += pDBias[2];
+}
+
+/**
+ * @brief Queue a navigation filter correction (applied before the next batch)
+ * @param pDPsi Nav-frame attitude error estimate (rad), true = (I + [dPsi x]) est
+ * @param pDGyroBias Gyro bias increment (rad/s)
+ */
+void StrapdownApplyCorrection(const float *pDPsi, const float *pDGyroBias)
+{
+    UInt32 i;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < 3; i++) {
+        fSdCorrPsi[i] += pDPsi[i];
+        fSdCorrBias[i] += pDGyroBias[i] * RAD_TO_DEG;
+    }
+    uiSdCorrPending = 1;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Latest propagated quaternion [w, x, y, z] (body -> nav)
+ */
+void StrapdownGetQuat(float *pQ)
+{
+    taskENTER_CRITICAL();
+    memcpy(pQ, fSdPubQ, sizeof(fSdPubQ));
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Restart propagation from a reference attitude (TPVAW, IgnuTask)
+ * Applied by imu_thread before its next batch.
+ */
+void StrapdownInit(float fW, float fX, float fY, float fZ)
+{
+    float fN = sqrtf(fW * fW + fX * fX + fY * fY + fZ * fZ);
+
+    if (!(fN > 0.0f)) return;
+
+    taskENTER_CRITICAL();
+    fSdInitQ[0] = fW / fN;
+    fSdInitQ[1] = fX / fN;
+    fSdInitQ[2] = fY / fN;
+    fSdInitQ[3] = fZ / fN;
+    uiSdInitPending = 1;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Propagate every decoded record of one payload (imu_thread)
+ * @param pImu Records in sample order
+ * @param uiCnt Number of Records
+ */
+void StrapdownUpdate(const ImuData_t *pImu, UInt32 uiCnt)
+{
+    XTime xStart, xEnd;
+    UInt32 uiNs;
+
+    if ((pImu == NULL) || (uiCnt == 0)) return;
+
+    XTime_GetTime(&xStart);
+
+    taskENTER_CRITICAL();
+    if (uiSdInitPending) {
+        memcpy(stSdState.fQ, fSdInitQ, sizeof(stSdState.fQ));
+        stSdState.uiPrevValid = 0;
+        uiSdInitPending = 0;
+        uiSdAligned = 1;
+    }
+    if (uiSdCorrPending) {
+        StrapdownCorrect(&stSdState, fSdCorrPsi, fSdCorrBias);
+        memset(fSdCorrPsi, 0, sizeof(fSdCorrPsi));
+        memset(fSdCorrBias, 0, sizeof(fSdCorrBias));
+        uiSdCorrPending = 0;
+    }
+    taskEXIT_CRITICAL();
+
+    StrapdownStep(&stSdState, pImu, uiCnt);
+
+    taskENTER_CRITICAL();
+    memcpy(fSdPubQ, stSdState.fQ, sizeof(fSdPubQ));
+    taskEXIT_CRITICAL();
+
+    XTime_GetTime(&xEnd);
+
+    /* Per-sample cost of this batch */
+    uiNs = (UInt32)((((UInt64)(xEnd - xStart) * 1000000000ULL) / COUNTS_PER_SECOND) / uiCnt);
+    if (uiNs > stSdStats.uiMaxNs) stSdStats.uiMaxNs = uiNs;
+    if (uiNs > STRAPDOWN_BUDGET_NS) stSdStats.uiOverBudget++;
+    stSdStats.ullSumNs += ((UInt64)(xEnd - xStart) * 1000000000ULL) / COUNTS_PER_SECOND;
+    stSdStats.uiSamples += uiCnt;
+    stSdStats.uiBatches++;
+}
+
+/**
+ * @brief Quaternion [w, x, y, z] to Euler ZYX (deg)
+ */
+void QuatToEuler(const float *pQ, float *pRoll, float *pPitch, float *pYaw)
+{
+    float w = pQ[0], x = pQ[1], y = pQ[2], z = pQ[3];
+    float fSinP = 2.0f * (w * y - z * x);
+
+    /* Roll (x-axis rotation) */
+    *pRoll = atan2f(2.0f * (w * x + y * z), 1.0f - 2.0f * (x * x + y * y)) * RAD_TO_DEG;
+
+    /* Pitch (y-axis rotation), 90 degrees if out of range */
+    if (fabsf(fSinP) >= 1.0f) {
+        *pPitch = copysignf(PI / 2.0f, fSinP) * RAD_TO_DEG;
+    } else {
+        *pPitch = asinf(fSinP) * RAD_TO_DEG;
+    }
+
+    /* Yaw (z-axis rotation) */
+    *pYaw = atan2f(2.0f * (w * z + x * y), 1.0f - 2.0f * (y * y + z * z)) * RAD_TO_DEG;
+}
+
+/**
+ * @brief Spherical interpolation between two unit quaternions [w, x, y, z]
+ * @param fT 0: pQa, 1: pQb (shortest path)
+ */
+void QuatSlerp(const float *pQa, const float *pQb, float fT, float *pQ)
+{
+    float fDot = pQa[0] * pQb[0] + pQa[1] * pQb[1] + pQa[2] * pQb[2] + pQa[3] * pQb[3];
+    float fSign = 1.0f;
+    float fWa, fWb, fTheta, fSin, fNorm;
+    UInt32 i;
+
+    if (fDot < 0.0f) {
+        fDot = -fDot;
+        fSign = -1.0f;
+    }
+
+    if (fDot > 0.9995f) {
+        /* Nearly parallel: normalised linear interpolation */
+        fWa = 1.0f - fT;
+        fWb = fT;
+    } else {
+        fTheta = acosf(fDot);
+        fSin = sinf(fTheta);
+        fWa = sinf((1.0f - fT) * fTheta) / fSin;
+        fWb = sinf(fT * fTheta) / fSin;
+    }
+    fWb *= fSign;
+
+    for (i = 0; i < 4; i++) {
+        pQ[i] = fWa * pQa[i] + fWb * pQb[i];
+    }
+
+    fNorm = 1.0f / sqrtf(pQ[0] * pQ[0] + pQ[1] * pQ[1] + pQ[2] * pQ[2] + pQ[3] * pQ[3]);
+    for (i = 0; i < 4; i++) {
+        pQ[i] *= fNorm;
+    }
+}
+
+/**
+ * @brief Latest propagated attitude (TxTask)
+ * @return UInt32 1: initialised from TPVAW, 0: relative to power-up attitude
+ */
+UInt32 StrapdownGetEuler(float *pRoll, float *pPitch, float *pYaw)
+{
+    float fQ[4];
+    UInt32 uiAligned;
+
+    taskENTER_CRITICAL();
+    memcpy(fQ, fSdPubQ, sizeof(fQ));
+    uiAligned = uiSdAligned;
+    taskEXIT_CRITICAL();
+
+    QuatToEuler(fQ, pRoll, pPitch, pYaw);
+
+    return uiAligned;
+}
+
+/**
+ * @brief Print attitude and per-sample cost (DBG "att")
+ */
+void StrapdownReport(void)
+{
+    StrapdownStats_t stStats = stSdStats;
+    float fRoll, fPitch, fYaw;
+    UInt32 uiAligned = StrapdownGetEuler(&fRoll, &fPitch, &fYaw);
+
+    xil_printf("[ATT] %s Roll=", uiAligned ? "TPVAW" : "no-init");
+    PrintFloat(fRoll);
+    xil_printf(" Pitch=");
+    PrintFloat(fPitch);
+    xil_printf(" Yaw=");
+    PrintFloat(fYaw);
+    xil_printf("\r\n");
+
+    xil_printf("[ATT] %u samples / %u batches: avg %u ns, max %u ns per sample (budget %u ns, over %u)\r\n",
+        stStats.uiSamples, stStats.uiBatches,
+        (UInt32)((stStats.uiSamples != 0) ? (stStats.ullSumNs / stStats.uiSamples) : 0),
+        stStats.uiMaxNs, STRAPDOWN_BUDGET_NS, stStats.uiOverBudget);
+}
+
+/**
+ * @brief Time the propagation on a constant 10 deg/s yaw rate (DBG "attbench <samples>")
+ */
+void StrapdownBenchmark(UInt32 uiSamples)
+{
+    static ImuData_t stBatch[IMU_BATCH_MAX];
+    StrapdownState_t stSt = { { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, 0 };
+    XTime xStart, xEnd;
+    UInt64 ullNs;
+    UInt32 uiDone, uiChunk, i;
+    float fRoll, fPitch, fYaw, fExpYaw;
+
+    if (uiSamples == 0) uiSamples = IMU_RATE_HZ;
+
+    memset(stBatch, 0, sizeof(stBatch));
+    for (i = 0; i < IMU_BATCH_MAX; i++) {
+        stBatch[i].fGyroZ = 10.0f;
+    }
+
+    XTime_GetTime(&xStart);
+    for (uiDone = 0; uiDone < uiSamples; uiDone += uiChunk) {
+        uiChunk = ((uiSamples - uiDone) < IMU_BATCH_MAX) ? (uiSamples - uiDone) : IMU_BATCH_MAX;
+        StrapdownStep(&stSt, stBatch, uiChunk);
+    }
+    XTime_GetTime(&xEnd);
+
+    ullNs = ((UInt64)(xEnd - xStart) * 1000000000ULL) / COUNTS_PER_SECOND;
+
+    /* Expected yaw wrapped to (-180, 180] */
+    fExpYaw = fmodf(10.0f * ((float)uiSamples * STRAPDOWN_DT), 360.0f);
+    if (fExpYaw > 180.0f) fExpYaw -= 360.0f;
+    QuatToEuler(stSt.fQ, &fRoll, &fPitch, &fYaw);
+
+    xil_printf("[ATT] %u samples: %u ns/sample (budget %u), %u.%03u %% CPU at %u Hz, yaw ",
+        uiSamples, (UInt32)(ullNs / uiSamples), STRAPDOWN_BUDGET_NS,
+        (UInt32)((ullNs * IMU_RATE_HZ / uiSamples) / 10000000ULL),
+        (UInt32)(((ullNs * IMU_RATE_HZ / uiSamples) / 10000ULL) % 1000ULL), IMU_RATE_HZ);
+    PrintFloat(fYaw);
+    xil_printf(" (expected ");
+    PrintFloat(fExpYaw);
+    xil_printf(") -> %s\r\n", (fabsf(fYaw - fExpYaw) < 0.01f) ? "OK" : "MISMATCH");
+}
@@ -0,0 +1,292 @@
+/**
+ * @file timesync.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief GPS Time Correlation and CCSDS Time Stamps Source
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "../Inc/timesync.h"
+#include "task.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+#include <string.h>
+#include <math.h>
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define TIME_NS_PER_SEC     1000000000LL
+#define TIME_NS_PER_COUNT   (1.0e9 / (double)COUNTS_PER_SECOND)
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+/* Working model / statistics, owned by IgnuTask */
+static TimeSyncModel_t stTsWork = { 0, 0, 0.0, 0, TIME_STATE_FREE, 0 };
+static TimeSyncStats_t stTsStats;
+
+/* Published model (critical section) */
+static TimeSyncModel_t stTsPub = { 0, 0, 0.0, 0, TIME_STATE_FREE, 0 };
+
+/* Sample-to-TM latency, written by TxTask only (read by DBG under critical section) */
+static TimeLatency_t stTsLat[TIME_LAT_NUM];
+
+static const char * const pTsStateName[] = { "FREE", "COARSE", "LOCKED", "HOLDOVER" };
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static SInt64 TimeSyncModelGps(const TimeSyncModel_t *pModel, UInt64 ullStamp);
+static void TimeSyncGet(TimeSyncModel_t *pModel);
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @brief Model GPS time (ns) at an XTime value
+ */
+static SInt64 TimeSyncModelGps(const TimeSyncModel_t *pModel, UInt64 ullStamp)
+{
+    double dNs = (double)(SInt64)(ullStamp - pModel->ullRefStamp) * TIME_NS_PER_COUNT;
+
+    return pModel->sllRefGpsNs + (SInt64)(dNs * (1.0 + pModel->dDrift));
+}
+
+static void TimeSyncGet(TimeSyncModel_t *pModel)
+{
+    taskENTER_CRITICAL();
+    *pModel = stTsPub;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Steer the model to a GPS fix (IgnuTask)
+ * @param pGps Decoded fix
+ * @param ullArrival XTime at which the fix was decoded
+ */
+void TimeSyncGpsPost(const GpsData_t *pGps, UInt64 ullArrival)
+{
+    TimeSyncModel_t *pM = &stTsWork;
+    UInt64 ullEpoch;
+    SInt64 sllMeas, sllPred, sllRes, sllAbs;
+    double dDtNs;
+
+    /* PVT time valid: no error, a position mode, TOW / WNc not "do-not-use" */
+    if ((pGps->error != 0) || ((pGps->mode & 0x0F) == 0) || (pGps->tow == 0xFFFFFFFFU) || (pGps->wnc == 0xFFFF)) {
+        stTsStats.uiReject++;
+        return;
+    }
+
+    /* Fix epoch on the XTime axis: remove receiver output latency (0.1 ms) and pipeline delay */
+    ullEpoch = ullArrival
+        - (((UInt64)pGps->latency * COUNTS_PER_SECOND) / 10000ULL)
+        - (((UInt64)TIME_SYNC_PIPE_US * COUNTS_PER_SECOND) / 1000000ULL);
+
+    /* GPS time of the epoch: receiver time minus receiver clock bias (ms) */
+    sllMeas = (((SInt64)pGps->wnc * TIME_WEEK_MS) + (SInt64)pGps->tow) * TIME_NS_PER_MS;
+    if (fabs(pGps->rxClkBias) < 1000.0) sllMeas -= (SInt64)(pGps->rxClkBias * (double)TIME_NS_PER_MS);
+
+    if (pM->uiState == TIME_STATE_FREE) {
+        sllRes = 0;
+        sllPred = sllMeas;
+    } else {
+        if (ullEpoch <= pM->ullRefStamp) {
+            stTsStats.uiReject++;
+            return;
+        }
+        sllPred = TimeSyncModelGps(pM, ullEpoch);
+        sllRes = sllMeas - sllPred;
+    }
+    sllAbs = (sllRes < 0) ? -sllRes : sllRes;
+
+    if ((pM->uiState == TIME_STATE_FREE) || (sllAbs > TIME_SYNC_STEP_NS)) {
+        /* First fix or jump: restart from this fix, keep the drift estimate */
+        pM->sllRefGpsNs = sllMeas;
+        pM->uiGood = 0;
+        pM->uiState = TIME_STATE_COARSE;
+        stTsStats.uiStep++;
+    } else {
+        dDtNs = (double)(SInt64)(ullEpoch - pM->ullRefStamp) * TIME_NS_PER_COUNT;
+
+        pM->sllRefGpsNs = sllPred + (SInt64)(TIME_SYNC_ALPHA * (double)sllRes);
+        pM->dDrift += TIME_SYNC_BETA * (double)sllRes / dDtNs;
+        if (pM->dDrift > TIME_SYNC_DRIFT_MAX) pM->dDrift = TIME_SYNC_DRIFT_MAX;
+        else if (pM->dDrift < -TIME_SYNC_DRIFT_MAX) pM->dDrift = -TIME_SYNC_DRIFT_MAX;
+
+        if (sllAbs < TIME_SYNC_LOCK_NS) {
+            if (pM->uiGood < TIME_SYNC_LOCK_CNT) pM->uiGood++;
+        } else {
+            pM->uiGood = 0;
+        }
+        pM->uiState = (pM->uiGood >= TIME_SYNC_LOCK_CNT) ? TIME_STATE_LOCKED : TIME_STATE_COARSE;
+
+        if ((pM->uiState == TIME_STATE_LOCKED) && ((UInt32)sllAbs > stTsStats.uiMaxResNs)) {
+            stTsStats.uiMaxResNs = (UInt32)sllAbs;
+        }
+    }
+    pM->ullRefStamp = ullEpoch;
+    pM->ullLastFix = ullEpoch;
+
+    stTsStats.siLastResNs = (SInt32)sllRes;
+    stTsStats.uiFix++;
+
+    taskENTER_CRITICAL();
+    stTsPub = *pM;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief GPS time at an XTime value
+ * @param pGpsNs ns since the GPS epoch (TIME_STATE_FREE: ns since power-up)
+ * @return UInt32 TIME_STATE_xxx
+ */
+UInt32 TimeSyncToGps(UInt64 ullStamp, SInt64 *pGpsNs)
+{
+    TimeSyncModel_t stM;
+
+    TimeSyncGet(&stM);
+
+    if (stM.uiState == TIME_STATE_FREE) {
+        *pGpsNs = (SInt64)((double)ullStamp * TIME_NS_PER_COUNT);
+        return TIME_STATE_FREE;
+    }
+
+    *pGpsNs = TimeSyncModelGps(&stM, ullStamp);
+
+    if ((ullStamp > stM.ullLastFix) &&
+        ((ullStamp - stM.ullLastFix) > (((UInt64)TIME_SYNC_HOLD_MS * COUNTS_PER_SECOND) / 1000ULL))) {
+        return TIME_STATE_HOLDOVER;
+    }
+
+    return stM.uiState;
+}
+
+/**
+ * @brief XTime value at a GPS time
+ * @return SInt32 0 on success, -1 before the first fix
+ */
+SInt32 TimeSyncGpsToStamp(SInt64 sllGpsNs, UInt64 *pStamp)
+{
+    TimeSyncModel_t stM;
+    double dCounts;
+
+    TimeSyncGet(&stM);
+    if (stM.uiState == TIME_STATE_FREE) return -1;
+
+    dCounts = ((double)(sllGpsNs - stM.sllRefGpsNs) / (1.0 + stM.dDrift)) / TIME_NS_PER_COUNT;
+    *pStamp = stM.ullRefStamp + (UInt64)(SInt64)dCounts;
+
+    return 0;
+}
+
+/**
+ * @brief XTime value at a GPS time of week (week nearest to the model time)
+ * @return SInt32 0 on success, -1 before the first fix
+ */
+SInt32 TimeSyncTowToStamp(UInt32 uiTowMs, UInt64 *pStamp)
+{
+    TimeSyncModel_t stM;
+    SInt64 sllRefMs, sllMs;
+
+    TimeSyncGet(&stM);
+    if (stM.uiState == TIME_STATE_FREE) return -1;
+
+    sllRefMs = stM.sllRefGpsNs / TIME_NS_PER_MS;
+    sllMs = ((sllRefMs / TIME_WEEK_MS) * TIME_WEEK_MS) + (SInt64)uiTowMs;
+    if ((sllMs - sllRefMs) > (TIME_WEEK_MS / 2)) sllMs -= TIME_WEEK_MS;
+    else if ((sllMs - sllRefMs) < -(TIME_WEEK_MS / 2)) sllMs += TIME_WEEK_MS;
+
+    return TimeSyncGpsToStamp(sllMs * TIME_NS_PER_MS, pStamp);
+}
+
+/**
+ * @brief CCSDS CUC (4 + 2 bytes, big endian) for an XTime value
+ * @return UInt32 TIME_STATE_xxx of the time written
+ */
+UInt32 TimeSyncCuc(UInt64 ullStamp, UInt8 *pCuc)
+{
+    SInt64 sllNs;
+    UInt32 uiState = TimeSyncToGps(ullStamp, &sllNs);
+    UInt32 uiSec, uiFine;
+
+    if (sllNs < 0) sllNs = 0;
+
+    uiSec = (UInt32)(sllNs / TIME_NS_PER_SEC);
+    uiFine = (UInt32)(((UInt64)(sllNs % TIME_NS_PER_SEC) << 16) / (UInt64)TIME_NS_PER_SEC);
+
+    pCuc[0] = (uiSec >> 24) & 0xFF;
+    pCuc[1] = (uiSec >> 16) & 0xFF;
+    pCuc[2] = (uiSec >> 8) & 0xFF;
+    pCuc[3] = uiSec & 0xFF;
+    pCuc[4] = (uiFine >> 8) & 0xFF;
+    pCuc[5] = uiFine & 0xFF;
+
+    return uiState;
+}
+
+/**
+ * @brief Record a sample-to-TM latency (TxTask only, periodic Test Data TM)
+ */
+void TimeSyncLatency(UInt32 uiSrc, UInt64 ullSample, UInt64 ullSent)
+{
+    TimeLatency_t *pLat;
+    UInt32 uiUs;
+
+    if ((uiSrc >= TIME_LAT_NUM) || (ullSent < ullSample)) return;
+
+    pLat = &stTsLat[uiSrc];
+    uiUs = (UInt32)((ullSent - ullSample) / (COUNTS_PER_SECOND / 1000000));
+
+    taskENTER_CRITICAL();
+    if ((pLat->uiCnt == 0) || (uiUs < pLat->uiMinUs)) pLat->uiMinUs = uiUs;
+    if (uiUs > pLat->uiMaxUs) pLat->uiMaxUs = uiUs;
+    pLat->ullSumUs += uiUs;
+    pLat->uiCnt++;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Print model state, loop residuals and latencies (DBG "time")
+ */
+void TimeSyncReport(void)
+{
+    static const char * const pLatName[TIME_LAT_NUM] = { "GPS fix", "IMU    " };
+    TimeSyncModel_t stM;
+    TimeSyncStats_t stStats = stTsStats;
+    TimeLatency_t stLat[TIME_LAT_NUM];
+    XTime xNow;
+    SInt64 sllNs;
+    UInt32 uiState, i;
+
+    XTime_GetTime(&xNow);
+    uiState = TimeSyncToGps((UInt64)xNow, &sllNs);
+    TimeSyncGet(&stM);
+
+    if (uiState == TIME_STATE_FREE) {
+        xil_printf("[TIME] FREE: %u.%06u s since power-up\r\n",
+            (UInt32)(sllNs / TIME_NS_PER_SEC), (UInt32)((sllNs % TIME_NS_PER_SEC) / 1000));
+    } else {
+        xil_printf("[TIME] %s: week %u TOW %u.%03u ms, drift %d ppb\r\n", pTsStateName[uiState],
+            (UInt32)((sllNs / TIME_NS_PER_MS) / TIME_WEEK_MS), (UInt32)((sllNs / TIME_NS_PER_MS) % TIME_WEEK_MS),
+            (UInt32)((sllNs % TIME_NS_PER_MS) / 1000), (int)(stM.dDrift * 1.0e9));
+    }
+    xil_printf("[TIME] fix %u, reject %u, step %u, last residual %d ns, max locked %u ns\r\n",
+        stStats.uiFix, stStats.uiReject, stStats.uiStep, (int)stStats.siLastResNs, stStats.uiMaxResNs);
+
+    taskENTER_CRITICAL();
+    memcpy(stLat, stTsLat, sizeof(stLat));
+    taskEXIT_CRITICAL();
+
+    for (i = 0; i < TIME_LAT_NUM; i++) {
+        if (stLat[i].uiCnt == 0) continue;
+        xil_printf("[TIME] %s -> TM (%u) us: min %u avg %u max %u\r\n", pLatName[i], stLat[i].uiCnt,
+            stLat[i].uiMinUs, (UInt32)(stLat[i].ullSumUs / stLat[i].uiCnt), stLat[i].uiMaxUs);
+    }
+}
@@ -0,0 +1,273 @@
+/**
+ * @file tmsched.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Multi-Rate Telemetry Scheduler Source
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "../Inc/tmsched.h"
+#include "../Inc/TMTC.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+/* Link bytes per packet besides user data: CCSDS (18 + CRC 2), CSP (4 + CRC 4), KISS (4) */
+#define TM_PKT_OVERHEAD     32
+
+/* Every product must fit one burst packet (SendCcsdsTmBurst does not segment) */
+#if TM_PROD_BUF > CCSDS_SEG_DATA_MAX
+#error "TM_PROD_BUF exceeds CCSDS_SEG_DATA_MAX"
+#endif
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+static TmProduct_t stTmProd[TM_PROD_MAX];
+static UInt8 ucTmBuf[TM_PROD_MAX][TM_PROD_BUF] __attribute__((aligned(8)));
+
+/* Tick counter, written by TxTask only */
+static volatile UInt32 uiTmTick = 0;
+static TmSchedStats_t stTmStats;
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static UInt32 TmGcd(UInt32 a, UInt32 b);
+static UInt32 TmAutoPhase(UInt32 uiProd, UInt32 uiPeriod);
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+static UInt32 TmGcd(UInt32 a, UInt32 b)
+{
+    UInt32 t;
+
+    while (b != 0) {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/**
+ * @brief Phase with the fewest expected bytes coinciding with other products
+ *
+ * Two products with periods P, Q and phases p, q meet once every lcm(P, Q)
+ * ticks if p == q (mod gcd(P, Q)), never otherwise. The cost of a phase is
+ * the sum over the enabled products of their packet size per meeting tick.
+ */
+static UInt32 TmAutoPhase(UInt32 uiProd, UInt32 uiPeriod)
+{
+    TmProduct_t *pQ;
+    UInt32 uiSearch = (uiPeriod < TM_PHASE_SEARCH) ? uiPeriod : TM_PHASE_SEARCH;
+    UInt32 uiPhase, uiBest = 0;
+    UInt32 q, uiG;
+    float fCost, fBest = 0.0f;
+
+    for (uiPhase = 0; uiPhase < uiSearch; uiPhase++) {
+        fCost = 0.0f;
+        for (q = 0; q < TM_PROD_MAX; q++) {
+            pQ = &stTmProd[q];
+            if ((q == uiProd) || (pQ->pfnBuild == NULL) || (pQ->uiPeriod == 0)) continue;
+
+            uiG = TmGcd(uiPeriod, pQ->uiPeriod);
+            if ((uiPhase % uiG) == (pQ->uiPhase % uiG)) {
+                fCost += (float)(pQ->uiLen + TM_PKT_OVERHEAD) * (float)uiG / ((float)uiPeriod * (float)pQ->uiPeriod);
+            }
+        }
+
+        if ((uiPhase == 0) || (fCost < fBest)) {
+            fBest = fCost;
+            uiBest = uiPhase;
+            if (fCost == 0.0f) break;
+        }
+    }
+    return uiBest;
+}
+
+/**
+ * @brief Register a periodic TM product (TmtcInit, before the tasks start)
+ * @param uiLen Expected user data length (auto phase weight until the first report), up to TM_PROD_BUF
+ * @return SInt32 TM_SCHED_OK or TM_SCHED_ERR_xxx
+ */
+SInt32 TmSchedRegister(UInt32 uiProd, UInt8 ucSvc, UInt8 ucSub, TmBuild_t pfnBuild, UInt32 uiLen,
+                       UInt32 uiRunOnly, UInt32 uiPeriodMs, UInt32 uiPhaseMs, const char *pName)
+{
+    TmProduct_t *pProd;
+
+    if ((uiProd >= TM_PROD_MAX) || (pfnBuild == NULL)) return TM_SCHED_ERR_PROD;
+    if (uiLen > TM_PROD_BUF) return TM_SCHED_ERR_LEN;
+
+    pProd = &stTmProd[uiProd];
+    memset(pProd, 0, sizeof(TmProduct_t));
+    pProd->pName = pName;
+    pProd->ucSvc = ucSvc;
+    pProd->ucSub = ucSub;
+    pProd->ucRunOnly = (uiRunOnly != 0) ? 1 : 0;
+    pProd->uiLen = uiLen;
+    pProd->pfnBuild = pfnBuild;
+
+    return TmSchedSetRate(uiProd, uiPeriodMs, uiPhaseMs);
+}
+
+/**
+ * @brief Change the period / phase of a product (TC handler, DBG)
+ * @param uiPeriodMs 0 disables the product, otherwise a multiple of TM_SCHED_TICK_MS
+ * @param uiPhaseMs Offset within the period, TM_PHASE_AUTO: least loaded
+ * @return SInt32 TM_SCHED_OK or TM_SCHED_ERR_xxx
+ */
+SInt32 TmSchedSetRate(UInt32 uiProd, UInt32 uiPeriodMs, UInt32 uiPhaseMs)
+{
+    TmProduct_t *pProd;
+    UInt32 uiPeriod, uiPhase, uiNext;
+
+    if ((uiProd >= TM_PROD_MAX) || (stTmProd[uiProd].pfnBuild == NULL)) return TM_SCHED_ERR_PROD;
+    pProd = &stTmProd[uiProd];
+
+    if ((uiPeriodMs > TM_PERIOD_MAX_MS) || ((uiPeriodMs % TM_SCHED_TICK_MS) != 0)) return TM_SCHED_ERR_RATE;
+    uiPeriod = uiPeriodMs / TM_SCHED_TICK_MS;
+
+    if (uiPeriod == 0) {
+        uiPhase = 0;
+    } else if (uiPhaseMs == TM_PHASE_AUTO) {
+        uiPhase = TmAutoPhase(uiProd, uiPeriod);
+    } else {
+        if (((uiPhaseMs % TM_SCHED_TICK_MS) != 0) || (uiPhaseMs >= uiPeriodMs)) return TM_SCHED_ERR_RATE;
+        uiPhase = uiPhaseMs / TM_SCHED_TICK_MS;
+    }
+
+    taskENTER_CRITICAL();
+    if (uiPeriod != 0) {
+        /* First tick after now with (tick mod period) == phase */
+        uiNext = uiTmTick + 1;
+        uiNext += (uiPhase + uiPeriod - (uiNext % uiPeriod)) % uiPeriod;
+        pProd->uiNext = uiNext;
+    }
+    pProd->uiPeriod = uiPeriod;
+    pProd->uiPhase = uiPhase;
+    taskEXIT_CRITICAL();
+
+    return TM_SCHED_OK;
+}
+
+/**
+ * @brief One scheduler tick (TxTask, every TM_SCHED_TICK_MS)
+ * Builds every product due now and sends them as one burst.
+ * @param uiRun 1 while IGNU_STATE_RUN (run-only products are skipped otherwise)
+ */
+void TmSchedTick(UInt32 uiRun)
+{
+    TmPacket_t stPkt[TM_PROD_MAX];
+    UInt8 ucProd[TM_PROD_MAX];
+    TmProduct_t *pProd;
+    UInt32 uiTick, uiDue, uiLate, uiLen;
+    UInt32 uiCnt = 0, uiBytes = 0;
+    UInt32 i, uiNs;
+    XTime xStart, xEnd;
+
+    uiTick = uiTmTick + 1;
+    uiTmTick = uiTick;
+    stTmStats.uiTick = uiTick;
+
+    XTime_GetTime(&xStart);
+
+    for (i = 0; i < TM_PROD_MAX; i++) {
+        pProd = &stTmProd[i];
+        if (pProd->pfnBuild == NULL) continue;
+
+        uiDue = 0;
+        uiLate = 0;
+        taskENTER_CRITICAL();
+        if ((pProd->uiPeriod != 0) && ((SInt32)(uiTick - pProd->uiNext) >= 0)) {
+            uiDue = 1;
+            /* Whole periods missed (stall): skip them, keep the phase */
+            uiLate = (uiTick - pProd->uiNext) / pProd->uiPeriod;
+            pProd->uiNext += (uiLate + 1) * pProd->uiPeriod;
+        }
+        taskEXIT_CRITICAL();
+
+        pProd->uiLate += uiLate;
+        if ((uiDue == 0) || ((pProd->ucRunOnly != 0) && (uiRun == 0))) continue;
+
+        uiLen = pProd->pfnBuild(ucTmBuf[i], TM_PROD_BUF);
+        if (uiLen == 0) continue;
+        if (uiLen > TM_PROD_BUF) {
+            pProd->uiDrop++;        // Builder overran its buffer: not sent
+            continue;
+        }
+        pProd->uiLen = uiLen;
+
+        stPkt[uiCnt].ucSvc = pProd->ucSvc;
+        stPkt[uiCnt].ucSub = pProd->ucSub;
+        stPkt[uiCnt].ucApid = TM_APID_STD;
+        stPkt[uiCnt].ucSeqFlags = CCSDS_SEQ_UNSEG;
+        stPkt[uiCnt].pData = ucTmBuf[i];
+        stPkt[uiCnt].uiLen = uiLen;
+        ucProd[uiCnt] = (UInt8)i;
+        uiBytes += uiLen;
+        uiCnt++;
+    }
+
+    if (uiCnt == 0) return;
+
+    SendCcsdsTmBurst(stPkt, uiCnt);
+
+    for (i = 0; i < uiCnt; i++) {
+        pProd = &stTmProd[ucProd[i]];
+        if (stPkt[i].ucSent != 0) {
+            pProd->uiSent++;
+        } else {
+            pProd->uiDrop++;
+        }
+    }
+
+    XTime_GetTime(&xEnd);
+    uiNs = (UInt32)(((UInt64)(xEnd - xStart) * 1000000000ULL) / COUNTS_PER_SECOND);
+
+    stTmStats.uiBurst++;
+    stTmStats.uiPkt += uiCnt;
+    if (uiCnt > stTmStats.uiMaxPkt) stTmStats.uiMaxPkt = uiCnt;
+    if (uiBytes > stTmStats.uiMaxBytes) stTmStats.uiMaxBytes = uiBytes;
+    if (uiNs > stTmStats.uiMaxNs) stTmStats.uiMaxNs = uiNs;
+}
+
+/**
+ * @brief Product schedule, link load and counters (DBG "tm")
+ */
+void TmSchedReport(void)
+{
+    TmSchedStats_t stStats = stTmStats;
+    TmProduct_t *pProd;
+    UInt32 i, uiBps = 0;
+
+    xil_printf("[TM] tick %u ms, ticks %u, bursts %u, packets %u, max %u pkt / %u B per burst, max %u us\r\n",
+        TM_SCHED_TICK_MS, stStats.uiTick, stStats.uiBurst, stStats.uiPkt,
+        stStats.uiMaxPkt, stStats.uiMaxBytes, stStats.uiMaxNs / 1000);
+
+    for (i = 0; i < TM_PROD_MAX; i++) {
+        pProd = &stTmProd[i];
+        if (pProd->pfnBuild == NULL) continue;
+
+        if (pProd->uiPeriod != 0) {
+            uiBps += ((pProd->uiLen + TM_PKT_OVERHEAD) * 1000) / (pProd->uiPeriod * TM_SCHED_TICK_MS);
+        }
+        xil_printf("  %u %-8s Svc %2d Sub %2d period %6u ms phase %5u ms %3u B%s sent %u, drop %u, late %u\r\n",
+            i, pProd->pName, pProd->ucSvc, pProd->ucSub,
+            pProd->uiPeriod * TM_SCHED_TICK_MS, pProd->uiPhase * TM_SCHED_TICK_MS, pProd->uiLen,
+            (pProd->ucRunOnly != 0) ? " (run)" : "      ",
+            pProd->uiSent, pProd->uiDrop, pProd->uiLate);
+    }
+    xil_printf("[TM] Scheduled load %u B/s\r\n", uiBps);
+}
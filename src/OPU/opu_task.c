@@ -19,7 +19,7 @@
 #include "timers.h"
 #include "semphr.h"
 
-#include "FreeRTOSconfig.h"
+#include "FreeRTOSConfig.h"
 
 /* --- Xilinx includes --- */
 #include "xil_printf.h"
@@ -34,7 +34,13 @@
 /* --- User includes --- */
 #include "opu_task.h"
 #include "../common/common.h"
+#include "../common/bramio.h"		// BRAM_OK / BRAM_ERR_RANGE
+#include "../common/copyeng.h"		// BRAM -> DDR 񵿱 
 #include "../IGNU/Inc/ignu_task.h" // IMU ť ڵ 
+#include "../IGNU/Inc/ins_gps.h"	// IMU Full-rate 
+#include "../IGNU/Inc/strapdown.h"	// IMU ӵ ڼ 
+#include "../IGNU/Inc/navfilter.h"	// GPS/INS ׹ 
+#include "../IGNU/Inc/history.h"	//  ð ̷ 
 
 /*==============================================================================
  * Gloabal Function
@@ -52,9 +58,9 @@ sRingBufInfo stGpsRbRx;						// GPS RX Ring Buffer 
 sRingBufInfo stRbStim;						// IMU RX Ring Buffer 
 sRingBufInfo stRbInfoUart[MAX_UART_CH];		// UART Channel 1~6 TX Ring Buffer 
 
-UInt8 ucGpsRbRx[MAX_RB_IDX][MAX_RB_DATA];				// GPS RX 
-UInt8 ucImuRbRx[MAX_RB_IDX][MAX_RB_DATA];				// GPS RX 
-UInt8 ucRbUart[MAX_UART_CH][MAX_RB_IDX][MAX_RB_DATA];	// UART 3
+UInt8 ucGpsRbRx[RB_SIZE_GPS] __attribute__((aligned(4)));				// GPS RX 
+UInt8 ucImuRbRx[RB_SIZE_IMU] __attribute__((aligned(4)));				// IMU RX 
+UInt8 ucRbUart[MAX_UART_CH][RB_SIZE_UART] __attribute__((aligned(4)));	// UART 
 
 sRbData stGpsRbData;
 sRbData stImuRbData;
@@ -71,6 +77,29 @@ static TaskHandle_t xImuTask;		// IMU task handler
 
 /* --- Semaphore  --- */
 static xSemaphoreHandle xSemaphore = NULL;		// 20ms  
+static SemaphoreHandle_t xUartTxLock[MAX_UART_CH];	// äκ TX  producer ȭ (SerialTxLock)
+
+/* --- UART   --- */
+static const UInt32 uiUartRxBram[MAX_UART_CH] =
+{
+	BRAM_ADDR_RE_UART_01, BRAM_ADDR_RE_UART_02, BRAM_ADDR_RE_UART_03,
+	BRAM_ADDR_RE_UART_04, BRAM_ADDR_RE_UART_05, BRAM_ADDR_RE_UART_06
+};
+static sUartRxStat stUartRxStat[MAX_UART_CH];		// äκ  
+static sRbData *pCom1RxBlk = NULL;					// COM1    (uart_thread )
+static CopyDesc_t stCom1Copy[UART_COM1_COPY_MAX];	// COM1  ->   ( )
+static UInt32 uiCom1CopyCnt = 0;					// stCom1Copy  
+static UInt32 uiCom1Size = 0;						//  ũ ( Ϸ  usSize ,    Write )
+
+/* --- LVDS   ( ߰ : ׸ ߰) --- */
+static const sSlotDesc stSlotDesc[] =
+{
+	/* ̸,		BRAM  ּ,			Write  Offset,	Ŷ ũ,		Ŷ ,			,		ó Task */
+	{ "LVDS1 GPS",	BRAM_ADDR_RE_SLOT_01,	SLOT_INFO_OFS_64K,	GPS_BRAM_SIZE,	GPS_BRAM_PACKET,	&stGpsRbRx,	&xGpsTask },
+	{ "LVDS2 IMU",	BRAM_ADDR_RE_SLOT_02,	SLOT_INFO_OFS_64K,	IMU_BRAM_SIZE,	IMU_BRAM_PACKET,	&stRbStim,	&xImuTask },
+};
+#define SLOT_RX_NUM		(sizeof(stSlotDesc) / sizeof(stSlotDesc[0]))
+static sSlotStat stSlotStat[SLOT_RX_NUM];			// Ժ  / (OpuTask )
 
 
 /*==============================================================================
@@ -84,13 +113,7 @@ static void ExtIrq_Handler(void *InstancePtr);			// 
 
 /* --- ɸ   --- */
 static void ModuleDataRead( void );						// ׹    Read
-static void Slot1DataRead( UInt8 *pBramInfoData );		// SLOT#1   Read
-static void Slot2DataRead( UInt8 *pBramInfoData );		// SLOT#2   Read
-static void Slot3DataRead( UInt8 *pBramInfoData );		// SLOT#3   Read
-static void Slot4DataRead( UInt8 *pBramInfoData );		// SLOT#4   Read
-static void Slot5DataRead( UInt8 *pBramInfoData );		// SLOT#5   Read
-static void Slot6DataRead( UInt8 *pBramInfoData );		// SLOT#5   Read
-static void Slot7DataRead( UInt8 *pBramInfoData );		// SLOT#5   Read
+static UInt32 SlotIngest( const sSlotDesc *pDesc, sSlotStat *pStat );		// LVDS  BRAM  
 
 /* --- queue  --- */
 static SInt32 DdrEnqueue( UInt32 *pBuf, sRingBufInfo *pRingBufInfo, UInt32 uiLen );		// Ring Buffer enqueue
@@ -99,13 +122,16 @@ static SInt32 SerialDequeue( sRbData *pRbData, sRingBufInfo *pRingBufInfo );			/
 
 /* ---   --- */
 static void RingBufferInit( void );
-static void DdrRingBufferInit( sRingBufInfo *pRingBufInfo );							// Ring Buffer ʱȭ
 
 /* --- Processing   --- */
 static void SemaphoreCreate( void );
 static float GetZynqTemperature( void );														// µ  Լ
-static void UartRead( UInt32 uiComAddr, SInt8 *pWrAddrBefore, sRingBufInfo *pRingBufInfo );		// UART(RS422) Read Լ
-static UInt8 UartBramRead( UInt32 uiChannel, UInt8 *pRecvBuf, SInt8 *pBramWrAddrBefore );		// UART(RS422) BRAM Read Լ
+static void UartRead( UInt32 uiCh, SInt8 *pWrAddrBefore );										// UART(RS422) Read Լ
+static UInt32 UartBramRead( UInt32 uiCh, volatile UInt8 *pBram, SInt8 *pBramWrAddrBefore, sUartRxStat *pStat, UartRxSink_t pfnSink );	// UART(RS422) BRAM Drain Լ
+static void UartRxDeliver( UInt32 uiCh, const UInt8 *pData, UInt32 uiLen );						// UART(RS422)   ó
+static void UartCom1Append( const UInt8 *pData, UInt32 uiLen );									// COM1  Ʈ 
+static void UartCom1Flush( void );																// COM1   IGNU 
+static void UartCom1CopyWait( void );															// COM1 񵿱  Ϸ 
 static void UartWrite( UInt32 uiChannel, UInt8 *pSendBuf, UInt32 uiSize );						// UART(RS422) Write Լ
 
 /* --- Thread Լ  --- */
@@ -139,40 +165,27 @@ static float GetZynqTemperature( void )
 
 /**
  * @fn		DdrEnqueue
- * @brief	DDR3 Ring Buffer write Լ
+ * @brief	DDR3 Ring Buffer write Լ (SPSC, producer )
  * @param	UInt8 *pBuf : write  
  * @param	sRingBufInfo *pRingBufInfo : Ring Buffer 
- * @return	Ring Buffer  (-1: Ring buffer is full, 1 : Normal)
+ * @param	UInt32 uiLen : write  ũ
+ * @return	Ring Buffer  (-1: Ring buffer is full (ű  ), 0 : Normal)
  * @date	2023/02/03
  */
 static SInt32 DdrEnqueue( UInt32 *pBuf, sRingBufInfo *pRingBufInfo, UInt32 uiLen )
 {
-	SInt32 ucSts = 0;				// -1: Ring buffer is full, 1 : Normal
-	volatile UInt32 *pAddr = (volatile UInt32 *)pRingBufInfo->uiAddr;
-
-	if( pRingBufInfo->siCount == MAX_RB_IDX )
+	if( uiLen > MAX_RB_DATA )
 	{
-		/* Ring buffer is full */
-		/*    */
-		pRingBufInfo->siFront = (pRingBufInfo->siFront+1)%MAX_RB_IDX;
-		pRingBufInfo->siCount--;
-		ucSts = -1;
-	}
-	else
-	{
-		/* BRAM to DDR3 write */
-		memcpy( &pAddr[pRingBufInfo->siRear*(MAX_RB_DATA/4)+1], pBuf, (uiLen+(4-uiLen%4)) );
-		pAddr[pRingBufInfo->siRear*(MAX_RB_DATA/4)] = uiLen;
-		pRingBufInfo->siRear = (pRingBufInfo->siRear+1)%MAX_RB_IDX;
-		pRingBufInfo->siCount++;
+		return -1;
 	}
 
-	return ucSts;
+	/* BRAM to DDR3 write */
+	return RingBufPush( pRingBufInfo, pBuf, uiLen );
 }
 
 /**
  * @fn		DdrDequeue
- * @brief	DDR3 Ring Buffer Read Լ
+ * @brief	DDR3 Ring Buffer Read Լ (SPSC, consumer )
  * @param	UInt8 *pBuf : Read  
  * @param	sRingBufInfo *pRingBufInfo : Ring Buffer 
  * @return	Ring Buffer  (-1: Ring buffer is Empty, 0~ : Message Count)
@@ -180,34 +193,21 @@ static SInt32 DdrEnqueue( UInt32 *pBuf, sRingBufInfo *pRingBufInfo, UInt32 uiLen
  */
 static SInt32 DdrDequeue( sRbData *pRbData, sRingBufInfo *pRingBufInfo )
 {
-	SInt32 ucSts;																// -1: Ring buffer is Empty, 0~ : Message Count
-	volatile UInt8 *pAddr = (volatile UInt8 *)pRingBufInfo->uiAddr;
-
-	UInt32 *pData = (UInt32 *)pAddr+pRingBufInfo->siFront*(MAX_RB_DATA/4);		// 4byte  
+	SInt32 ucSts;
+	UInt32 uiLen = 0;
 
-	if( pRingBufInfo->siCount == 0 )
+	ucSts = RingBufPop( pRingBufInfo, pRbData->ucData, MAX_RB_DATA, &uiLen );
+	if( ucSts >= 0 )
 	{
-		ucSts = -1;
+		pRbData->usSize = uiLen;
 	}
-	else
-	{
-		/* ޽  Ȯ */
-
-		pRbData->usSize = *pData;
 
-		/* BRAM to DDR3 read */
-		memcpy( pRbData->ucData, &pAddr[pRingBufInfo->siFront*MAX_RB_DATA+4], pRbData->usSize );
-		pRingBufInfo->siFront = (pRingBufInfo->siFront+1)%MAX_RB_IDX;
-		pRingBufInfo->siCount--;
-
-		ucSts = pRingBufInfo->siCount;
-	}
 	return ucSts;
 }
 
 /**
- * @fn		DdrDequeue
- * @brief	DDR3 Ring Buffer Read Լ
+ * @fn		SerialDequeue
+ * @brief	RS422 TX Ring Buffer Read Լ (SPSC, consumer )
  * @param	UInt8 *pBuf : Read  
  * @param	sRingBufInfo *pRingBufInfo : Ring Buffer 
  * @return	Ring Buffer  (-1: Ring buffer is Empty, 0~ : Message Count)
@@ -215,255 +215,162 @@ static SInt32 DdrDequeue( sRbData *pRbData, sRingBufInfo *pRingBufInfo )
  */
 static SInt32 SerialDequeue( sRbData *pRbData, sRingBufInfo *pRingBufInfo )
 {
-	SInt32 ucSts;																// -1: Ring buffer is Empty, 0~ : Message Count
-	volatile UInt8 *pAddr = (volatile UInt8 *)pRingBufInfo->uiAddr;
-
-	UInt32 *pData = (UInt32 *)pAddr+pRingBufInfo->siFront*(MAX_RB_DATA/4);		// 4byte  
-
-	if( pRingBufInfo->siCount == 0 )
-	{
-		ucSts = -1;
-	}
-	else
-	{
-		/* ޽  Ȯ */
-
-		pRbData->usSize = *pData;
-
-		/* BRAM to DDR3 read */
-		memcpy( pRbData->ucData, &pAddr[pRingBufInfo->siFront*MAX_RB_DATA+4], pRbData->usSize );
-		pRingBufInfo->siFront = (pRingBufInfo->siFront+1)%MAX_RB_IDX;
-		pRingBufInfo->siCount--;
-
-		ucSts = pRingBufInfo->siCount;
-	}
-	return ucSts;
+	return DdrDequeue( pRbData, pRingBufInfo );
 }
 
 
-/**
- * @fn		DdrRingBufferInit
- * @brief	DDR3 Ring Buffer ʱȭ Լ
- * @param	sRingBufInfo *pRingBufInfo : Ring Buffer 
- * @return	void
- * @date	2023/02/03
- */
-static void DdrRingBufferInit( sRingBufInfo *pRingBufInfo )
-{
-	/* Ring Buffer ʱȭ */
-	pRingBufInfo->siFront = 0;
-	pRingBufInfo->siRear = 0;
-	pRingBufInfo->siCount = 0;
-}
-
+/* UDP  ġ: 32-bit word  + 2 (SlotCopyPayload ) */
+typedef char SlotUdpDataOfsChk[((SLOT_UDP_DATA_OFS & 3) == 2) ? 1 : -1];
 
 /**
- * @fn		GpsPacketRead
- * @brief	BRAM  DDR ϴ Լ
- * @param	UInt32 uiAddr : BRAM  ּ
- * @param	UInt8 *pBramWrIdxBefore :  BRAM Write Index Count (0~255)
- * @param	UInt8 *pBramWrAddrBefore :  BRAM Address Count (0~20)
- * @param	sRingBufInfo *pRingBufInfo : Ring Buffer 
- * @return	BRAM   Count
- * @date	2022/12/19
+ * @fn		SlotCopyPayload
+ * @brief	BRAM Ŷ UDP ͸ ۷ 1ȸ  (ĵ 32-bit Read/Write)
+ * 			UDP Ͱ word  +2  Ƿ  word 2 16-bit  ̾ (Little Endian)
+ * @param	u32 *pDst :    (4byte , 4byte  )
+ * @param	volatile const u32 *pSrc : UDP   word (Ŷ + SLOT_UDP_DATA_OFS - 2)
+ * @param	UInt32 uiLen : UDP  ũ (1~)
+ * @return	void
+ * @date	2026/10/16
  */
-static UInt8 GpsPacketRead( UInt32 uiAddr, UInt8 *pBramWrIdxBefore, UInt8 *pBramWrAddrBefore, UInt8 *pBramInfo )
+static void SlotCopyPayload( u32 *pDst, volatile const u32 *pSrc, UInt32 uiLen )
 {
 	UInt32 i;
-	SInt8 scSts;
-	UInt8 ucRetVal = 0;
+	UInt32 uiWords = (uiLen + 3) >> 2;
+	u32 uiW0 = pSrc[0];
+	u32 uiW1;
 
-	UInt8 ucBramWrIdx;						// BRAM Write  PL Write Index
-	UInt8 ucBramWrAddr;						// BRAM Write  PL Write Address
-
-	UInt8 ucIdxRollCnt;						// Index    īƮ ( IDX -  IDX)
-	UInt8 ucAddrRollCnt;					// Address    īƮ ( Address -  Address)
-
-	UInt32 uiBramReAddr;					// BRAM  Address
-	sModGpsHead stModGpsHead;				//  GPS 
-
-	volatile UInt8 *pBramAddr = (volatile UInt8 *)(uiAddr);				// BRAM  ּ
-
-	/* PL Write Index  Address  */
-	ucBramWrIdx = pBramInfo[1];				// PL Write Index Read (0~255)
-	ucBramWrAddr = pBramInfo[0];			// PL Write Address Read (0~20)
-
-	/* Rolling Count Ȯ */
-	ucIdxRollCnt = ((ucBramWrIdx-*pBramWrIdxBefore)<0)?(ucBramWrIdx-*pBramWrIdxBefore)+MAX_IDX:(ucBramWrIdx-*pBramWrIdxBefore);
-	ucAddrRollCnt = ((ucBramWrAddr-*pBramWrAddrBefore)<0)?(ucBramWrAddr-*pBramWrAddrBefore)+GPS_BRAM_PACKET:(ucBramWrAddr-*pBramWrAddrBefore);
-
-	if( ucIdxRollCnt != ucAddrRollCnt )
-	{
-		/* Buffer Overflow */
-	}
-	else
+	for( i=0; i<(uiWords-1); i++ )
 	{
-		if( ucAddrRollCnt > 0 )
-		{
-			for( i=0; i<ucAddrRollCnt; i++ )
-			{
-				/* BRAM Address Ȯ */
-				uiBramReAddr = ((*pBramWrAddrBefore*GPS_BRAM_SIZE)+(i*GPS_BRAM_SIZE)) % (GPS_BRAM_PACKET*GPS_BRAM_SIZE);
-
-				//memcpy( &stModGpsHead, (pBramAddr+uiBramReAddr), sizeof(sModGpsHead) );
-				memcpy( &stModGpsHead, (pBramAddr+uiBramReAddr), GPS_BRAM_SIZE );
-
-				/* DDR3 ޸ Enqueue */
-				//scSts = DdrEnqueue( &pBramAddr[uiBramReAddr+48], &stGpsRbRx, (stModGpsHead.stIpStructure.usTotalLen-28) );
-				scSts = DdrEnqueue( stModGpsHead.ucData, &stGpsRbRx, (stModGpsHead.stIpStructure.usTotalLen-28) );
-				if( scSts < 0 )
-				{
-					/* ring buffer is full */
-				}
-			}
-
-			/*  Packet Return */
-			ucRetVal = ucAddrRollCnt;
-		}
-		else
-		{
-			/*    */
-		}
+		uiW1 = pSrc[i+1];
+		pDst[i] = (uiW0 >> 16) | (uiW1 << 16);
+		uiW0 = uiW1;
 	}
 
-	/*  BRAM   */
-	*pBramWrIdxBefore = ucBramWrIdx;
-	*pBramWrAddrBefore = ucBramWrAddr;
-
-	return ucRetVal;
+	/*  word:  Ͱ 2byte ϸ  word (   )   */
+	uiW1 = ((uiLen - ((uiWords-1) << 2)) > 2) ? pSrc[uiWords] : 0;
+	pDst[uiWords-1] = (uiW0 >> 16) | (uiW1 << 16);
 }
 
 
 /**
- * @fn		ImuPacketRead
- * @brief	BRAM  DDR ϴ Լ
- * @param	UInt32 uiAddr : BRAM  ּ
- * @param	UInt8 *pBramWrIdxBefore :  BRAM Write Index Count (0~255)
- * @param	UInt8 *pBramWrAddrBefore :  BRAM Address Count (0~20)
- * @param	sRingBufInfo *pRingBufInfo : Ring Buffer 
- * @return	BRAM   Count
- * @date	2023/12/19
+ * @fn		SlotIngest
+ * @brief	LVDS  BRAM   Լ (  )
+ * 			 ֱ  PL   Ŷ UDP ͸  ۷ 
+ * @param	const sSlotDesc *pDesc :  
+ * @param	sSlotStat *pStat :   /
+ * @return	 Ŷ 
+ * @date	2026/10/16
  */
-static UInt8 ImuPacketRead( UInt32 uiAddr, UInt8 *pBramWrIdxBefore, UInt8 *pBramWrAddrBefore, UInt8 *pBramInfo )
+static UInt32 SlotIngest( const sSlotDesc *pDesc, sSlotStat *pStat )
 {
 	UInt32 i;
-	SInt8 scSts;
-	UInt8 ucRetVal = 0;
-
+	UInt32 uiCnt = 0;
+	UInt32 uiInfo;							// BRAM Write  ([7:0] PL Write Address, [15:8] PL Write Index)
 	UInt8 ucBramWrIdx;						// BRAM Write  PL Write Index
 	UInt8 ucBramWrAddr;						// BRAM Write  PL Write Address
-
-	UInt8 ucIdxRollCnt;						// Index    īƮ ( IDX -  IDX)
-	UInt8 ucAddrRollCnt;					// Address    īƮ ( Address -  Address)
-
+	UInt32 uiIdxRollCnt;					// Index    īƮ ( IDX -  IDX)
+	UInt32 uiAddrRollCnt;					// Address    īƮ ( Address -  Address)
 	UInt32 uiBramReAddr;					// BRAM  Address
-	sModGpsHead stModGpsHead;				//  GPS 
+	UInt32 uiLen;
+	UInt8 *pDst;
+	volatile UInt8 *pPkt;
+
+	volatile UInt8 *pBramAddr = (volatile UInt8 *)(pDesc->uiBase);		// BRAM  ּ
 
-	volatile UInt8 *pBramAddr = (volatile UInt8 *)(uiAddr);				// BRAM  ּ
+	/* PL Write Index  Address  (1 word) */
+	uiInfo = Xil_In32( pDesc->uiBase + pDesc->uiInfoOfs );
+	ucBramWrAddr = (UInt8)(uiInfo & 0xFF);
+	ucBramWrIdx = (UInt8)((uiInfo >> 8) & 0xFF);
 
-	/* PL Write Index  Address  */
-	ucBramWrIdx = pBramInfo[1];				// PL Write Index Read (0~255)
-	ucBramWrAddr = pBramInfo[0];			// PL Write Address Readd (0~20)
+	if( ucBramWrAddr >= pDesc->uiPktCnt )
+	{
+		pStat->uiBadLen++;
+		return 0;
+	}
 
 	/* Rolling Count Ȯ */
-	ucIdxRollCnt = ((ucBramWrIdx-*pBramWrIdxBefore)<0)?(ucBramWrIdx-*pBramWrIdxBefore)+MAX_IDX:(ucBramWrIdx-*pBramWrIdxBefore);
-	ucAddrRollCnt = ((ucBramWrAddr-*pBramWrAddrBefore)<0)?(ucBramWrAddr-*pBramWrAddrBefore)+IMU_BRAM_PACKET:(ucBramWrAddr-*pBramWrAddrBefore);
+	uiIdxRollCnt = (ucBramWrIdx + MAX_IDX - pStat->ucWrIdxBefore) % MAX_IDX;
+	uiAddrRollCnt = (ucBramWrAddr + pDesc->uiPktCnt - pStat->ucWrAddrBefore) % pDesc->uiPktCnt;
 
-	if( ucIdxRollCnt != ucAddrRollCnt )
+	if( uiIdxRollCnt != uiAddrRollCnt )
 	{
-		/* Buffer Overflow */
+		/* Buffer Overflow: PL   ѹ ̻ ,  ġ 絿 */
+		pStat->uiOverflow++;
 	}
 	else
 	{
-		if( ucAddrRollCnt > 0 )
+		if( uiAddrRollCnt > pStat->uiMaxPend )
 		{
-			for( i=0; i<ucAddrRollCnt; i++ )
-			{
-				/* BRAM Address Ȯ */
-				uiBramReAddr = ((*pBramWrAddrBefore*IMU_BRAM_SIZE)+(i*IMU_BRAM_SIZE)) % (IMU_BRAM_PACKET*IMU_BRAM_SIZE);
+			pStat->uiMaxPend = uiAddrRollCnt;
+		}
 
-				memcpy( &stModGpsHead, (pBramAddr+uiBramReAddr), IMU_BRAM_SIZE );
+		for( i=0; i<uiAddrRollCnt; i++ )
+		{
+			/* BRAM Address Ȯ */
+			uiBramReAddr = ((pStat->ucWrAddrBefore + i) % pDesc->uiPktCnt) * pDesc->uiPktSize;
 
-				/* DDR3 ޸ Enqueue */
-				//scSts = DdrEnqueue( &pBramAddr[uiBramReAddr+48], &stRbStim, (stModGpsHead.stIpStructure.usTotalLen-28) );
-				scSts = DdrEnqueue( stModGpsHead.ucData, &stRbStim, (stModGpsHead.stIpStructure.usTotalLen-28) );
-				if( scSts < 0 )
-				{
-					/* ring buffer is full */
-				}
+			pPkt = pBramAddr + uiBramReAddr;
+
+			/* UDP  ũ Ȯ (BRAM  IP Total Length  Read) */
+			uiLen = *(volatile UInt16 *)(pPkt + SLOT_IP_LEN_OFS);
+			if( (uiLen <= SLOT_IP_UDP_HDR_LEN) || ((uiLen - SLOT_IP_UDP_HDR_LEN) > SLOT_UDP_DATA_MAX(pDesc->uiPktSize)) )
+			{
+				pStat->uiBadLen++;
+				continue;
 			}
+			uiLen -= SLOT_IP_UDP_HDR_LEN;
 
-			/*  Packet Return */
-			ucRetVal = ucAddrRollCnt;
-		}
-		else
-		{
-			/*    */
+			/* BRAM to DDR3:    UDP ͸   */
+			pDst = RingBufReserve( pDesc->pRing, uiLen );
+			if( pDst == NULL )
+			{
+				/* ring buffer is full */
+				pStat->uiRbFull++;
+				continue;
+			}
+			SlotCopyPayload( (u32 *)pDst, (volatile const u32 *)(pPkt + SLOT_UDP_DATA_OFS - 2), uiLen );
+			RingBufCommit( pDesc->pRing, uiLen );
+
+			pStat->uiPkt++;
+			pStat->uiByte += uiLen;
+			pStat->uiBramByte += sizeof(UInt16) + ((uiLen + 2 + 3) & ~3UL);
+			uiCnt++;
 		}
 	}
 
 	/*  BRAM   */
-	*pBramWrIdxBefore = ucBramWrIdx;
-	*pBramWrAddrBefore = ucBramWrAddr;
+	pStat->ucWrIdxBefore = ucBramWrIdx;
+	pStat->ucWrAddrBefore = ucBramWrAddr;
 
-	return ucRetVal;
-}
-
-
-/**
- * @fn		Slot1DataRead
- * @brief	SLOT #1  Read Լ
- * @param	Read Enable
- * @return	void
- * @date	2025/11/07
- */
-static void Slot1DataRead( UInt8 *pBramInfoData )
-{
-	static UInt8 ucBramWrIdxBefore = 0;			//  BRAM Write  PL Write Index
-	static UInt8 ucBramWrAddrBefore = 0;		//  BRAM Write  PL Write Address
-
-	/*   - BRAM to DDR3 */
-//	GpsPacketRead( BRAM_ADDR_RE_SLOT_01, &ucBramWrIdxBefore,
-//			&ucBramWrAddrBefore, pBramInfoData );
-	GpsPacketRead( BRAM_ADDR_RE_SLOT_01, &ucBramWrIdxBefore,
-			&ucBramWrAddrBefore, pBramInfoData ); // by Chun 250108
-}
-
-/**
- * @fn		Slot2DataRead
- * @brief	SLOT #2  Read Լ
- * @param	Read Enable
- * @return	void
- * @date	2025/11/07
- */
-static void Slot2DataRead( UInt8 *pBramInfoData )
-{
-	static UInt8 ucBramWrIdxBefore = 0;			//  BRAM Write  PL Write Index
-	static UInt8 ucBramWrAddrBefore = 0;		//  BRAM Write  PL Write Address
-
-	/*   - BRAM to DDR3 */
-	ImuPacketRead( BRAM_ADDR_RE_SLOT_02, &ucBramWrIdxBefore,
-			&ucBramWrAddrBefore, pBramInfoData );
+	return uiCnt;
 }
 
 
 /**
  * @fn		ModuleDataRead
- * @brief	   Լ (SLOT #1~10 Read)
+ * @brief	   Լ (stSlotDesc   Read)
  * @param	void
  * @return	void
- * @date	2022/12/19
+ * @date	2026/10/16
  */
 static void ModuleDataRead( void )
 {
-	UInt32 uiBramInfoSolt1 = Xil_In32(BRAM_ADDR_RE_SLOT_01+65532);		// BRAM Write  ּ-64K
-	UInt32 uiBramInfoSolt2 = Xil_In32(BRAM_ADDR_RE_SLOT_02+65532);
+	UInt32 i;
+	const sSlotDesc *pDesc;
 
-	/* SLOT #1   Read */
-	Slot1DataRead( &uiBramInfoSolt1 );			// Network Module Data Read
+	for( i=0; i<SLOT_RX_NUM; i++ )
+	{
+		pDesc = &stSlotDesc[i];
 
-	/* SLOT #2   Read */
-	Slot2DataRead( &uiBramInfoSolt2 );			// GPS Module Data Read
+		/*   - BRAM to DDR3 */
+		SlotIngest( pDesc, &stSlotStat[i] );
+
+		/*  Ͱ  ó Thread  */
+		if( (pDesc->pxTask != NULL) && (*pDesc->pxTask != NULL) && (RingBufCount( pDesc->pRing ) > 0) )
+		{
+			xTaskNotifyGive( *pDesc->pxTask );
+		}
+	}
 }
 
 /**
@@ -521,58 +428,78 @@ static UInt8 InitInterrupt( void )
 
 /**
  * @fn		UartBramRead
- * @brief	BRAM to Receive Buffer  Լ
- * @param	UInt32 uiChannel : BRAM ּ
- * @param	UInt8 *pRecvBuf : Receive Buffer 
- * @param	UInt8 *pBramWrAddrBefore : BRAM   Address
- * @return	 
- * @date	2023/03/03
+ * @brief	RS422 BRAM   Drain Լ
+ * 			 ֱ  PL      pfnSink   ( )
+ * @param	UInt32 uiCh : UART ä (0~5)
+ * @param	volatile UInt8 *pBram : ä BRAM  ּ
+ * @param	SInt8 *pBramWrAddrBefore : BRAM   Address
+ * @param	sUartRxStat *pStat : ä  
+ * @param	UartRxSink_t pfnSink :    Լ (BRAM  , ȣ ߿ ȿ)
+ * @return	  
+ * @date	2026/10/16
  */
-static UInt8 UartBramRead( UInt32 uiChannel, UInt8 *pRecvBuf, SInt8 *pBramWrAddrBefore )
+static UInt32 UartBramRead( UInt32 uiCh, volatile UInt8 *pBram, SInt8 *pBramWrAddrBefore, sUartRxStat *pStat, UartRxSink_t pfnSink )
 {
-	UInt8 i;
-	UInt8 ucRetVal = 0;
+	UInt32 i;
+	UInt32 uiCnt = 0;
+	UInt32 uiLen;
 	SInt8 scBramWrAddr;						// BRAM Write  PL Write Address
-	UInt8 ucAddrRollCnt;					// Address    īƮ ( Address -  Address)
-	UInt32 uiBramReAddr = 0;				// BRAM  Address
+	UInt32 uiPending;						// Address     ( Address -  Address)
+	UInt32 uiSlot;
+	volatile UInt8 *pSlot;
+	volatile UInt8 *pBramInfo = pBram + UART_BRAM_INFO_OFS;		// BRAM Write  ּ
 
-	volatile UInt8 *pBramAddr = (volatile UInt8 *)(uiChannel);			// BRAM  ּ
-	volatile UInt8 *pBramInfo = (volatile UInt8 *)(uiChannel+16380);		// BRAM Write  ּ
-
-	/* BRAM Ӱ迵  */
-	if( pBramInfo[3] != PL_BRAM_WR_STS )
+	/* BRAM Ӱ迵  (PL Write ̸  ֱ) */
+	if( pBramInfo[3] == PL_BRAM_WR_STS )
 	{
-		/* PL Write Index  Address  */
-		scBramWrAddr = pBramInfo[0];			// PL Write Address
+		pStat->uiBusy++;
+		return 0;
+	}
 
-		/* Rolling Count Ȯ - ֱ  Index  */
-		ucAddrRollCnt = ((scBramWrAddr-*pBramWrAddrBefore)<0)?(scBramWrAddr-*pBramWrAddrBefore)+UART_BRAM_PACKET:(scBramWrAddr-*pBramWrAddrBefore);
+	/* PL Write Address  */
+	scBramWrAddr = pBramInfo[0];
+	if( (scBramWrAddr < 0) || (scBramWrAddr >= UART_BRAM_PACKET) )
+	{
+		pStat->uiBadLen++;
+		return 0;
+	}
 
-		if( ucAddrRollCnt > 0 )
-		{
-			for( i=0; i<ucAddrRollCnt; i++ )
-			{
-				/* BRAM Address Ȯ */
-				uiBramReAddr = ((*pBramWrAddrBefore*UART_BRAM_SIZE)+((i+1)*UART_BRAM_SIZE)) % (UART_BRAM_PACKET*UART_BRAM_SIZE);
+	uiPending = (UInt32)((scBramWrAddr - *pBramWrAddrBefore + UART_BRAM_PACKET) % UART_BRAM_PACKET);
+	if( uiPending > pStat->uiMaxPend )
+	{
+		pStat->uiMaxPend = uiPending;
+	}
 
-				/* RS422   */
-				memcpy( pRecvBuf, (void *)(pBramAddr+uiBramReAddr), UART_BRAM_SIZE );
-			}
+	/*   : PL        (PL overrun ÷ ) */
+	if( uiPending >= (UART_BRAM_PACKET - 1) )
+	{
+		pStat->uiOverrun++;
+	}
 
-			/*  Packet Return */
-			ucRetVal = ucAddrRollCnt;
+	/*  Address  Ժ   */
+	for( i=0; i<uiPending; i++ )
+	{
+		uiSlot = ((UInt32)*pBramWrAddrBefore + i + 1) % UART_BRAM_PACKET;
+		pSlot = pBram + (uiSlot * UART_BRAM_SIZE);
 
-		}
-		else
+		/*   (Little Endian) Ȯ  ȿ ͸  */
+		uiLen = (UInt32)pSlot[0] | ((UInt32)pSlot[1] << 8) | ((UInt32)pSlot[2] << 16) | ((UInt32)pSlot[3] << 24);
+		if( (uiLen == 0) || (uiLen > (UART_BRAM_SIZE - 4)) )
 		{
-			/*    */
+			pStat->uiBadLen++;
+			continue;
 		}
 
-		/*  BRAM   */
-		*pBramWrAddrBefore = scBramWrAddr;
+		pfnSink( uiCh, (const UInt8 *)(pSlot + 4), uiLen );
+		pStat->uiPkt++;
+		pStat->uiByte += uiLen;
+		uiCnt++;
 	}
 
-	return ucRetVal;
+	/*  BRAM   */
+	*pBramWrAddrBefore = scBramWrAddr;
+
+	return uiCnt;
 }
 
 
@@ -590,46 +517,52 @@ static void UartWrite( UInt32 uiChannel, UInt8 *pSendBuf, UInt32 uiSize )
 	switch( uiChannel )
 	{
 		case BRAM_ADDR_WR_UART_01:
-			/* BRAM Write */
-			BramWrite16( pSendBuf, uiSize, uiChannel );
-
-			/* RS422   */
-			PsToPlCommand( CMD_RS422_CH01_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			/* BRAM Write,       (   ) */
+			if( BramWrite16( pSendBuf, uiSize, uiChannel ) == BRAM_OK )
+			{
+				/* RS422   */
+				PsToPlCommand( CMD_RS422_CH01_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			}
 			break;
 		case BRAM_ADDR_WR_UART_02:
-			/* BRAM Write */
-			BramWrite16( pSendBuf, uiSize, uiChannel );
-
-			/* RS422   */
-			PsToPlCommand( CMD_RS422_CH02_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			/* BRAM Write,       (   ) */
+			if( BramWrite16( pSendBuf, uiSize, uiChannel ) == BRAM_OK )
+			{
+				/* RS422   */
+				PsToPlCommand( CMD_RS422_CH02_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			}
 			break;
 		case BRAM_ADDR_WR_UART_03:
-			/* BRAM Write */
-			BramWrite16( pSendBuf, uiSize, uiChannel );
-
-			/* RS422   */
-			PsToPlCommand( CMD_RS422_CH03_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			/* BRAM Write,       (   ) */
+			if( BramWrite16( pSendBuf, uiSize, uiChannel ) == BRAM_OK )
+			{
+				/* RS422   */
+				PsToPlCommand( CMD_RS422_CH03_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			}
 			break;
 		case BRAM_ADDR_WR_UART_04:
-			/* BRAM Write */
-			BramWrite16( pSendBuf, uiSize, uiChannel );
-
-			/* RS422   */
-			PsToPlCommand( CMD_RS422_CH04_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			/* BRAM Write,       (   ) */
+			if( BramWrite16( pSendBuf, uiSize, uiChannel ) == BRAM_OK )
+			{
+				/* RS422   */
+				PsToPlCommand( CMD_RS422_CH04_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			}
 			break;
 		case BRAM_ADDR_WR_UART_05:
-			/* BRAM Write */
-			BramWrite16( pSendBuf, uiSize, uiChannel );
-
-			/* RS422   */
-			PsToPlCommand( CMD_RS422_CH05_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			/* BRAM Write,       (   ) */
+			if( BramWrite16( pSendBuf, uiSize, uiChannel ) == BRAM_OK )
+			{
+				/* RS422   */
+				PsToPlCommand( CMD_RS422_CH05_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			}
 			break;
 		case BRAM_ADDR_WR_UART_06:
-			/* BRAM Write */
-			BramWrite16( pSendBuf, uiSize, uiChannel );
-
-			/* RS422   */
-			PsToPlCommand( CMD_RS422_CH06_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			/* BRAM Write,       (   ) */
+			if( BramWrite16( pSendBuf, uiSize, uiChannel ) == BRAM_OK )
+			{
+				/* RS422   */
+				PsToPlCommand( CMD_RS422_CH06_TX_ENABLE, BRAM_ADDR_CTL_UART_TX );
+			}
 			break;
 		default:
 			/* RS422 write ּ Է  */
@@ -639,75 +572,199 @@ static void UartWrite( UInt32 uiChannel, UInt8 *pSendBuf, UInt32 uiSize )
 
 
 /**
- * @fn UartRead
- * @brief UART Read Լ
- * @param void *p
- * @return void
- * @date 2024-07-26
+ * @fn		UartCom1CopyWait
+ * @brief	COM1  ->  񵿱  Ϸ  (   CPU 纹)
+ * @param	void
+ * @return	void
+ * @date	2026/10/16
  */
-static void UartRead( UInt32 uiComAddr, SInt8 *pWrAddrBefore, sRingBufInfo *pRingBufInfo )
+static void UartCom1CopyWait( void )
 {
-	UInt8 ucSts;							//   ( 0:  , 1:  )
-	SInt32 scSts;
-	plSerialPacket_t stSerialPacket;
+	CopyDesc_t *pDesc;
+	UInt32 i;
 
-	/* --- BRAM Read --- */
-	ucSts = UartBramRead( uiComAddr, stSerialPacket.ucMsgBuf, pWrAddrBefore );
-	if( ucSts > 0 )
+	for( i=0; i<uiCom1CopyCnt; i++ )
 	{
-		/* Debug: Print received data from Com1 */
-		if( uiComAddr == BRAM_ADDR_RE_UART_01 )
+		CopyEngWait( &stCom1Copy[i], portMAX_DELAY );
+	}
+
+	/*   纹 (  BRAM  ̹ ֱ  ȿ) */
+	for( i=0; i<uiCom1CopyCnt; i++ )
+	{
+		pDesc = &stCom1Copy[i];
+		if( pDesc->uiState != COPY_DONE )
 		{
-			// xil_printf("[COM1] Recv(%d): ", stSerialPacket.stSerialRecvMsg.uiBufSize);
-			// for(int i=0; i<stSerialPacket.stSerialRecvMsg.uiBufSize; i++)
-			// {
-			// 	xil_printf("%c", stSerialPacket.stSerialRecvMsg.ucRecvBuf[i]);
-			// }
-			// xil_printf("\r\n");
-			
-			/* Send Data to IGNU Task (Queue) */
-			if( xCom1DataQueue != NULL )
+			memcpy( (void *)pDesc->uiDst, (const void *)pDesc->uiSrc, pDesc->uiLen );
+		}
+	}
+
+	if( uiCom1CopyCnt > 0 )
+	{
+		/* Ϸ  ܿ  */
+		ulTaskNotifyTake( pdTRUE, 0 );
+	}
+	uiCom1CopyCnt = 0;
+}
+
+
+/**
+ * @fn		UartCom1Flush
+ * @brief	COM1   IGNU Task   (Queue, Pool   )
+ * @param	void
+ * @return	void
+ * @date	2026/10/16
+ */
+static void UartCom1Flush( void )
+{
+	/* Ͽ    Ϸ   */
+	UartCom1CopyWait();
+
+	if( pCom1RxBlk == NULL )
+	{
+		return;
+	}
+	pCom1RxBlk->usSize = (UInt16)uiCom1Size;
+
+	if( xCom1DataQueue == NULL )
+	{
+		xil_printf("[OPU] Error: xCom1DataQueue is NULL! Data Lost (%d bytes)\r\n", pCom1RxBlk->usSize);
+	}
+	else
+	{
+		IgnuCmdRxStamp();
+	}
+
+	/* Queue Full/NULL ̸ IgnuRbPost   ȯ */
+	if( IgnuRbPost( xCom1DataQueue, pCom1RxBlk ) < 0 )
+	{
+		stUartRxStat[0].uiDropByte += pCom1RxBlk->usSize;
+	}
+	pCom1RxBlk = NULL;
+}
+
+
+/**
+ * @fn		UartCom1Append
+ * @brief	COM1  ͸ Pool Ͽ ̾ (KISS Ʈ,   )
+ * @param	const UInt8 *pData :  
+ * @param	UInt32 uiLen :   ũ
+ * @return	void
+ * @date	2026/10/16
+ */
+static void UartCom1Append( const UInt8 *pData, UInt32 uiLen )
+{
+	CopyDesc_t *pDesc;
+	UInt32 uiCopy;
+
+	while( uiLen > 0 )
+	{
+		if( pCom1RxBlk == NULL )
+		{
+			pCom1RxBlk = IgnuRbAlloc();
+			if( pCom1RxBlk == NULL )
 			{
-				sRbData stCom1RbData;
-				stCom1RbData.usSize = stSerialPacket.stSerialRecvMsg.uiBufSize;
-				if(stCom1RbData.usSize > MAX_RB_DATA) stCom1RbData.usSize = MAX_RB_DATA;
-				
-				memcpy(stCom1RbData.ucData, stSerialPacket.stSerialRecvMsg.ucRecvBuf, stCom1RbData.usSize);
-				
-				xQueueSend( xCom1DataQueue, &stCom1RbData, 0 );
+				/* Pool  */
+				stUartRxStat[0].uiDropByte += uiLen;
+				return;
 			}
-            else
-            {
-                xil_printf("[OPU] Error: xCom1DataQueue is NULL! Data Lost (%d bytes)\r\n", stSerialPacket.stSerialRecvMsg.uiBufSize);
-            }
+			uiCom1Size = 0;
 		}
 
-#if 0
-		printf( "recv : " );
-		for( int i=0; i<stSerialPacket.stSerialRecvMsg.uiBufSize; i++ )
+		uiCopy = MAX_RB_DATA - uiCom1Size;
+		if( uiCopy > uiLen )
 		{
-			printf( "%02X ", stSerialPacket.stSerialRecvMsg.ucRecvBuf[i] );
+			uiCopy = uiLen;
 		}
-		printf( "\n" );
-#endif
-		/* -loopback */
-		if( usUartFlag == 1 )
+		/*  ->   (Copy Engine,  ä Read  ) */
+		if( uiCom1CopyCnt == UART_COM1_COPY_MAX )
 		{
-			/* DDR3 ޸ Enqueue */
-			if( stSerialPacket.stSerialRecvMsg.uiBufSize > 0 )
-			{
-				scSts = DdrEnqueue( stSerialPacket.stSerialRecvMsg.ucRecvBuf, pRingBufInfo, stSerialPacket.stSerialRecvMsg.uiBufSize );
-				if( scSts < 0 )
-				{
-					/* ring buffer is full */
-				}
-			}
+			UartCom1CopyWait();
+		}
+		pDesc = &stCom1Copy[uiCom1CopyCnt];
+		pDesc->uiSrc = (UInt32)pData;
+		pDesc->uiDst = (UInt32)&pCom1RxBlk->ucData[uiCom1Size];
+		pDesc->uiLen = uiCopy;
+		pDesc->pfnDone = NULL;
+		pDesc->pArg = NULL;
+		pDesc->xNotify = xTaskGetCurrentTaskHandle();
+		pDesc->uiState = COPY_IDLE;
+		if( CopyEngSubmit( pDesc ) == COPY_OK )
+		{
+			uiCom1CopyCnt++;
+		}
+		else
+		{
+			/* Queue Full:    Ϸ  CPU  */
+			UartCom1CopyWait();
+			memcpy( &pCom1RxBlk->ucData[uiCom1Size], pData, uiCopy );
+		}
+		uiCom1Size += uiCopy;
+		pData += uiCopy;
+		uiLen -= uiCopy;
+
+		/*  : ٷ  */
+		if( uiCom1Size == MAX_RB_DATA )
+		{
+			UartCom1Flush();
 		}
 	}
-	else
+}
+
+
+/**
+ * @fn		UartRxDeliver
+ * @brief	RS422   ó (UartBramRead Sink)
+ * @param	UInt32 uiCh : UART ä
+ * @param	const UInt8 *pData :   (BRAM)
+ * @param	UInt32 uiLen :   ũ
+ * @return	void
+ * @date	2026/10/16
+ */
+static void UartRxDeliver( UInt32 uiCh, const UInt8 *pData, UInt32 uiLen )
+{
+	SInt32 scSts;
+
+	/* COM1: IGNU  Ʈ */
+	if( uiCh == 0 )
 	{
-		/* ŵ  */
+		UartCom1Append( pData, uiLen );
 	}
+
+	/* -loopback */
+	if( usUartFlag == 1 )
+	{
+		/* TX  producer ȭ (SendToCom1/CspSendv/SendCcsdsTmBurst) */
+		scSts = -1;
+		if( SerialTxLock( uiCh ) == 0 )
+		{
+			scSts = DdrEnqueue( (UInt32 *)pData, &stRbInfoUart[uiCh], uiLen );
+			SerialTxUnlock( uiCh );
+		}
+		if( scSts < 0 )
+		{
+			/* ring buffer is full */
+			stUartRxStat[uiCh].uiDropByte += uiLen;
+		}
+		else if( xTxTask != NULL )
+		{
+			xTaskNotifyGive( xTxTask );
+		}
+	}
+}
+
+
+/**
+ * @fn UartRead
+ * @brief UART Read Լ
+ * @param UInt32 uiCh : UART ä (0~5)
+ * @param SInt8 *pWrAddrBefore : BRAM   Address
+ * @return void
+ * @date 2026-10-16
+ */
+static void UartRead( UInt32 uiCh, SInt8 *pWrAddrBefore )
+{
+	/* --- BRAM Read (  ü) --- */
+	UartBramRead( uiCh, (volatile UInt8 *)uiUartRxBram[uiCh], pWrAddrBefore, &stUartRxStat[uiCh], UartRxDeliver );
 }
 
 
@@ -757,32 +814,19 @@ static void uart_thread(void *p)
 {
 	const TickType_t x5ms = pdMS_TO_TICKS( DELAY_5_MSECOND );
 
-	SInt8 scBramWrAddrBeforeCom1 = 0;			//  BRAM Write  PL Write Address
-	SInt8 scBramWrAddrBeforeCom2 = 0;			//  BRAM Write  PL Write Address
-	SInt8 scBramWrAddrBeforeCom3 = 0;			//  BRAM Write  PL Write Address
-	SInt8 scBramWrAddrBeforeCom4 = 0;			//  BRAM Write  PL Write Address
-	SInt8 scBramWrAddrBeforeCom5 = 0;			//  BRAM Write  PL Write Address
-	SInt8 scBramWrAddrBeforeCom6 = 0;			//  BRAM Write  PL Write Address
+	SInt8 scBramWrAddrBefore[MAX_UART_CH] = { 0, };		//  BRAM Write  PL Write Address
+	UInt32 uiCh;
 
 	while(1)
 	{
-		/* --- UART COM#01-BRAM Read --- */
-		UartRead( BRAM_ADDR_RE_UART_01, &scBramWrAddrBeforeCom1, &stRbInfoUart[0] );
-
-		/* --- UART COM#02-BRAM Read --- */
-		UartRead( BRAM_ADDR_RE_UART_02, &scBramWrAddrBeforeCom2, &stRbInfoUart[1] );
-
-		/* --- UART COM#03-BRAM Read --- */
-		UartRead( BRAM_ADDR_RE_UART_03, &scBramWrAddrBeforeCom3, &stRbInfoUart[2] );
-
-		/* --- UART COM#04-BRAM Read --- */
-		UartRead( BRAM_ADDR_RE_UART_04, &scBramWrAddrBeforeCom4, &stRbInfoUart[3] );
-
-		/* --- UART COM#05-BRAM Read --- */
-		UartRead( BRAM_ADDR_RE_UART_05, &scBramWrAddrBeforeCom5, &stRbInfoUart[4] );
+		/* --- UART COM#01~06-BRAM Read --- */
+		for( uiCh=0; uiCh<MAX_UART_CH; uiCh++ )
+		{
+			UartRead( uiCh, &scBramWrAddrBefore[uiCh] );
+		}
 
-		/* --- UART COM#06-BRAM Read --- */
-		UartRead( BRAM_ADDR_RE_UART_06, &scBramWrAddrBeforeCom6, &stRbInfoUart[5] );
+		/* COM1: ̹ ֱ ź IGNU Task   (COM2~6 Read   ) */
+		UartCom1Flush();
 
 		vTaskDelay( x5ms );
 	}
@@ -799,6 +843,8 @@ static void tx_thread(void *p)
 {
 	const TickType_t x5ms = pdMS_TO_TICKS( DELAY_5_MSECOND );
 	sRbData stRbData;
+	UInt32 uiPending;
+	UInt32 i;
 
 	volatile UInt8 *pUartStsCom1 = (volatile UInt8 *)(BRAM_ADDR_STS_UART_01);		// BRAM  ּ
 	volatile UInt8 *pUartStsCom2 = (volatile UInt8 *)(BRAM_ADDR_STS_UART_02);		// BRAM  ּ
@@ -899,8 +945,13 @@ static void tx_thread(void *p)
 			}
 		}
 
-
-		vTaskDelay( x5ms );
+		/* ۽  Ͱ  (TX busy) 5ms  õ,  SerialTxCommit ˸  */
+		uiPending = 0;
+		for( i=0; i<MAX_UART_CH; i++ )
+		{
+			uiPending += RingBufCount( &stRbInfoUart[i] );
+		}
+		ulTaskNotifyTake( pdTRUE, (uiPending > 0) ? x5ms : portMAX_DELAY );
 	}
 }
 
@@ -914,42 +965,51 @@ static void tx_thread(void *p)
  */
 void gps_thread(void *p)
 {
-	const TickType_t x1ms = pdMS_TO_TICKS( DELAY_1_MSECOND );
+	sRbData *pRbData;
 
 	while(1)
 	{
-		/* GPS QUEUEȮ  ó */
-		while(1)
+		/* GPS QUEUEȮ  ó ( -> Pool  ٷ Dequeue) */
+		while( RingBufCount( &stGpsRbRx ) > 0 )
 		{
-			if( DdrDequeue( &stGpsRbData, &stGpsRbRx ) < 0 )
+			/* Pool   ӽ ۷ Dequeue (IGNU  ) */
+			pRbData = IgnuRbAlloc();
+			if( pRbData == NULL )
 			{
-				/* Empty */
-				break;
+				pRbData = &stGpsRbData;
 			}
-			else
+
+			if( DdrDequeue( pRbData, &stGpsRbRx ) < 0 )
 			{
-				/*  Լ */
-				if( usGpsFlag == 1 )
+				/* Empty */
+				if( pRbData != &stGpsRbData )
 				{
-					xil_printf( "GPS recv(%d) : ", stGpsRbData.usSize );
-
-					for( int i=0; i<stGpsRbData.usSize; i++ )
-					{
-						xil_printf( "%02X ", stGpsRbData.ucData[i] );
-					}
-					xil_printf( "Counter: %d\r\n", stGpsRbData.ucData[stGpsRbData.usSize-1] );
+					BufPoolRelease( &stIgnuRbPool, pRbData );
 				}
+				break;
+			}
+
+			/*  Լ */
+			if( usGpsFlag == 1 )
+			{
+				xil_printf( "GPS recv(%d) : ", pRbData->usSize );
 
-				/* Send Data to IGNU Task (Queue) */
-				if( xGpsDataQueue != NULL )
+				for( int i=0; i<pRbData->usSize; i++ )
 				{
-					/* Send data to queue (Wait time 0 = Non-blocking) */
-					xQueueSend( xGpsDataQueue, &stGpsRbData, 0 );
+					xil_printf( "%02X ", pRbData->ucData[i] );
 				}
+				xil_printf( "Counter: %d\r\n", pRbData->ucData[pRbData->usSize-1] );
+			}
+
+			/* Send Data to IGNU Task (Queue,   / Full̸  ȯ) */
+			if( pRbData != &stGpsRbData )
+			{
+				IgnuRbPost( xGpsDataQueue, pRbData );
 			}
 		}
 
-		vTaskDelay( x1ms );
+		/* ModuleDataRead  ˸  */
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
 	}
 }
 
@@ -963,49 +1023,66 @@ void gps_thread(void *p)
  */
 void imu_thread(void *p)
 {
-	const TickType_t x1ms = pdMS_TO_TICKS( DELAY_1_MSECOND );
 	static UInt32 uiImuSendCnt = 0;
+	static ImuData_t stImuBatch[IMU_BATCH_MAX];		// Ŷ  ü ڵ ( ӵ)
+	sRbData *pRbData;
+	UInt32 uiImuCnt;
 
 	while(1)
 	{
 		/* STIM300 QUEUEȮ  ó */
-		while(1)
+		while( RingBufCount( &stRbStim ) > 0 )
 		{
-			if( DdrDequeue( &stImuRbData, &stRbStim ) < 0 )
+			/* IGNU Task  (Decimation  °) Pool  Dequeue */
+			pRbData = NULL;
+			if( ((uiImuSendCnt + 1) % ImuGetDecimation()) == 0 )
 			{
-				/* Empty */
-				break;
+				pRbData = IgnuRbAlloc();
 			}
-			else
+			if( pRbData == NULL )
+			{
+				pRbData = &stImuRbData;
+			}
+
+			if( DdrDequeue( pRbData, &stRbStim ) < 0 )
 			{
-				/*  Լ */
-				if( usImuFlag == 1 )
+				/* Empty */
+				if( pRbData != &stImuRbData )
 				{
+					BufPoolRelease( &stIgnuRbPool, pRbData );
+				}
+				break;
+			}
+			uiImuSendCnt++;
 
-					printf( "IMU recv(%d) : ", stImuRbData.usSize );
+			/* ü Ŷ  (TM ֱ ), ð ̷ , ڼ   ׹ ( ӵ) */
+			uiImuCnt = ImuAccumulate( pRbData->ucData, pRbData->usSize, stImuBatch, IMU_BATCH_MAX );
+			HistImuPush( stImuBatch, uiImuCnt, HistNow() );
+			StrapdownUpdate( stImuBatch, uiImuCnt );
+			NavFilterUpdate( stImuBatch, uiImuCnt );
 
-					for( int i=0; i<stImuRbData.usSize; i++ )
-					{
-						printf( "%02X ", stImuRbData.ucData[i] );
-					}
-					printf( "\n" );
-				}
+			/*  Լ */
+			if( usImuFlag == 1 )
+			{
+
+				printf( "IMU recv(%d) : ", pRbData->usSize );
 
-				/* IGNU Task   (Queue) */
-				if( xImuDataQueue != NULL )
+				for( int i=0; i<pRbData->usSize; i++ )
 				{
-					uiImuSendCnt++;
-					if( (uiImuSendCnt % 10) == 0 )
-					{
-						/* ť   (Full ¸  , 0 = Non-blocking) */
-						/*    ŸӾƿ 0 ũ   */
-						xQueueSend( xImuDataQueue, &stImuRbData, 0 );
-					}
+					printf( "%02X ", pRbData->ucData[i] );
 				}
+				printf( "\n" );
+			}
+
+			/* IGNU Task   (Queue,   / Full̸  ȯ) */
+			if( pRbData != &stImuRbData )
+			{
+				IgnuRbPost( xImuDataQueue, pRbData );
 			}
 		}
 
-		vTaskDelay( x1ms );
+		/* ModuleDataRead  ˸  */
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
 	}
 }
 
@@ -1024,17 +1101,15 @@ static void RingBufferInit( void )
 	/* UART  ʱȭ */
 	for( i=0; i<MAX_UART_CH; i++ )
 	{
-		DdrRingBufferInit( &stRbInfoUart[i] );
-		stRbInfoUart[i].uiAddr =  &ucRbUart[i][0][0];
+		RingBufInit( &stRbInfoUart[i], ucRbUart[i], RB_SIZE_UART );
+		xUartTxLock[i] = xSemaphoreCreateMutex();		// producer ȭ (SerialTxLock)
 	}
 
 	/* GPS  ʱȭ */
-	DdrRingBufferInit( &stGpsRbRx );
-	stGpsRbRx.uiAddr =  ucGpsRbRx;
+	RingBufInit( &stGpsRbRx, ucGpsRbRx, RB_SIZE_GPS );
 
 	/* IMU  ʱȭ */
-	DdrRingBufferInit( &stRbStim );
-	stRbStim.uiAddr =  ucImuRbRx;
+	RingBufInit( &stRbStim, ucImuRbRx, RB_SIZE_IMU );
 }
 
 
@@ -1095,6 +1170,9 @@ void OpuTask( void *pvParameters )
 	/*  ʱȭ */
 	RingBufferInit();
 
+	/* BRAM <-> DDR Copy Engine ʱȭ */
+	CopyEngInit();
+
 	/* Task  */
 	TaskCreate();
 
@@ -1122,6 +1200,93 @@ void OpuTask( void *pvParameters )
     vTaskDelete( NULL );
 }
 
+/**
+ * @fn		SerialTxReserve
+ * @brief	RS422 TX Ring Buffer   Լ (ۿ  , zero-copy)
+ * @note	äκ producer ̹Ƿ Reserve~Commit  SerialTxLock ¿ ȣ
+ * @param	UInt32 uiCh : RS422 ä (0~5)
+ * @param	UInt32 *pMaxLen :    ִ ũ
+ * @return	    (NULL : Ring buffer is full)
+ * @date	2026/10/16
+ */
+UInt8 *SerialTxReserve( UInt32 uiCh, UInt32 *pMaxLen )
+{
+	UInt8 *pData;
+
+	if( uiCh >= MAX_UART_CH )
+	{
+		return NULL;
+	}
+
+	/* ڵ  : [Length(4)][Data], UART BRAM ۽ ѵ   Ȯ */
+	pData = RingBufReserve( &stRbInfoUart[uiCh], UART_BRAM_SIZE - 4 );
+	if( pData == NULL )
+	{
+		/* Ring buffer is full */
+		return NULL;
+	}
+
+	*pMaxLen = UART_BRAM_SIZE - 4;
+
+	return pData;
+}
+
+/**
+ * @fn		SerialTxCommit
+ * @brief	SerialTxReserve   Լ (tx_thread ۽ )
+ * @param	UInt32 uiCh : RS422 ä (0~5)
+ * @param	UInt32 uiLen :     ũ
+ * @return	Ring Buffer  (-1: Error, 0 : Normal)
+ * @date	2026/10/16
+ */
+SInt32 SerialTxCommit( UInt32 uiCh, UInt32 uiLen )
+{
+	if( (uiCh >= MAX_UART_CH) || (RingBufCommit( &stRbInfoUart[uiCh], uiLen ) < 0) )
+	{
+		return -1;
+	}
+
+	/* tx_thread  */
+	if( xTxTask != NULL )
+	{
+		xTaskNotifyGive( xTxTask );
+	}
+
+	return 0;
+}
+
+/**
+ * @fn		SerialTxLock
+ * @brief	RS422 TX  producer ȭ (Reserve~Commit, ٷ  )
+ * @note	Task  ȣ,  ä producer   (켱  mutex)
+ * @param	UInt32 uiCh : RS422 ä (0~5)
+ * @return	0 : ȹ, -1 : ä  /  ʱȭ 
+ * @date	2026/10/16
+ */
+SInt32 SerialTxLock( UInt32 uiCh )
+{
+	if( (uiCh >= MAX_UART_CH) || (xUartTxLock[uiCh] == NULL) )
+	{
+		return -1;
+	}
+
+	xSemaphoreTake( xUartTxLock[uiCh], portMAX_DELAY );
+
+	return 0;
+}
+
+/**
+ * @fn		SerialTxUnlock
+ * @brief	SerialTxLock  Լ
+ * @param	UInt32 uiCh : RS422 ä (0~5)
+ * @return	void
+ * @date	2026/10/16
+ */
+void SerialTxUnlock( UInt32 uiCh )
+{
+	xSemaphoreGive( xUartTxLock[uiCh] );
+}
+
 /**
  * @fn SendToCom1
  * @brief Send data to Com1 (RS-422 Ch1) via Ring Buffer
@@ -1131,24 +1296,236 @@ void OpuTask( void *pvParameters )
  */
 SInt32 SendToCom1(UInt8 *pData, UInt32 uiLen)
 {
-    SInt32 scSts;
-    UInt32 uiAlignLen = uiLen;
-    UInt32 uiBuf[MAX_RB_DATA/4]; // Temporary buffer for 4-byte alignment
-
-    /* DdrEnqueue expects 4-byte aligned buffer (UInt32*)? 
-       Checking DdrEnqueue implementation:
-       memcpy( &pAddr[...], pBuf, ... );
-       It takes UInt32* pBuf. So we should copy byte data to aligned buffer first. 
-       Or cast it if we are sure? No, pData is UInt8*.
-    */
-    
-    if(uiLen > MAX_RB_DATA) return -1;
-
-    /* Copy to temp buffer to ensure alignment and match DdrEnqueue signature */
-    memcpy(uiBuf, pData, uiLen);
-
-    /* Enqueue to Com1 TX Ring Buffer (stRbInfoUart[0]) */
-    scSts = DdrEnqueue(uiBuf, &stRbInfoUart[0], uiLen);
-    
-    return scSts;
+    UInt8 *pSlot;
+    UInt32 uiMaxLen = 0;
+    SInt32 siRet;
+
+    /* Copy straight into the Com1 TX Ring Buffer (stRbInfoUart[0]);
+     * one producer at a time: serialize against CspSendv / TM bursts / loopback */
+    if (SerialTxLock(0) < 0) return -1;
+    pSlot = SerialTxReserve(0, &uiMaxLen);
+    if( (pSlot == NULL) || (uiLen > uiMaxLen) )
+    {
+        siRet = -1;
+    }
+    else
+    {
+        memcpy(pSlot, pData, uiLen);
+        siRet = SerialTxCommit(0, uiLen);
+    }
+    SerialTxUnlock(0);
+
+    return siRet;
+}
+
+/**
+ * @fn		UartRxReport
+ * @brief	RS422 äκ    (DBG "uartstat")
+ * @param	void
+ * @return	void
+ * @date	2026/10/16
+ */
+void UartRxReport( void )
+{
+	UInt32 i;
+	sUartRxStat *pStat;
+
+	xil_printf( "[UART] RX slot %d B x %d, poll %d ms\r\n", UART_BRAM_SIZE, UART_BRAM_PACKET, DELAY_5_MSECOND );
+	for( i=0; i<MAX_UART_CH; i++ )
+	{
+		pStat = &stUartRxStat[i];
+		xil_printf( "  COM%d pkt %u, byte %u, max pend %u, overrun %u, bad %u, drop %u B, busy %u\r\n",
+			i+1, pStat->uiPkt, pStat->uiByte, pStat->uiMaxPend, pStat->uiOverrun,
+			pStat->uiBadLen, pStat->uiDropByte, pStat->uiBusy );
+	}
+}
+
+
+/* ---  ġũ (DDR  BRAM ̹) --- */
+static UInt8 ucUartBenchBram[MAX_UART_CH][UART_BRAM_INFO_OFS+4] __attribute__((aligned(4)));
+static UInt8 ucUartBenchTx[MAX_UART_CH];			// äκ ۽  ī
+static UInt8 ucUartBenchRx[MAX_UART_CH];			// äκ   
+static UInt32 uiUartBenchErr[MAX_UART_CH];			// / ġ Ʈ
+static UInt32 uiUartBenchLast[MAX_UART_CH];			// ̹ Drain   ũ (  )
+
+/**
+ * @fn		UartBenchSink
+ * @brief	ġũ Sink: äκ ī  Ӽ Ȯ
+ * @date	2026/10/16
+ */
+static void UartBenchSink( UInt32 uiCh, const UInt8 *pData, UInt32 uiLen )
+{
+	UInt32 i;
+	UInt8 ucExp = ucUartBenchRx[uiCh];
+
+	for( i=0; i<uiLen; i++ )
+	{
+		if( pData[i] != ucExp )
+		{
+			uiUartBenchErr[uiCh]++;
+			ucExp = pData[i];
+		}
+		ucExp++;
+	}
+	ucUartBenchRx[uiCh] = ucExp;
+	uiUartBenchLast[uiCh] = uiLen;
+}
+
+/**
+ * @fn		UartBenchProduce
+ * @brief	ġũ PL :  Կ    Write Address 
+ * @return	0 : , -1 :   ( PL  ̼  )
+ * @date	2026/10/16
+ */
+static SInt32 UartBenchProduce( UInt32 uiCh, SInt8 scRdAddr, UInt32 uiLen )
+{
+	UInt8 *pBram = ucUartBenchBram[uiCh];
+	UInt8 *pSlot;
+	UInt32 i, uiSlot;
+
+	uiSlot = (UInt32)(pBram[UART_BRAM_INFO_OFS] + 1) % UART_BRAM_PACKET;
+	if( uiSlot == (UInt32)scRdAddr )
+	{
+		return -1;
+	}
+
+	pSlot = pBram + (uiSlot * UART_BRAM_SIZE);
+	pSlot[0] = (UInt8)uiLen;
+	pSlot[1] = (UInt8)(uiLen >> 8);
+	pSlot[2] = 0;
+	pSlot[3] = 0;
+	for( i=0; i<uiLen; i++ )
+	{
+		pSlot[4+i] = ucUartBenchTx[uiCh]++;
+	}
+	pBram[UART_BRAM_INFO_OFS] = (UInt8)uiSlot;
+
+	return 0;
+}
+
+/**
+ * @fn		UartRxBenchmark
+ * @brief	RS422  Drain ġũ (DBG "uarbench")
+ * 			6ä  UART_BENCH_BAUD   1 ms  ϰ uiPeriodMs  Drain,
+ * 			/  Drain ð,  ( Ը ) սǷ 
+ * @param	UInt32 uiMs :   ð (ms)
+ * @param	UInt32 uiPeriodMs : Drain ֱ (ms, uart_thread 5 ms)
+ * @return	void
+ * @date	2026/10/16
+ */
+void UartRxBenchmark( UInt32 uiMs, UInt32 uiPeriodMs )
+{
+	SInt8 scRdAddr[MAX_UART_CH];
+	UInt32 uiCredit[MAX_UART_CH];			//   Ʈ (x1000)
+	UInt32 uiPktLen[MAX_UART_CH];			//  Ŷ ũ
+	UInt32 uiSeq = 0;
+	UInt32 uiFull = 0;						// PL   ( ) Ƚ
+	UInt32 uiDrain = 0;
+	UInt32 uiLegacyByte = 0;				//    Ʈ
+	UInt32 uiErr = 0;
+	UInt32 uiMs1, uiCh, uiNs, uiMaxNs = 0;
+	UInt32 uiLoad;							// Drain  (0.01 %)
+	UInt64 ullSumNs = 0;
+	sUartRxStat stStat;
+	XTime xStart, xEnd;
+
+	if( uiPeriodMs == 0 )
+	{
+		uiPeriodMs = DELAY_5_MSECOND;
+	}
+
+	memset( &stStat, 0, sizeof(stStat) );
+	memset( ucUartBenchBram, 0, sizeof(ucUartBenchBram) );
+	for( uiCh=0; uiCh<MAX_UART_CH; uiCh++ )
+	{
+		scRdAddr[uiCh] = 0;
+		uiCredit[uiCh] = 0;
+		uiPktLen[uiCh] = 8;
+		ucUartBenchTx[uiCh] = (UInt8)(uiCh * 40);
+		ucUartBenchRx[uiCh] = ucUartBenchTx[uiCh];
+		uiUartBenchErr[uiCh] = 0;
+	}
+
+	for( uiMs1=1; uiMs1<=uiMs; uiMs1++ )
+	{
+		/* PL : 1 ms ŷ (8N1, 10 bit/byte), Ŷ ũ 8~256 B */
+		for( uiCh=0; uiCh<MAX_UART_CH; uiCh++ )
+		{
+			uiCredit[uiCh] += UART_BENCH_BAUD / 10;
+			while( uiCredit[uiCh] >= (uiPktLen[uiCh] * 1000) )
+			{
+				if( UartBenchProduce( uiCh, scRdAddr[uiCh], uiPktLen[uiCh] ) < 0 )
+				{
+					uiFull++;
+					break;
+				}
+				uiCredit[uiCh] -= uiPktLen[uiCh] * 1000;
+				uiSeq++;
+				uiPktLen[uiCh] = 8 + ((uiSeq * 37) % 249);
+			}
+		}
+
+		if( (uiMs1 % uiPeriodMs) != 0 )
+		{
+			continue;
+		}
+
+		/* uart_thread ֱ: 6ä Drain */
+		XTime_GetTime( &xStart );
+		for( uiCh=0; uiCh<MAX_UART_CH; uiCh++ )
+		{
+			uiUartBenchLast[uiCh] = 0;
+			UartBramRead( uiCh, ucUartBenchBram[uiCh], &scRdAddr[uiCh], &stStat, UartBenchSink );
+			uiLegacyByte += uiUartBenchLast[uiCh];
+		}
+		XTime_GetTime( &xEnd );
+
+		uiNs = (UInt32)(((UInt64)(xEnd - xStart) * 1000000000ULL) / COUNTS_PER_SECOND);
+		ullSumNs += uiNs;
+		if( uiNs > uiMaxNs )
+		{
+			uiMaxNs = uiNs;
+		}
+		uiDrain++;
+	}
+
+	for( uiCh=0; uiCh<MAX_UART_CH; uiCh++ )
+	{
+		uiErr += uiUartBenchErr[uiCh];
+	}
+
+	uiLoad = (UInt32)((uiMs != 0) ? ((ullSumNs / 100) / uiMs) : 0);
+
+	xil_printf( "[UART] Bench %d ch @ %d baud, %u ms, drain every %u ms (DDR image)\r\n",
+		MAX_UART_CH, UART_BENCH_BAUD, uiMs, uiPeriodMs );
+	xil_printf( "  slots %u, bytes %u, max pend %u / %d, ring full %u (PL would overwrite), order/data err %u\r\n",
+		stStat.uiPkt, stStat.uiByte, stStat.uiMaxPend, UART_BRAM_PACKET - 1, uiFull, uiErr );
+	xil_printf( "  drain avg %u us, max %u us, load %u.%02u %%\r\n",
+		(UInt32)((uiDrain != 0) ? ((ullSumNs / uiDrain) / 1000) : 0), uiMaxNs / 1000,
+		uiLoad / 100, uiLoad % 100 );
+	xil_printf( "  last-slot-only delivery would keep %u of %u bytes\r\n", uiLegacyByte, stStat.uiByte );
+}
+
+/**
+ * @fn		SlotRxReport
+ * @brief	LVDS Ժ    (DBG "slotstat")
+ * @param	void
+ * @return	void
+ * @date	2026/10/16
+ */
+void SlotRxReport( void )
+{
+	UInt32 i;
+	const sSlotDesc *pDesc;
+	sSlotStat *pStat;
+
+	xil_printf( "[SLOT] %d LVDS RX slots\r\n", SLOT_RX_NUM );
+	for( i=0; i<SLOT_RX_NUM; i++ )
+	{
+		pDesc = &stSlotDesc[i];
+		pStat = &stSlotStat[i];
+		xil_printf( "  %-10s 0x%08X %4u B x %2u, pkt %u, byte %u, bram rd %u B, max pend %u, overflow %u, bad %u, rb full %u\r\n",
+			pDesc->pName, pDesc->uiBase, pDesc->uiPktSize, pDesc->uiPktCnt,
+			pStat->uiPkt, pStat->uiByte, pStat->uiBramByte, pStat->uiMaxPend, pStat->uiOverflow, pStat->uiBadLen, pStat->uiRbFull );
+	}
 }
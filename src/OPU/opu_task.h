@@ -11,7 +11,11 @@
 #ifndef __OPUTASK_H__
 #define __OPUTASK_H__
 
+#include <stddef.h>
+#include "FreeRTOS.h"
+#include "task.h"
 #include "../common/common.h"
+#include "../common/ringbuf.h"
 
 /*
 * Define
@@ -32,9 +36,25 @@
 #define XADC_BASE 						(0x43C00000)	// XADC Base Address
 
 /* Ring Buffer Define */
-#define MAX_RB_IDX			50					// RingBuffer index ִ
 #define MAX_RB_DATA			1528				// RingBuffer Data  ִ
 
+/* Ʈ  뷮 (byte, 2 ŵ, ִ ڵ 2 ̻) */
+#define RB_SIZE_GPS			(32*1024)			// GPS RX  뷮
+#define RB_SIZE_IMU			(64*1024)			// IMU RX  뷮
+#define RB_SIZE_UART		(8*1024)			// UART äκ TX  뷮
+
+/* RS422  BRAM */
+#define UART_BRAM_INFO_OFS	16380				// BRAM Write  Offset ([0]: PL Write Address, [3]: Write )
+#define UART_BENCH_BAUD		921600				//  ġũ ä Baudrate
+#define UART_COM1_COPY_MAX	16					// COM1 ֱ 񵿱  (Copy Engine) ִ 
+
+/* LVDS   BRAM */
+#define SLOT_INFO_OFS_64K	65532				// 64K  BRAM Write  Offset ([7:0] Address, [15:8] Index)
+#define SLOT_IP_UDP_HDR_LEN	28					// IP(20) + UDP(8) , UDP  = usTotalLen - 28
+#define SLOT_IP_LEN_OFS		offsetof(sModGpsHead, stIpStructure.usTotalLen)	// Ŷ  IP Total Length ġ (24)
+#define SLOT_UDP_DATA_OFS	offsetof(sModGpsHead, ucData)					// Ŷ  UDP  ġ (50, 4byte  +2)
+#define SLOT_UDP_DATA_MAX(size)	((size) - SLOT_UDP_DATA_OFS)
+
 #define UART_MAX_CH		4
 #define DIG_MAX_CH		8
 
@@ -50,15 +70,6 @@ typedef struct
 	UInt8 ucData[MAX_RB_DATA];		// 
 } __attribute__((packed)) sRbData;
 
-/* Ring buffer  */
-typedef struct
-{
-	UInt32 uiAddr;			// DDR3  ּ
-	SInt32 siFront;			// Ring buffer Front
-	SInt32 siRear;			// Ring buffer Rear
-	SInt32 siCount;			// Ring buffer Count
-} __attribute__((packed)) sRingBufInfo;
-
 /* RS422  ü */
 typedef struct
 {
@@ -72,7 +83,55 @@ typedef union {
     sSerialRecvMsg stSerialRecvMsg;
 } __attribute__((packed)) plSerialPacket_t;
 
+/* RS422 äκ   */
+typedef struct
+{
+	UInt32 uiPkt;				//   
+	UInt32 uiByte;				//  Ʈ 
+	UInt32 uiBadLen;			//  /Write Address 
+	UInt32 uiOverrun;			//   (PL  ̼   )
+	UInt32 uiDropByte;			// Pool/Queue/TX    Ʈ
+	UInt32 uiMaxPend;			//  ֱ ִ   
+	UInt32 uiBusy;				// PL Write  ǳʶ
+} sUartRxStat;
+
+/* LVDS    (PL BRAM  -> DDR ) */
+typedef struct
+{
+	const char *pName;
+	UInt32 uiBase;				// BRAM  ּ
+	UInt32 uiInfoOfs;			// BRAM Write  Offset
+	UInt32 uiPktSize;			// Ŷ ũ (<= sizeof(sModGpsHead))
+	UInt32 uiPktCnt;			// BRAM  Ŷ 
+	sRingBufInfo *pRing;		//  UDP  
+	TaskHandle_t *pxTask;		// Ž  Task (NULL: )
+} sSlotDesc;
+
+/* LVDS Ժ  / */
+typedef struct
+{
+	UInt8 ucWrIdxBefore;		//  BRAM Write  PL Write Index
+	UInt8 ucWrAddrBefore;		//  BRAM Write  PL Write Address
+	UInt32 uiPkt;				//  Ŷ 
+	UInt32 uiByte;				//  UDP  Ʈ 
+	UInt32 uiBramByte;			// BRAM Read Ʈ  ( + UDP  word)
+	UInt32 uiOverflow;			// Index/Address ġ (PL  ѹ ̻)
+	UInt32 uiBadLen;			// Ŷ /Write Address 
+	UInt32 uiRbFull;			//   
+	UInt32 uiMaxPend;			//  ֱ ִ  Ŷ 
+} sSlotStat;
+
+/* RS422    Լ (pData  ȣ ߿ ȿ) */
+typedef void (*UartRxSink_t)( UInt32 uiCh, const UInt8 *pData, UInt32 uiLen );
+
 extern void OpuTask( void *pvParameters );
 SInt32 SendToCom1(UInt8 *pData, UInt32 uiLen);
+UInt8 *SerialTxReserve( UInt32 uiCh, UInt32 *pMaxLen );			// RS422 TX    (zero-copy)
+SInt32 SerialTxCommit( UInt32 uiCh, UInt32 uiLen );				// RS422 TX   
+SInt32 SerialTxLock( UInt32 uiCh );									// RS422 TX  producer ȭ
+void SerialTxUnlock( UInt32 uiCh );									// RS422 TX  producer ȭ 
+void SlotRxReport( void );										// LVDS Ժ   
+void UartRxReport( void );										// RS422 äκ   
+void UartRxBenchmark( UInt32 uiMs, UInt32 uiPeriodMs );			// RS422  Drain ġũ
 
 #endif //__OPUTASK_H__
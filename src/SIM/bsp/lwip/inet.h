@@ -0,0 +1,17 @@
+/**
+ * @file inet.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - only INET_ADDRSTRLEN is needed by common.h
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_LWIP_INET_H__
+#define __SIM_LWIP_INET_H__
+
+#include <string.h>
+#include <arpa/inet.h>
+
+#endif /* __SIM_LWIP_INET_H__ */
@@ -0,0 +1,16 @@
+/**
+ * @file sleep.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - busy sleep helpers
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_SLEEP_H__
+#define __SIM_SLEEP_H__
+
+#include <unistd.h>
+
+#endif /* __SIM_SLEEP_H__ */
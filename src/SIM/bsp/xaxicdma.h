@@ -0,0 +1,55 @@
+/**
+ * @file xaxicdma.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - AXI CDMA simple mode (SIM_CDMA builds)
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * A started transfer is copied on the next fabric tick (SimBspCdmaStep) and
+ * completes through the interrupt connected to XAxiCdma_IntrHandler.
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XAXICDMA_H__
+#define __SIM_XAXICDMA_H__
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xparameters.h"
+
+#define XAXICDMA_XR_IRQ_IOC_MASK        0x00001000U
+#define XAXICDMA_XR_IRQ_DELAY_MASK      0x00002000U
+#define XAXICDMA_XR_IRQ_ERROR_MASK      0x00004000U
+#define XAXICDMA_XR_IRQ_ALL_MASK        0x00007000U
+
+typedef void (*XAxiCdma_CallBackFn)( void *CallBackRef, u32 IrqMask, int *IgnorePtr );
+
+typedef struct {
+    u32 DeviceId;
+    UINTPTR BaseAddress;
+} XAxiCdma_Config;
+
+typedef struct {
+    UINTPTR BaseAddr;
+    u32 IntrMask;                       // enabled IRQ sources
+    volatile u32 SimpleNotDone;         // transfer in flight
+    UINTPTR SrcAddr;
+    UINTPTR DstAddr;
+    u32 Length;
+    XAxiCdma_CallBackFn SimpleCallBackFn;
+    void *SimpleCallBackRef;
+    u32 StartCnt;                       // SimpleTransfer calls
+    u32 FailEvery;                      // refuse every n-th start (SIM_CDMA_FAIL, 0 = never)
+} XAxiCdma;
+
+XAxiCdma_Config *XAxiCdma_LookupConfig( u32 DeviceId );
+u32 XAxiCdma_CfgInitialize( XAxiCdma *InstancePtr, XAxiCdma_Config *CfgPtr, UINTPTR EffectiveAddr );
+u32 XAxiCdma_SimpleTransfer( XAxiCdma *InstancePtr, UINTPTR SrcAddr, UINTPTR DstAddr, int Length,
+        XAxiCdma_CallBackFn SimpleCallBack, void *CallbackRef );
+void XAxiCdma_IntrHandler( void *InstancePtr );
+void XAxiCdma_IntrEnable( XAxiCdma *InstancePtr, u32 Mask );
+void XAxiCdma_Reset( XAxiCdma *InstancePtr );
+int XAxiCdma_ResetIsDone( XAxiCdma *InstancePtr );
+
+#endif /* __SIM_XAXICDMA_H__ */
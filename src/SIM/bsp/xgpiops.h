@@ -0,0 +1,37 @@
+/**
+ * @file xgpiops.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - PS GPIO (PHY reset pins are no-ops)
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XGPIOPS_H__
+#define __SIM_XGPIOPS_H__
+
+#include <unistd.h>
+#include <string.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xparameters.h"
+
+typedef struct {
+    u16 DeviceId;
+    UINTPTR BaseAddr;
+} XGpioPs_Config;
+
+typedef struct {
+    XGpioPs_Config GpioConfig;
+    u32 IsReady;
+} XGpioPs;
+
+XGpioPs_Config *XGpioPs_LookupConfig( u16 DeviceId );
+s32 XGpioPs_CfgInitialize( XGpioPs *InstancePtr, const XGpioPs_Config *ConfigPtr, UINTPTR EffectiveAddr );
+void XGpioPs_SetDirectionPin( XGpioPs *InstancePtr, u32 Pin, u32 Direction );
+void XGpioPs_SetOutputEnablePin( XGpioPs *InstancePtr, u32 Pin, u32 OpEnable );
+void XGpioPs_WritePin( XGpioPs *InstancePtr, u32 Pin, u32 Data );
+u32 XGetPlatform_Info( void );
+
+#endif /* __SIM_XGPIOPS_H__ */
@@ -0,0 +1,19 @@
+/**
+ * @file xil_cache.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - L1/L2 cache maintenance (host memory is coherent)
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XIL_CACHE_H__
+#define __SIM_XIL_CACHE_H__
+
+#include "xil_types.h"
+
+static inline void Xil_DCacheFlushRange( INTPTR adr, u32 len )      { (void)adr; (void)len; }
+static inline void Xil_DCacheInvalidateRange( INTPTR adr, u32 len ) { (void)adr; (void)len; }
+
+#endif /* __SIM_XIL_CACHE_H__ */
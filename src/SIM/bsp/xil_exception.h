@@ -0,0 +1,19 @@
+/**
+ * @file xil_exception.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - exception handler types
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XIL_EXCEPTION_H__
+#define __SIM_XIL_EXCEPTION_H__
+
+#include "xil_types.h"
+
+typedef void (*Xil_ExceptionHandler)( void *data );
+typedef void (*Xil_InterruptHandler)( void *data );
+
+#endif /* __SIM_XIL_EXCEPTION_H__ */
@@ -0,0 +1,24 @@
+/**
+ * @file xil_io.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - register access into the emulated PL window
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XIL_IO_H__
+#define __SIM_XIL_IO_H__
+
+#include "xil_types.h"
+
+static inline u8 Xil_In8( UINTPTR Addr )   { return *(volatile u8 *)Addr; }
+static inline u16 Xil_In16( UINTPTR Addr ) { return *(volatile u16 *)Addr; }
+static inline u32 Xil_In32( UINTPTR Addr ) { return *(volatile u32 *)Addr; }
+
+static inline void Xil_Out8( UINTPTR Addr, u8 Value )   { *(volatile u8 *)Addr = Value; }
+static inline void Xil_Out16( UINTPTR Addr, u16 Value ) { *(volatile u16 *)Addr = Value; }
+static inline void Xil_Out32( UINTPTR Addr, u32 Value ) { *(volatile u32 *)Addr = Value; }
+
+#endif /* __SIM_XIL_IO_H__ */
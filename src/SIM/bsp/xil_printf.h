@@ -0,0 +1,23 @@
+/**
+ * @file xil_printf.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - console output
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XIL_PRINTF_H__
+#define __SIM_XIL_PRINTF_H__
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include "xil_types.h"
+#include "xparameters.h"
+
+void xil_printf( const char8 *ctrl1, ... );
+
+#endif /* __SIM_XIL_PRINTF_H__ */
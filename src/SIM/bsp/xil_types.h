@@ -0,0 +1,29 @@
+/**
+ * @file xil_types.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - Xilinx basic types (ILP32 build)
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XIL_TYPES_H__
+#define __SIM_XIL_TYPES_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t     u8;
+typedef uint16_t    u16;
+typedef uint32_t    u32;
+typedef uint64_t    u64;
+typedef int8_t      s8;
+typedef int16_t     s16;
+typedef int32_t     s32;
+typedef int64_t     s64;
+typedef char        char8;
+typedef uintptr_t   UINTPTR;
+typedef intptr_t    INTPTR;
+
+#endif /* __SIM_XIL_TYPES_H__ */
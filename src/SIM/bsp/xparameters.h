@@ -0,0 +1,31 @@
+/**
+ * @file xparameters.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - hardware parameters used by the firmware
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XPARAMETERS_H__
+#define __SIM_XPARAMETERS_H__
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+#define XPAR_CPU_CORTEXA9_CORE_CLOCK_FREQ_HZ    666666687
+
+#define XPAR_XGPIOPS_0_DEVICE_ID                0
+#define XPAR_XUARTPS_0_DEVICE_ID                0
+#define XPAR_XUARTPS_0_BASEADDR                 0xE0000000
+
+/* AXI CDMA, emulated by the BSP shim (make SIM_CDMA=1) */
+#ifdef SIM_CDMA
+#define XPAR_XAXICDMA_NUM_INSTANCES             1
+#define XPAR_AXICDMA_0_DEVICE_ID                0
+#define XPAR_AXICDMA_0_BASEADDR                 0x7E200000
+#define XPAR_FABRIC_AXI_CDMA_0_CDMA_INTROUT_INTR 68U
+#endif
+
+#endif /* __SIM_XPARAMETERS_H__ */
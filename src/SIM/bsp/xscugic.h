@@ -0,0 +1,36 @@
+/**
+ * @file xscugic.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - GIC, fabric interrupts are raised by sim_pl.c
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XSCUGIC_H__
+#define __SIM_XSCUGIC_H__
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xil_exception.h"
+
+#define XSCUGIC_MAX_NUM_INTR_INPUTS     95U
+
+typedef struct {
+    Xil_InterruptHandler Handler;
+    void *CallBackRef;
+    u8 Enabled;
+} XScuGic_VectorTableEntry;
+
+typedef struct {
+    XScuGic_VectorTableEntry HandlerTable[XSCUGIC_MAX_NUM_INTR_INPUTS];
+} XScuGic;
+
+void XScuGic_SetPriorityTriggerType( XScuGic *InstancePtr, u32 Int_Id, u8 Priority, u8 Trigger );
+s32 XScuGic_Connect( XScuGic *InstancePtr, u32 Int_Id, Xil_InterruptHandler Handler, void *CallBackRef );
+void XScuGic_Disconnect( XScuGic *InstancePtr, u32 Int_Id );
+void XScuGic_Enable( XScuGic *InstancePtr, u32 Int_Id );
+void XScuGic_Disable( XScuGic *InstancePtr, u32 Int_Id );
+
+#endif /* __SIM_XSCUGIC_H__ */
@@ -0,0 +1,19 @@
+/**
+ * @file xstatus.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - Xilinx status codes
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XSTATUS_H__
+#define __SIM_XSTATUS_H__
+
+#include "xil_types.h"
+
+#define XST_SUCCESS     0L
+#define XST_FAILURE     1L
+
+#endif /* __SIM_XSTATUS_H__ */
@@ -0,0 +1,25 @@
+/**
+ * @file xtime_l.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - Cortex-A9 global timer
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XTIME_L_H__
+#define __SIM_XTIME_L_H__
+
+#include "xil_types.h"
+#include "xparameters.h"
+
+typedef u64 XTime;
+
+/* Global timer runs at half the CPU clock, same as the target BSP */
+#define COUNTS_PER_SECOND   (XPAR_CPU_CORTEXA9_CORE_CLOCK_FREQ_HZ / 2)
+
+void XTime_SetTime( XTime Xtime_Global );
+void XTime_GetTime( XTime *Xtime_Global );
+
+#endif /* __SIM_XTIME_L_H__ */
@@ -0,0 +1,37 @@
+/**
+ * @file xuartps.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim - PS UART (debug console on stdin/stdout)
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_XUARTPS_H__
+#define __SIM_XUARTPS_H__
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xparameters.h"
+
+#define XUARTPS_OPER_MODE_NORMAL    0x00U
+
+typedef struct {
+    u16 DeviceId;
+    UINTPTR BaseAddress;
+} XUartPs_Config;
+
+typedef struct {
+    XUartPs_Config Config;
+    u32 IsReady;
+} XUartPs;
+
+XUartPs_Config *XUartPs_LookupConfig( u16 DeviceId );
+s32 XUartPs_CfgInitialize( XUartPs *InstancePtr, XUartPs_Config *Config, UINTPTR EffectiveAddr );
+s32 XUartPs_SelfTest( XUartPs *InstancePtr );
+void XUartPs_SetOperMode( XUartPs *InstancePtr, u8 OperationMode );
+u32 XUartPs_IsReceiveData( UINTPTR BaseAddress );
+u8 XUartPs_RecvByte( UINTPTR BaseAddress );
+
+#endif /* __SIM_XUARTPS_H__ */
@@ -0,0 +1,343 @@
+/**
+ * @file sim_bsp.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Host simulation BSP shim implementation (console, timer, GIC, GPIO)
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifdef SIM_HOST
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/select.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "xil_printf.h"
+#include "xtime_l.h"
+#include "xscugic.h"
+#include "xuartps.h"
+#include "xgpiops.h"
+#ifdef SIM_CDMA
+#include "xaxicdma.h"
+#endif
+
+#include "sim_pl.h"
+
+/*==============================================================================
+ * Gloabal Variables
+ *============================================================================*/
+XScuGic xInterruptController;				// GIC instance (owned by the Zynq port on target)
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+static XUartPs_Config stUartConfig = { XPAR_XUARTPS_0_DEVICE_ID, XPAR_XUARTPS_0_BASEADDR };
+static XGpioPs_Config stGpioConfig = { XPAR_XGPIOPS_0_DEVICE_ID, 0 };
+static SInt64 sllTimeOffset = 0;			// XTime_SetTime offset (counts)
+#ifdef SIM_CDMA
+static XAxiCdma_Config stCdmaConfig = { XPAR_AXICDMA_0_DEVICE_ID, XPAR_AXICDMA_0_BASEADDR };
+static XAxiCdma *pSimCdma = NULL;			// instance started last (SimBspCdmaStep)
+#endif
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @fn xil_printf
+ * @brief Console output (stdout, flushed per call like the PS UART)
+ */
+void xil_printf( const char8 *ctrl1, ... )
+{
+	va_list args;
+
+	va_start( args, ctrl1 );
+	vprintf( ctrl1, args );
+	va_end( args );
+	fflush( stdout );
+}
+
+/**
+ * @fn XTime_GetTime
+ * @brief Global timer read, derived from CLOCK_MONOTONIC
+ */
+void XTime_GetTime( XTime *Xtime_Global )
+{
+	struct timespec stTs;
+	UInt64 ullCounts;
+
+	clock_gettime( CLOCK_MONOTONIC, &stTs );
+	ullCounts = ((UInt64)stTs.tv_sec * COUNTS_PER_SECOND) +
+			(((UInt64)stTs.tv_nsec * COUNTS_PER_SECOND) / 1000000000ULL);
+
+	*Xtime_Global = (XTime)((SInt64)ullCounts + sllTimeOffset);
+}
+
+/**
+ * @fn XTime_SetTime
+ * @brief Global timer write (applied as an offset)
+ */
+void XTime_SetTime( XTime Xtime_Global )
+{
+	XTime xNow;
+
+	sllTimeOffset = 0;
+	XTime_GetTime( &xNow );
+	sllTimeOffset = (SInt64)Xtime_Global - (SInt64)xNow;
+}
+
+void XScuGic_SetPriorityTriggerType( XScuGic *InstancePtr, u32 Int_Id, u8 Priority, u8 Trigger )
+{
+	(void)InstancePtr; (void)Int_Id; (void)Priority; (void)Trigger;
+}
+
+s32 XScuGic_Connect( XScuGic *InstancePtr, u32 Int_Id, Xil_InterruptHandler Handler, void *CallBackRef )
+{
+	if( Int_Id >= XSCUGIC_MAX_NUM_INTR_INPUTS ) return XST_FAILURE;
+
+	InstancePtr->HandlerTable[Int_Id].Handler = Handler;
+	InstancePtr->HandlerTable[Int_Id].CallBackRef = CallBackRef;
+	return XST_SUCCESS;
+}
+
+void XScuGic_Disconnect( XScuGic *InstancePtr, u32 Int_Id )
+{
+	if( Int_Id >= XSCUGIC_MAX_NUM_INTR_INPUTS ) return;
+
+	InstancePtr->HandlerTable[Int_Id].Handler = NULL;
+	InstancePtr->HandlerTable[Int_Id].Enabled = 0;
+}
+
+void XScuGic_Enable( XScuGic *InstancePtr, u32 Int_Id )
+{
+	if( Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS ) InstancePtr->HandlerTable[Int_Id].Enabled = 1;
+}
+
+void XScuGic_Disable( XScuGic *InstancePtr, u32 Int_Id )
+{
+	if( Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS ) InstancePtr->HandlerTable[Int_Id].Enabled = 0;
+}
+
+/**
+ * @fn SimBspRaiseIrq
+ * @brief Deliver a fabric interrupt to the connected handler
+ * @param uiIntId GIC interrupt ID
+ * @return void
+ * @date 2026-10-16
+ */
+void SimBspRaiseIrq( UInt32 uiIntId )
+{
+	XScuGic_VectorTableEntry *pEntry;
+
+	if( uiIntId >= XSCUGIC_MAX_NUM_INTR_INPUTS ) return;
+
+	pEntry = &xInterruptController.HandlerTable[uiIntId];
+	if( (pEntry->Enabled != 0) && (pEntry->Handler != NULL) )
+	{
+		pEntry->Handler( pEntry->CallBackRef );
+	}
+}
+
+XUartPs_Config *XUartPs_LookupConfig( u16 DeviceId )
+{
+	(void)DeviceId;
+	return &stUartConfig;
+}
+
+s32 XUartPs_CfgInitialize( XUartPs *InstancePtr, XUartPs_Config *Config, UINTPTR EffectiveAddr )
+{
+	InstancePtr->Config = *Config;
+	InstancePtr->Config.BaseAddress = EffectiveAddr;
+	InstancePtr->IsReady = 1;
+	return XST_SUCCESS;
+}
+
+s32 XUartPs_SelfTest( XUartPs *InstancePtr )
+{
+	(void)InstancePtr;
+	return XST_SUCCESS;
+}
+
+void XUartPs_SetOperMode( XUartPs *InstancePtr, u8 OperationMode )
+{
+	(void)InstancePtr; (void)OperationMode;
+}
+
+/**
+ * @fn XUartPs_IsReceiveData
+ * @brief Debug console RX poll (stdin, non-blocking)
+ */
+u32 XUartPs_IsReceiveData( UINTPTR BaseAddress )
+{
+	fd_set stFds;
+	struct timeval stTv = { 0, 0 };
+
+	(void)BaseAddress;
+	FD_ZERO( &stFds );
+	FD_SET( STDIN_FILENO, &stFds );
+
+	return (select( STDIN_FILENO + 1, &stFds, NULL, NULL, &stTv ) > 0) ? 1U : 0U;
+}
+
+u8 XUartPs_RecvByte( UINTPTR BaseAddress )
+{
+	UInt8 ucByte = 0;
+
+	(void)BaseAddress;
+	if( read( STDIN_FILENO, &ucByte, 1 ) != 1 ) ucByte = 0;
+
+	return ucByte;
+}
+
+XGpioPs_Config *XGpioPs_LookupConfig( u16 DeviceId )
+{
+	(void)DeviceId;
+	return &stGpioConfig;
+}
+
+s32 XGpioPs_CfgInitialize( XGpioPs *InstancePtr, const XGpioPs_Config *ConfigPtr, UINTPTR EffectiveAddr )
+{
+	InstancePtr->GpioConfig = *ConfigPtr;
+	InstancePtr->GpioConfig.BaseAddr = EffectiveAddr;
+	InstancePtr->IsReady = 1;
+	return XST_SUCCESS;
+}
+
+void XGpioPs_SetDirectionPin( XGpioPs *InstancePtr, u32 Pin, u32 Direction )
+{
+	(void)InstancePtr; (void)Pin; (void)Direction;
+}
+
+void XGpioPs_SetOutputEnablePin( XGpioPs *InstancePtr, u32 Pin, u32 OpEnable )
+{
+	(void)InstancePtr; (void)Pin; (void)OpEnable;
+}
+
+void XGpioPs_WritePin( XGpioPs *InstancePtr, u32 Pin, u32 Data )
+{
+	(void)InstancePtr; (void)Pin; (void)Data;
+}
+
+u32 XGetPlatform_Info( void )
+{
+	return 0;
+}
+
+#ifdef SIM_CDMA
+XAxiCdma_Config *XAxiCdma_LookupConfig( u32 DeviceId )
+{
+	return (DeviceId == XPAR_AXICDMA_0_DEVICE_ID) ? &stCdmaConfig : NULL;
+}
+
+u32 XAxiCdma_CfgInitialize( XAxiCdma *InstancePtr, XAxiCdma_Config *CfgPtr, UINTPTR EffectiveAddr )
+{
+	const char *pValue = getenv( SIM_ENV_CDMA_FAIL );
+
+	(void)CfgPtr;
+	memset( InstancePtr, 0x00, sizeof(XAxiCdma) );
+	InstancePtr->BaseAddr = EffectiveAddr;
+	InstancePtr->FailEvery = (pValue != NULL) ? (u32)strtoul( pValue, NULL, 0 ) : 0;
+	pSimCdma = InstancePtr;
+
+	printf( "[SIM] AXI CDMA emulated (IRQ %u), refuse every %lu-th start\n",
+			XPAR_FABRIC_AXI_CDMA_0_CDMA_INTROUT_INTR, (unsigned long)InstancePtr->FailEvery );
+	return XST_SUCCESS;
+}
+
+/**
+ * @fn XAxiCdma_SimpleTransfer
+ * @brief Latch one transfer; copied on the next fabric tick, then the IRQ fires
+ */
+u32 XAxiCdma_SimpleTransfer( XAxiCdma *InstancePtr, UINTPTR SrcAddr, UINTPTR DstAddr, int Length,
+		XAxiCdma_CallBackFn SimpleCallBack, void *CallbackRef )
+{
+	if( (InstancePtr->SimpleNotDone != 0) || (Length <= 0) ) return XST_FAILURE;
+
+	InstancePtr->StartCnt++;
+	if( (InstancePtr->FailEvery != 0) && ((InstancePtr->StartCnt % InstancePtr->FailEvery) == 0) )
+	{
+		return XST_FAILURE;
+	}
+
+	InstancePtr->SrcAddr = SrcAddr;
+	InstancePtr->DstAddr = DstAddr;
+	InstancePtr->Length = (u32)Length;
+	InstancePtr->SimpleCallBackFn = SimpleCallBack;
+	InstancePtr->SimpleCallBackRef = CallbackRef;
+	InstancePtr->SimpleNotDone = 1;
+	return XST_SUCCESS;
+}
+
+void XAxiCdma_IntrHandler( void *InstancePtr )
+{
+	XAxiCdma *pCdma = (XAxiCdma *)InstancePtr;
+	XAxiCdma_CallBackFn pfnDone = pCdma->SimpleCallBackFn;
+
+	if( pCdma->SimpleNotDone == 0 ) return;
+
+	pCdma->SimpleNotDone = 0;
+	if( (pfnDone != NULL) && ((pCdma->IntrMask & XAXICDMA_XR_IRQ_IOC_MASK) != 0) )
+	{
+		pfnDone( pCdma->SimpleCallBackRef, XAXICDMA_XR_IRQ_IOC_MASK, NULL );
+	}
+}
+
+void XAxiCdma_IntrEnable( XAxiCdma *InstancePtr, u32 Mask )
+{
+	InstancePtr->IntrMask |= (Mask & XAXICDMA_XR_IRQ_ALL_MASK);
+}
+
+void XAxiCdma_Reset( XAxiCdma *InstancePtr )
+{
+	InstancePtr->SimpleNotDone = 0;
+	InstancePtr->IntrMask = 0;
+}
+
+int XAxiCdma_ResetIsDone( XAxiCdma *InstancePtr )
+{
+	(void)InstancePtr;
+	return 1;
+}
+#endif
+
+/**
+ * @fn SimBspCdmaStep
+ * @brief Emulated AXI CDMA (fabric tick): copy the transfer in flight and raise its IRQ
+ * @param void
+ * @return void
+ * @date 2026-10-16
+ */
+void SimBspCdmaStep( void )
+{
+#ifdef SIM_CDMA
+	if( (pSimCdma == NULL) || (pSimCdma->SimpleNotDone == 0) ) return;
+
+	memcpy( (void *)pSimCdma->DstAddr, (const void *)pSimCdma->SrcAddr, pSimCdma->Length );
+	SimBspRaiseIrq( XPAR_FABRIC_AXI_CDMA_0_CDMA_INTROUT_INTR );
+#endif
+}
+
+/**
+ * @fn vAssertCalled
+ * @brief configASSERT handler for the host build
+ */
+void vAssertCalled( const char * const pcFileName, unsigned long ulLine )
+{
+	printf( "[SIM] ASSERT %s:%lu\n", pcFileName, ulLine );
+	fflush( stdout );
+	abort();
+}
+
+#endif /* SIM_HOST */
@@ -0,0 +1,706 @@
+/**
+ * @file sim_pl.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Emulated PL/BRAM fabric for the host-native simulation build
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Emulates the PL side of the PS<->PL interface:
+ *   - SLOT#1 (GPS) / SLOT#2 (STIM300) LVDS RX BRAM rings + write info word
+ *   - RS422 COM1~6 RX BRAM rings (COM1 carries KISS/CSP/CCSDS telecommands)
+ *   - RS422 TX doorbell, TX busy status at the configured line rate
+ *   - IRQ0 sync interrupt
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifdef SIM_HOST
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+#include "sim_pl.h"
+#include "../common/common.h"
+#include "../OPU/opu_task.h"
+#include "../IGNU/Inc/TMTC.h"
+#include "../IGNU/Inc/ins_gps.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define SIM_PL_BASE             BRAM_ADDR_CTL_PL        // PL BRAM window start
+#define SIM_PL_SIZE             0x00250000              // up to BRAM_ADDR_CTL_PCM + 0x2000
+#define SIM_XADC_SIZE           0x1000
+
+#define SIM_SLOT_INFO_OFS       65532                   // LVDS RX write info (addr, idx)
+#define SIM_UART_INFO_OFS       16380                   // RS422 RX write info (addr, -, -, sts)
+#define SIM_UART_RX_STRIDE      (BRAM_ADDR_RE_UART_02 - BRAM_ADDR_RE_UART_01)
+#define SIM_UART_TX_STRIDE      (BRAM_ADDR_WR_UART_02 - BRAM_ADDR_WR_UART_01)
+#define SIM_UART_STS_STRIDE     (BRAM_ADDR_STS_UART_02 - BRAM_ADDR_STS_UART_01)
+
+#define SIM_IP_UDP_HDR_LEN      28                      // usTotalLen = payload + IP(20) + UDP(8)
+#define SIM_RATE_SCALE          1000                    // rate accumulator unit (1 ms tick)
+
+/* KISS Protocol (PDHS side) */
+#define SIM_KISS_FEND           0xC0
+#define SIM_KISS_FESC           0xDB
+#define SIM_KISS_TFEND          0xDC
+#define SIM_KISS_TFESC          0xDD
+
+#define SIM_TC_USER_LEN         12                      // Ping: Seq(4) + XTime(8)
+#define SIM_TM_USER_OFS         (CSP_HEADER_SIZE + CCSDS_PRI_HEADER_SIZE + CCSDS_TM_SEC_HEADER_SIZE)
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+typedef struct {
+    UInt32 uiBase;          // BRAM RX window
+    UInt32 uiRateHz;        // packet rate
+    UInt32 uiAcc;           // rate accumulator
+    UInt8 ucWrAddr;         // PL write address (0 ~ GPS_BRAM_PACKET-1)
+    UInt8 ucWrIdx;          // PL write index (0 ~ MAX_IDX-1)
+} SimSlotGen_t;
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+static SimPlConfig_t stSimConfig;
+static SimPlStats_t stSimStats;
+
+static SimSlotGen_t stGpsGen;
+static SimSlotGen_t stImuGen;
+
+static UInt32 uiIrqAcc = 0;
+static UInt32 uiCom1Acc = 0;
+static UInt32 uiUartAcc = 0;
+
+static volatile UInt8 ucPlReady = 0;                    // CMD_PL_READY received
+static XTime xTxBusyUntil[MAX_UART_CH];                 // TX busy emulation
+
+static UInt32 uiGpsTow = 0;
+static UInt8 ucGpsSendCnt = 0;
+static UInt8 ucImuCounter = 0;
+static UInt32 uiPingSeq = 0;
+static UInt16 usTcSeq = 0;
+
+static UInt8 ucSimPkt[UART_BRAM_SIZE];
+static UInt8 ucSimFrame[UART_BRAM_SIZE];
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static UInt32 SimEnv( const char *pName, UInt32 uiDefault );
+static UInt32 SimCrc32c( const UInt8 *pData, UInt32 uiLen );
+static UInt16 SimCrc16( const UInt8 *pData, UInt32 uiLen );
+static UInt32 SimTcBuild( UInt8 ucSvc, UInt8 ucSub, const UInt8 *pUser, UInt32 uiUserLen, UInt8 *pOut );
+static void SimSlotPush( SimSlotGen_t *pGen, const UInt8 *pPayload, UInt32 uiLen, UInt32 uiPackets );
+static void SimUartRxPush( UInt32 uiCh, const UInt8 *pData, UInt32 uiLen );
+static void SimGpsGen( void );
+static void SimImuGen( void );
+static void SimCom1Tc( UInt8 ucSvc, UInt8 ucSub );
+static void SimCom1TxParse( const UInt8 *pData, UInt32 uiLen );
+static UInt32 SimRateStep( UInt32 *pAcc, UInt32 uiRateHz );
+static void SimReport( void );
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @fn		SimEnv
+ * @brief	Read an unsigned configuration value from the environment
+ */
+static UInt32 SimEnv( const char *pName, UInt32 uiDefault )
+{
+	const char *pValue = getenv( pName );
+
+	return (pValue != NULL) ? (UInt32)strtoul( pValue, NULL, 0 ) : uiDefault;
+}
+
+/* CSP CRC-32C (PDHS side reference) */
+static UInt32 SimCrc32c( const UInt8 *pData, UInt32 uiLen )
+{
+	UInt32 crc = 0xFFFFFFFF;
+	UInt32 i, j;
+
+	for( i = 0; i < uiLen; i++ ) {
+		crc ^= pData[i];
+		for( j = 0; j < 8; j++ ) crc = (crc & 1) ? ((crc >> 1) ^ 0x82F63B78) : (crc >> 1);
+	}
+	return ~crc;
+}
+
+/* CCSDS CRC-16 CCITT-FALSE (PDHS side reference) */
+static UInt16 SimCrc16( const UInt8 *pData, UInt32 uiLen )
+{
+	UInt16 crc = 0xFFFF;
+	UInt32 i, j;
+
+	for( i = 0; i < uiLen; i++ ) {
+		crc ^= (UInt16)(pData[i] << 8);
+		for( j = 0; j < 8; j++ ) crc = (crc & 0x8000) ? (UInt16)((crc << 1) ^ 0x1021) : (UInt16)(crc << 1);
+	}
+	return crc;
+}
+
+/**
+ * @fn		SimTcBuild
+ * @brief	Build a PDHS telecommand frame (KISS + CSP + CCSDS TC)
+ * @param	ucSvc, ucSub : PUS service / subtype
+ * @param	pUser, uiUserLen : TC user data
+ * @param	pOut : KISS frame output
+ * @return	KISS frame length
+ * @date	2026-10-16
+ */
+static UInt32 SimTcBuild( UInt8 ucSvc, UInt8 ucSub, const UInt8 *pUser, UInt32 uiUserLen, UInt8 *pOut )
+{
+	UInt8 ucRaw[CSP_HEADER_SIZE + CCSDS_PRI_HEADER_SIZE + CCSDS_TC_SEC_HEADER_SIZE + SIM_TC_USER_LEN + 2 + CSP_CRC32_SIZE];
+	UInt8 *pCcsds = &ucRaw[CSP_HEADER_SIZE];
+	UInt32 uiLen = 0;
+	UInt32 uiHeader = 0;
+	UInt32 uiCrc;
+	UInt16 usCrc;
+	UInt32 i;
+	UInt32 uiOut = 0;
+
+	if( uiUserLen > SIM_TC_USER_LEN ) uiUserLen = SIM_TC_USER_LEN;
+
+	/* CSP Header: Prio 2, Src PDHS, Dest IGNU, DPort CMD */
+	uiHeader |= (2 & 0x03) << 30;
+	uiHeader |= (CSP_MY_ADDR & 0x1F) << 25;
+	uiHeader |= (CSP_PDHS_ADDR & 0x1F) << 20;
+	uiHeader |= (CSP_PORT_CMD_RX & 0x3F) << 14;
+	uiHeader |= (CSP_PORT_ASYNC_TX & 0x3F) << 8;
+	ucRaw[0] = (uiHeader >> 24) & 0xFF;
+	ucRaw[1] = (uiHeader >> 16) & 0xFF;
+	ucRaw[2] = (uiHeader >> 8) & 0xFF;
+	ucRaw[3] = uiHeader & 0xFF;
+
+	/* CCSDS TC Primary Header: Type(1=TC) | SecHdr(1) | APID */
+	pCcsds[uiLen++] = (0x1800 | CCSDS_APID_IGNU) >> 8;
+	pCcsds[uiLen++] = CCSDS_APID_IGNU & 0xFF;
+	pCcsds[uiLen++] = 0xC0 | ((usTcSeq >> 8) & 0x3F);
+	pCcsds[uiLen++] = usTcSeq & 0xFF;
+	usTcSeq = (usTcSeq + 1) & 0x3FFF;
+	pCcsds[uiLen++] = ((CCSDS_TC_SEC_HEADER_SIZE + uiUserLen + 2 - 1) >> 8) & 0xFF;
+	pCcsds[uiLen++] = (CCSDS_TC_SEC_HEADER_SIZE + uiUserLen + 2 - 1) & 0xFF;
+
+	/* TC Secondary Header */
+	pCcsds[uiLen++] = ucSvc;
+	pCcsds[uiLen++] = ucSub;
+	pCcsds[uiLen++] = 0x00;
+	pCcsds[uiLen++] = 0x00;
+
+	if( uiUserLen > 0 ) {
+		memcpy( &pCcsds[uiLen], pUser, uiUserLen );
+		uiLen += uiUserLen;
+	}
+
+	usCrc = SimCrc16( pCcsds, uiLen );
+	pCcsds[uiLen++] = (usCrc >> 8) & 0xFF;
+	pCcsds[uiLen++] = usCrc & 0xFF;
+
+	/* CSP CRC-32C over CSP payload (IGNU convention) */
+	uiCrc = SimCrc32c( pCcsds, uiLen );
+	uiLen += CSP_HEADER_SIZE;
+	ucRaw[uiLen++] = (uiCrc >> 24) & 0xFF;
+	ucRaw[uiLen++] = (uiCrc >> 16) & 0xFF;
+	ucRaw[uiLen++] = (uiCrc >> 8) & 0xFF;
+	ucRaw[uiLen++] = uiCrc & 0xFF;
+
+	/* KISS Encode */
+	pOut[uiOut++] = SIM_KISS_FEND;
+	pOut[uiOut++] = 0x00;
+	for( i = 0; i < uiLen; i++ ) {
+		if( ucRaw[i] == SIM_KISS_FEND ) { pOut[uiOut++] = SIM_KISS_FESC; pOut[uiOut++] = SIM_KISS_TFEND; }
+		else if( ucRaw[i] == SIM_KISS_FESC ) { pOut[uiOut++] = SIM_KISS_FESC; pOut[uiOut++] = SIM_KISS_TFESC; }
+		else pOut[uiOut++] = ucRaw[i];
+	}
+	pOut[uiOut++] = SIM_KISS_FEND;
+
+	return uiOut;
+}
+
+/**
+ * @fn		SimSlotPush
+ * @brief	Write one LVDS RX packet (Eth/IP/UDP header + payload) to a slot BRAM ring
+ * @param	pGen : slot generator
+ * @param	pPayload, uiLen : UDP payload
+ * @param	uiPackets : ring depth (GPS_BRAM_PACKET / IMU_BRAM_PACKET)
+ * @return	void
+ * @date	2026-10-16
+ */
+static void SimSlotPush( SimSlotGen_t *pGen, const UInt8 *pPayload, UInt32 uiLen, UInt32 uiPackets )
+{
+	sModGpsHead *pPkt = (sModGpsHead *)(pGen->uiBase + (pGen->ucWrAddr * GPS_BRAM_SIZE));
+	volatile UInt32 *pInfo = (volatile UInt32 *)(pGen->uiBase + SIM_SLOT_INFO_OFS);
+
+	if( uiLen > sizeof(pPkt->ucData) ) uiLen = sizeof(pPkt->ucData);
+
+	memset( pPkt, 0x00, sizeof(sModGpsHead) - sizeof(pPkt->ucData) );
+	pPkt->stIpStructure.usTotalLen = (UInt16)(uiLen + SIM_IP_UDP_HDR_LEN);
+	memcpy( pPkt->ucData, pPayload, uiLen );
+
+	/* Write info is updated after the packet (PL write order) */
+	pGen->ucWrAddr = (pGen->ucWrAddr + 1) % uiPackets;
+	pGen->ucWrIdx = (pGen->ucWrIdx + 1) % MAX_IDX;
+	__atomic_thread_fence( __ATOMIC_RELEASE );
+	*pInfo = (UInt32)pGen->ucWrAddr | ((UInt32)pGen->ucWrIdx << 8);
+}
+
+/**
+ * @fn		SimUartRxPush
+ * @brief	Write one RS422 RX packet to a COM BRAM ring
+ * @param	uiCh : channel (0~5)
+ * @param	pData, uiLen : received bytes
+ * @return	void
+ * @date	2026-10-16
+ */
+static void SimUartRxPush( UInt32 uiCh, const UInt8 *pData, UInt32 uiLen )
+{
+	UInt32 uiBase = BRAM_ADDR_RE_UART_01 + (uiCh * SIM_UART_RX_STRIDE);
+	volatile UInt8 *pInfo = (volatile UInt8 *)(uiBase + SIM_UART_INFO_OFS);
+	UInt8 ucAddr = (UInt8)((pInfo[0] + 1) % UART_BRAM_PACKET);
+	UInt8 *pPkt = (UInt8 *)(uiBase + (ucAddr * UART_BRAM_SIZE));
+	UInt32 uiSize;
+
+	if( uiLen > (UART_BRAM_SIZE - 4) ) uiLen = UART_BRAM_SIZE - 4;
+	uiSize = uiLen;
+
+	pInfo[3] = PL_BRAM_WR_STS;				// write in progress
+	memcpy( pPkt, &uiSize, 4 );
+	memcpy( pPkt + 4, pData, uiLen );
+	__atomic_thread_fence( __ATOMIC_RELEASE );
+	pInfo[0] = ucAddr;
+	pInfo[3] = 0x00;
+}
+
+/**
+ * @fn		SimGpsGen
+ * @brief	Generate one GPS PVT packet (GpsRawData_t layout)
+ */
+static void SimGpsGen( void )
+{
+	GpsRawData_t stRaw;
+
+	memset( &stRaw, 0x00, sizeof(stRaw) );
+	((UInt8 *)&stRaw.syncWord)[0] = 0x24;
+	((UInt8 *)&stRaw.syncWord)[1] = 0x40;
+	stRaw.tow = uiGpsTow;
+	stRaw.wnc = 2400;
+	stRaw.mode = 1;
+	stRaw.latitude = 36.3504 * (3.14159265358979323846 / 180.0);
+	stRaw.longitude = 127.3845 * (3.14159265358979323846 / 180.0);
+	stRaw.height = 70.0;
+	stRaw.vn = 0.01f;
+	stRaw.ve = -0.02f;
+	stRaw.vu = 0.0f;
+	stRaw.nrSv = 12;
+	stRaw.hAccuracy = 150;
+	stRaw.vAccuracy = 250;
+	stRaw.sendingCnt = ucGpsSendCnt++;
+
+	uiGpsTow += (stSimConfig.uiGpsHz > 0) ? (1000 / stSimConfig.uiGpsHz) : 0;
+
+	SimSlotPush( &stGpsGen, (UInt8 *)&stRaw, GPS_RAW_PACKET_SIZE, GPS_BRAM_PACKET );
+	stSimStats.uiGpsPkts++;
+}
+
+/**
+ * @fn		SimImuGen
+ * @brief	Generate one IMU BRAM packet of uiImuRecords STIM300 records
+ */
+static void SimImuGen( void )
+{
+	UInt8 ucPayload[IMU_PACKET_SIZE * MESSAGE_COUNT];
+	UInt8 *pRec;
+	UInt32 i;
+	UInt32 uiRecords = stSimConfig.uiImuRecords;
+	SInt32 siGyroZ = (SInt32)(0.25f * GYRO_SCALE_FACTOR);		// 0.25 deg/s yaw rate
+	SInt32 siAccZ = (SInt32)(1.0f * ACCEL_SCALE_FACTOR);		// 1 g
+	SInt16 ssTemp = (SInt16)(35.0f * 256.0f);					// 35 degC
+
+	memset( ucPayload, 0x00, sizeof(ucPayload) );
+
+	for( i = 0; i < uiRecords; i++ )
+	{
+		pRec = &ucPayload[i * IMU_PACKET_SIZE];
+		pRec[0] = IMU_SYNC_BYTE;
+		pRec[7] = (siGyroZ >> 16) & 0xFF;
+		pRec[8] = (siGyroZ >> 8) & 0xFF;
+		pRec[9] = siGyroZ & 0xFF;
+		pRec[17] = (siAccZ >> 16) & 0xFF;
+		pRec[18] = (siAccZ >> 8) & 0xFF;
+		pRec[19] = siAccZ & 0xFF;
+		pRec[21] = (ssTemp >> 8) & 0xFF;
+		pRec[22] = ssTemp & 0xFF;
+		pRec[35] = ucImuCounter++;
+	}
+
+	SimSlotPush( &stImuGen, ucPayload, uiRecords * IMU_PACKET_SIZE, IMU_BRAM_PACKET );
+	stSimStats.uiImuPkts++;
+	stSimStats.uiImuRecords += uiRecords;
+}
+
+/**
+ * @fn		SimCom1Tc
+ * @brief	Send one telecommand on COM1 (Ping carries Seq + XTime for latency)
+ */
+static void SimCom1Tc( UInt8 ucSvc, UInt8 ucSub )
+{
+	UInt8 ucUser[SIM_TC_USER_LEN];
+	UInt32 uiUserLen = 0;
+	UInt32 uiFrameLen;
+	XTime xNow;
+
+	if( (ucSvc == PUS_SVC_DIAGNOSE) && (ucSub == PUS_SUB_DIAG_PING) )
+	{
+		XTime_GetTime( &xNow );
+		memcpy( &ucUser[0], &uiPingSeq, 4 );
+		memcpy( &ucUser[4], &xNow, 8 );
+		uiPingSeq++;
+		uiUserLen = SIM_TC_USER_LEN;
+	}
+
+	uiFrameLen = SimTcBuild( ucSvc, ucSub, ucUser, uiUserLen, ucSimFrame );
+	SimUartRxPush( 0, ucSimFrame, uiFrameLen );
+	stSimStats.uiCom1Tc++;
+}
+
+/**
+ * @fn		SimCom1TxParse
+ * @brief	Inspect a COM1 TX KISS frame (TM from IGNU) and match Ping replies
+ * @param	pData, uiLen : TX BRAM payload
+ * @return	void
+ * @date	2026-10-16
+ */
+static void SimCom1TxParse( const UInt8 *pData, UInt32 uiLen )
+{
+	UInt32 i;
+	UInt32 uiPkt = 0;
+	UInt8 ucEsc = 0;
+	UInt8 ucSvc, ucSub;
+	XTime xNow, xSent;
+	UInt32 uiRttUs;
+
+	/* KISS Decode (single frame per TX doorbell), skip FEND + CMD */
+	for( i = 0; i < uiLen; i++ )
+	{
+		if( pData[i] == SIM_KISS_FEND ) { if( uiPkt > 0 ) break; continue; }
+		if( ucEsc ) { ucSimPkt[uiPkt++] = (pData[i] == SIM_KISS_TFEND) ? SIM_KISS_FEND : SIM_KISS_FESC; ucEsc = 0; }
+		else if( pData[i] == SIM_KISS_FESC ) ucEsc = 1;
+		else ucSimPkt[uiPkt++] = pData[i];
+		if( uiPkt >= sizeof(ucSimPkt) ) return;
+	}
+
+	if( uiPkt < (1 + SIM_TM_USER_OFS) ) return;
+
+	/* ucSimPkt[0] is the KISS command byte */
+	ucSvc = ucSimPkt[1 + CSP_HEADER_SIZE + CCSDS_PRI_HEADER_SIZE];
+	ucSub = ucSimPkt[1 + CSP_HEADER_SIZE + CCSDS_PRI_HEADER_SIZE + 1];
+
+	if( (ucSvc == PUS_SVC_DIAGNOSE) && (ucSub == PUS_SUB_DIAG_PONG) &&
+			(uiPkt >= (1 + SIM_TM_USER_OFS + SIM_TC_USER_LEN)) )
+	{
+		XTime_GetTime( &xNow );
+		memcpy( &xSent, &ucSimPkt[1 + SIM_TM_USER_OFS + 4], 8 );
+		uiRttUs = (UInt32)(((xNow - xSent) * 1000000ULL) / COUNTS_PER_SECOND);
+
+		if( (stSimStats.uiPongCnt == 0) || (uiRttUs < stSimStats.uiRttMinUs) ) stSimStats.uiRttMinUs = uiRttUs;
+		if( uiRttUs > stSimStats.uiRttMaxUs ) stSimStats.uiRttMaxUs = uiRttUs;
+		stSimStats.ullRttSumUs += uiRttUs;
+		stSimStats.uiPongCnt++;
+	}
+	else if( (ucSvc == PUS_SVC_TEST) && (ucSub == PUS_SUB_TEST_REQ_DATA) )
+	{
+		stSimStats.uiTmTestData++;
+	}
+	else
+	{
+		stSimStats.uiTmOther++;
+	}
+}
+
+/**
+ * @fn		SimPlRegWrite
+ * @brief	PS->PL register write side effects (called from PsToPlCommand)
+ * @param	uiAddr : register address
+ * @param	uiValue : written value
+ * @return	void
+ * @date	2026-10-16
+ */
+void SimPlRegWrite( UInt32 uiAddr, UInt32 uiValue )
+{
+	UInt32 uiCh;
+	UInt32 uiTxAddr;
+	UInt32 uiTxLen;
+	XTime xNow;
+
+	if( (uiAddr == BRAM_ADDR_CTL_PL) && (uiValue == CMD_PL_READY) )
+	{
+		ucPlReady = 1;
+	}
+	else if( (uiAddr == BRAM_ADDR_CTL_PL) && (uiValue == CMD_PL_STOP) )
+	{
+		ucPlReady = 0;
+	}
+	else if( (uiAddr == BRAM_ADDR_CTL_UART_TX) &&
+			(uiValue >= CMD_RS422_CH01_TX_ENABLE) && (uiValue <= CMD_RS422_CH06_TX_ENABLE) )
+	{
+		uiCh = uiValue - CMD_RS422_CH01_TX_ENABLE;
+		uiTxAddr = BRAM_ADDR_WR_UART_01 + (uiCh * SIM_UART_TX_STRIDE);
+
+		/* TX BRAM: [Length(4)][Data] */
+		memcpy( &uiTxLen, (void *)uiTxAddr, 4 );
+		if( uiTxLen > (UART_BRAM_SIZE - 4) ) uiTxLen = UART_BRAM_SIZE - 4;
+
+		stSimStats.uiTxFrames[uiCh]++;
+		stSimStats.uiTxBytes[uiCh] += uiTxLen;
+
+		/* TX busy for the frame time on the line (10 bits per byte) */
+		XTime_GetTime( &xNow );
+		xTxBusyUntil[uiCh] = xNow + (((XTime)uiTxLen * 10ULL * COUNTS_PER_SECOND) / stSimConfig.uiBaudRate);
+		((volatile UInt8 *)(BRAM_ADDR_STS_UART_01 + (uiCh * SIM_UART_STS_STRIDE)))[2] = 1;
+
+		if( uiCh == 0 )
+		{
+			SimCom1TxParse( (const UInt8 *)(uiTxAddr + 4), uiTxLen );
+		}
+	}
+}
+
+/**
+ * @fn		SimRateStep
+ * @brief	Number of events due in this 1 ms tick for a given rate
+ */
+static UInt32 SimRateStep( UInt32 *pAcc, UInt32 uiRateHz )
+{
+	UInt32 uiDue;
+
+	*pAcc += uiRateHz;
+	uiDue = *pAcc / SIM_RATE_SCALE;
+	*pAcc %= SIM_RATE_SCALE;
+
+	return uiDue;
+}
+
+/**
+ * @fn		SimReport
+ * @brief	Print fabric statistics for the last report period
+ */
+static void SimReport( void )
+{
+	static SimPlStats_t stLast;
+	SimPlStats_t stNow = stSimStats;
+	UInt32 uiSec = stSimConfig.uiReportSec;
+	UInt32 uiTxBytes = 0;
+	UInt32 uiLastTxBytes = 0;
+	UInt32 uiPong = stNow.uiPongCnt - stLast.uiPongCnt;
+	UInt32 i;
+
+	for( i = 0; i < MAX_UART_CH; i++ )
+	{
+		uiTxBytes += stNow.uiTxBytes[i];
+		uiLastTxBytes += stLast.uiTxBytes[i];
+	}
+
+	xil_printf( "[SIM] IRQ %u/s GPS %u/s IMU %u rec/s COM1-TC %u UART-RX %u/s | TX %u B/s COM1 %u frm | TM test %u other %u\r\n",
+			(stNow.uiIrqCnt - stLast.uiIrqCnt) / uiSec,
+			(stNow.uiGpsPkts - stLast.uiGpsPkts) / uiSec,
+			(stNow.uiImuRecords - stLast.uiImuRecords) / uiSec,
+			stNow.uiCom1Tc - stLast.uiCom1Tc,
+			(stNow.uiUartRxPkts - stLast.uiUartRxPkts) / uiSec,
+			(uiTxBytes - uiLastTxBytes) / uiSec,
+			stNow.uiTxFrames[0] - stLast.uiTxFrames[0],
+			stNow.uiTmTestData - stLast.uiTmTestData,
+			stNow.uiTmOther - stLast.uiTmOther );
+
+	if( stNow.uiPongCnt > 0 )
+	{
+		xil_printf( "[SIM] Ping %u/%u replied, RTT(us) min %u avg %u max %u\r\n",
+				uiPong, stNow.uiCom1Tc - stLast.uiCom1Tc, stNow.uiRttMinUs,
+				(UInt32)(stNow.ullRttSumUs / stNow.uiPongCnt), stNow.uiRttMaxUs );
+	}
+
+	stLast = stNow;
+}
+
+/**
+ * @fn		SimPlGetStats
+ * @brief	Snapshot of the fabric statistics
+ */
+void SimPlGetStats( SimPlStats_t *pStats )
+{
+	if( pStats != NULL ) *pStats = stSimStats;
+}
+
+/**
+ * @fn		SimPlInit
+ * @brief	Map the PL windows at their physical addresses and read configuration
+ * @param	void
+ * @return	void
+ * @date	2026-10-16
+ */
+void SimPlInit( void )
+{
+	void *pMap;
+	plZynqTemp_t stTemp;
+
+	/* PL BRAM window */
+	pMap = mmap( (void *)SIM_PL_BASE, SIM_PL_SIZE, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0 );
+	if( pMap != (void *)SIM_PL_BASE )
+	{
+		printf( "[SIM] Error: PL window 0x%08X map failed (ILP32 build required)\n", SIM_PL_BASE );
+		exit( 1 );
+	}
+
+	/* XADC (Zynq temperature) */
+	pMap = mmap( (void *)XADC_BASE, SIM_XADC_SIZE, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0 );
+	if( pMap != (void *)XADC_BASE )
+	{
+		printf( "[SIM] Error: XADC window 0x%08X map failed\n", XADC_BASE );
+		exit( 1 );
+	}
+	stTemp.uiData = 0;
+	stTemp.stZynqTemp.usData = (UInt16)(((45.0 + 273.15) * 4096) / 503.975);
+	*(volatile UInt32 *)(XADC_BASE + 0x200) = stTemp.uiData;
+
+	/* Configuration */
+	stSimConfig.uiIrqHz = SimEnv( SIM_ENV_IRQ_HZ, 50 );
+	stSimConfig.uiGpsHz = SimEnv( SIM_ENV_GPS_HZ, 10 );
+	stSimConfig.uiImuHz = SimEnv( SIM_ENV_IMU_HZ, 2000 );
+	stSimConfig.uiImuRecords = SimEnv( SIM_ENV_IMU_RECORDS, 1 );
+	stSimConfig.uiCom1Hz = SimEnv( SIM_ENV_COM1_HZ, 1 );
+	stSimConfig.uiUartHz = SimEnv( SIM_ENV_UART_HZ, 0 );
+	stSimConfig.uiUartLen = SimEnv( SIM_ENV_UART_LEN, 64 );
+	stSimConfig.uiBaudRate = SimEnv( SIM_ENV_BAUDRATE, 921600 );
+	stSimConfig.uiReportSec = SimEnv( SIM_ENV_REPORT_SEC, 5 );
+	stSimConfig.uiStartTest = SimEnv( SIM_ENV_START_TEST, 1 );
+
+	if( stSimConfig.uiImuRecords < 1 ) stSimConfig.uiImuRecords = 1;
+	if( stSimConfig.uiImuRecords > MESSAGE_COUNT ) stSimConfig.uiImuRecords = MESSAGE_COUNT;
+	if( stSimConfig.uiBaudRate == 0 ) stSimConfig.uiBaudRate = 921600;
+	if( stSimConfig.uiUartLen > (UART_BRAM_SIZE - 4) )
+	{
+		/* RX slot = 4-byte length + payload; ucUartBuf in SimPlTask is one slot */
+		printf( "[SIM] %s %lu exceeds slot payload, using %u\n", SIM_ENV_UART_LEN, stSimConfig.uiUartLen, UART_BRAM_SIZE - 4 );
+		stSimConfig.uiUartLen = UART_BRAM_SIZE - 4;
+	}
+
+	memset( &stSimStats, 0x00, sizeof(stSimStats) );
+	memset( &stGpsGen, 0x00, sizeof(stGpsGen) );
+	memset( &stImuGen, 0x00, sizeof(stImuGen) );
+	stGpsGen.uiBase = BRAM_ADDR_RE_SLOT_01;
+	stGpsGen.uiRateHz = stSimConfig.uiGpsHz;
+	stImuGen.uiBase = BRAM_ADDR_RE_SLOT_02;
+	stImuGen.uiRateHz = (stSimConfig.uiImuHz + stSimConfig.uiImuRecords - 1) / stSimConfig.uiImuRecords;
+
+	printf( "[SIM] PL fabric: IRQ %lu Hz, GPS %lu Hz, IMU %lu Hz (%lu rec/pkt), COM1 %lu Hz, UART %lu Hz x %lu B, %lu bps\n",
+			stSimConfig.uiIrqHz, stSimConfig.uiGpsHz, stSimConfig.uiImuHz, stSimConfig.uiImuRecords,
+			stSimConfig.uiCom1Hz, stSimConfig.uiUartHz, stSimConfig.uiUartLen, stSimConfig.uiBaudRate );
+}
+
+/**
+ * @fn		SimPlTask
+ * @brief	Emulated PL fabric (1 ms): traffic generation, TX busy status, IRQ0
+ * @param	pvParameters : not used
+ * @return	void
+ * @date	2026-10-16
+ */
+void SimPlTask( void *pvParameters )
+{
+	const TickType_t x1ms = pdMS_TO_TICKS( DELAY_1_MSECOND );
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+	UInt32 uiTick = 0;
+	UInt32 uiReadyTick = 0;
+	UInt32 uiDue;
+	UInt32 uiCh;
+	UInt32 i;
+	XTime xNow;
+	UInt8 ucUartBuf[UART_BRAM_SIZE];
+
+	while(1)
+	{
+		vTaskDelayUntil( &xLastWakeTime, x1ms );
+		uiTick++;
+
+		/* TX busy status */
+		XTime_GetTime( &xNow );
+		for( uiCh = 0; uiCh < MAX_UART_CH; uiCh++ )
+		{
+			if( (xTxBusyUntil[uiCh] != 0) && (xNow >= xTxBusyUntil[uiCh]) )
+			{
+				xTxBusyUntil[uiCh] = 0;
+				((volatile UInt8 *)(BRAM_ADDR_STS_UART_01 + (uiCh * SIM_UART_STS_STRIDE)))[2] = 0;
+			}
+		}
+
+		/* AXI CDMA: one transfer per tick */
+		SimBspCdmaStep();
+
+		/* PL starts producing after CMD_PL_READY (SIU configuration done) */
+		if( ucPlReady == 0 )
+		{
+			uiReadyTick = uiTick;
+			continue;
+		}
+
+		/* Start Test once, 100 ms after PL ready */
+		if( (stSimConfig.uiStartTest != 0) && ((uiTick - uiReadyTick) == 100) )
+		{
+			SimCom1Tc( PUS_SVC_TEST, PUS_SUB_TEST_START );
+		}
+
+		/* LVDS SLOT#1 GPS */
+		uiDue = SimRateStep( &stGpsGen.uiAcc, stGpsGen.uiRateHz );
+		for( i = 0; i < uiDue; i++ ) SimGpsGen();
+
+		/* LVDS SLOT#2 STIM300 */
+		uiDue = SimRateStep( &stImuGen.uiAcc, stImuGen.uiRateHz );
+		for( i = 0; i < uiDue; i++ ) SimImuGen();
+
+		/* RS422 COM1 telecommand */
+		uiDue = SimRateStep( &uiCom1Acc, stSimConfig.uiCom1Hz );
+		for( i = 0; i < uiDue; i++ ) SimCom1Tc( PUS_SVC_DIAGNOSE, PUS_SUB_DIAG_PING );
+
+		/* RS422 COM2~6 */
+		uiDue = SimRateStep( &uiUartAcc, stSimConfig.uiUartHz );
+		for( i = 0; i < uiDue; i++ )
+		{
+			memset( ucUartBuf, (UInt8)stSimStats.uiUartRxPkts, stSimConfig.uiUartLen );
+			for( uiCh = 1; uiCh < MAX_UART_CH; uiCh++ )
+			{
+				SimUartRxPush( uiCh, ucUartBuf, stSimConfig.uiUartLen );
+				stSimStats.uiUartRxPkts++;
+			}
+		}
+
+		/* IRQ0 sync */
+		uiDue = SimRateStep( &uiIrqAcc, stSimConfig.uiIrqHz );
+		for( i = 0; i < uiDue; i++ )
+		{
+			SimBspRaiseIrq( XPAR_FABRIC_LN_IRQ0_INTR );
+			stSimStats.uiIrqCnt++;
+		}
+
+		/* Report */
+		if( (stSimConfig.uiReportSec > 0) && ((uiTick % (stSimConfig.uiReportSec * 1000)) == 0) )
+		{
+			SimReport();
+		}
+	}
+}
+
+#endif /* SIM_HOST */
@@ -0,0 +1,89 @@
+/**
+ * @file sim_pl.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Emulated PL/BRAM fabric for the host-native simulation build
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Host build (FreeRTOS GCC/Posix port, ILP32 to match the Cortex-A9 ABI):
+ *   cd src/SIM && make FREERTOS_KERNEL=<FreeRTOS-Kernel checkout> run
+ *   - Sources : src/main.c, src/common, src/OPU, src/SIU, src/DBG, src/IGNU/Src,
+ *               src/SIM, FreeRTOS kernel + portable/ThirdParty/GCC/Posix + heap_3
+ *   - Flags   : -m32 -DSIM_HOST -Isrc/SIM/bsp (BSP shims and FreeRTOSConfig.h)
+ *   - SCU (lwIP) is not part of the host build.
+ *
+ * The PL address windows (BRAM 0x40000000~, XADC) are mapped at their physical
+ * addresses, so the firmware runs unmodified against the emulated fabric.
+ * Traffic rates are read from the environment at SimPlInit() (see SIM_ENV_*).
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SIM_PL_H__
+#define __SIM_PL_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "../common/common.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+/* Environment variables (rates in Hz) */
+#define SIM_ENV_IRQ_HZ          "SIM_IRQ_HZ"        // IRQ0 sync interrupt rate (default 50)
+#define SIM_ENV_GPS_HZ          "SIM_GPS_HZ"        // SLOT#1 GPS packet rate (default 10)
+#define SIM_ENV_IMU_HZ          "SIM_IMU_HZ"        // SLOT#2 STIM300 record rate (default 2000)
+#define SIM_ENV_IMU_RECORDS     "SIM_IMU_RECORDS"   // STIM300 records per BRAM packet (default 1)
+#define SIM_ENV_COM1_HZ         "SIM_COM1_HZ"       // COM1 Ping TC rate (default 1)
+#define SIM_ENV_UART_HZ         "SIM_UART_HZ"       // COM2~6 RX packet rate (default 0)
+#define SIM_ENV_UART_LEN        "SIM_UART_LEN"      // COM2~6 RX packet length (default 64)
+#define SIM_ENV_BAUDRATE        "SIM_BAUDRATE"      // RS422 line rate for TX busy emulation (default 921600)
+#define SIM_ENV_REPORT_SEC      "SIM_REPORT_SEC"    // statistics report period, 0 = off (default 5)
+#define SIM_ENV_START_TEST      "SIM_START_TEST"    // send Start Test TC after PL ready (default 1)
+#define SIM_ENV_CDMA_FAIL       "SIM_CDMA_FAIL"     // SIM_CDMA: refuse every n-th CDMA start, 0 = never (default 0)
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+typedef struct {
+    UInt32 uiIrqHz;
+    UInt32 uiGpsHz;
+    UInt32 uiImuHz;
+    UInt32 uiImuRecords;
+    UInt32 uiCom1Hz;
+    UInt32 uiUartHz;
+    UInt32 uiUartLen;
+    UInt32 uiBaudRate;
+    UInt32 uiReportSec;
+    UInt32 uiStartTest;
+} SimPlConfig_t;
+
+typedef struct {
+    UInt32 uiIrqCnt;                    // IRQ0 raised
+    UInt32 uiGpsPkts;                   // GPS packets written to SLOT#1 BRAM
+    UInt32 uiImuPkts;                   // IMU packets written to SLOT#2 BRAM
+    UInt32 uiImuRecords;                // STIM300 records in those packets
+    UInt32 uiCom1Tc;                    // TC frames written to COM1 RX BRAM
+    UInt32 uiUartRxPkts;                // COM2~6 packets written to RX BRAM
+    UInt32 uiTxFrames[MAX_UART_CH];     // RS422 TX doorbells per channel
+    UInt32 uiTxBytes[MAX_UART_CH];      // RS422 TX payload bytes per channel
+    UInt32 uiTmTestData;                // Svc 1/10 test data TM seen on COM1
+    UInt32 uiTmOther;                   // other TM (ACK, HK) seen on COM1
+    UInt32 uiPongCnt;                   // Ping replies matched
+    UInt32 uiRttMinUs;                  // command-to-reply latency (us)
+    UInt32 uiRttMaxUs;
+    UInt64 ullRttSumUs;
+} SimPlStats_t;
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+void SimPlInit( void );                                     // map PL windows, read configuration
+void SimPlTask( void *pvParameters );                       // fabric traffic generator (1 ms)
+void SimPlRegWrite( UInt32 uiAddr, UInt32 uiValue );        // PS->PL register side effects
+void SimPlGetStats( SimPlStats_t *pStats );
+void SimBspRaiseIrq( UInt32 uiIntId );                      // deliver fabric IRQ (sim_bsp.c)
+void SimBspCdmaStep( void );                                // SIM_CDMA: finish the CDMA transfer in flight (sim_bsp.c)
+
+#endif /* __SIM_PL_H__ */
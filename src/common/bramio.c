@@ -0,0 +1,252 @@
+/**
+ * @file bramio.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief PS <-> PL BRAM Bulk Access Source
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "bramio.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+static UInt8 ucBramBenchSrc[BRAM_BENCH_SIZE] __attribute__((aligned(8)));
+static UInt8 ucBramBenchDst[BRAM_BENCH_SIZE] __attribute__((aligned(8)));
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static SInt32 BramRangeOk(UInt32 uiBramAddr, UInt32 uiLen);
+static void BramLegacyWrite(UInt8 *pBuf, UInt32 uiLen, UInt32 uiBramAddr);
+static void BramLegacyRead(UInt8 *pBuf, UInt32 uiLen, UInt32 uiBramAddr);
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+static SInt32 BramRangeOk(UInt32 uiBramAddr, UInt32 uiLen)
+{
+    if ((uiBramAddr < BRAM_WIN_BASE) || (uiBramAddr >= BRAM_WIN_END)) return FALSE;
+    if (uiLen > (BRAM_WIN_END - uiBramAddr)) return FALSE;
+    return TRUE;
+}
+
+/**
+ * @brief Copy uiLen bytes from BRAM to normal memory
+ * @return SInt32 BRAM_OK or BRAM_ERR_RANGE (nothing copied)
+ */
+SInt32 BramCopyFromPl(void *pDst, UInt32 uiBramAddr, UInt32 uiLen)
+{
+    UInt8 *pD = (UInt8 *)pDst;
+    volatile const u64 *pS64;
+    volatile const u32 *pS32;
+    u64 a, b, c, d;
+    u32 uiWord;
+    u16 usHalf;
+
+    if ((pDst == NULL) || (BramRangeOk(uiBramAddr, uiLen) == FALSE)) return BRAM_ERR_RANGE;
+
+    /* Head: bytes up to a word boundary of the BRAM address */
+    while ((uiLen > 0) && ((uiBramAddr & 3) != 0)) {
+        *pD++ = *(volatile const u8 *)uiBramAddr;
+        uiBramAddr++;
+        uiLen--;
+    }
+
+    /* Both sides 8-byte aligned: 4 x LDRD / STRD per iteration */
+    if ((((UInt32)pD | uiBramAddr) & 7) == 0) {
+        pS64 = (volatile const u64 *)uiBramAddr;
+        while (uiLen >= 32) {
+            a = pS64[0];
+            b = pS64[1];
+            c = pS64[2];
+            d = pS64[3];
+            ((u64 *)pD)[0] = a;
+            ((u64 *)pD)[1] = b;
+            ((u64 *)pD)[2] = c;
+            ((u64 *)pD)[3] = d;
+            pS64 += 4;
+            pD += 32;
+            uiLen -= 32;
+        }
+        uiBramAddr = (UInt32)pS64;
+    }
+
+    /* Words (destination may be unaligned: normal memory) */
+    pS32 = (volatile const u32 *)uiBramAddr;
+    while (uiLen >= 4) {
+        uiWord = *pS32++;
+        memcpy(pD, &uiWord, 4);
+        pD += 4;
+        uiLen -= 4;
+    }
+
+    /* Tail: halfword / byte reads, nothing past the end */
+    uiBramAddr = (UInt32)pS32;
+    if (uiLen >= 2) {
+        usHalf = *(volatile const u16 *)uiBramAddr;
+        memcpy(pD, &usHalf, 2);
+        uiBramAddr += 2;
+        pD += 2;
+        uiLen -= 2;
+    }
+    if (uiLen > 0) {
+        *pD = *(volatile const u8 *)uiBramAddr;
+    }
+
+    return BRAM_OK;
+}
+
+/**
+ * @brief Copy uiLen bytes from normal memory to BRAM (exactly uiLen bytes written)
+ * @return SInt32 BRAM_OK or BRAM_ERR_RANGE (nothing written)
+ */
+SInt32 BramCopyToPl(UInt32 uiBramAddr, const void *pSrc, UInt32 uiLen)
+{
+    const UInt8 *pS = (const UInt8 *)pSrc;
+    volatile u64 *pD64;
+    volatile u32 *pD32;
+    u64 a, b, c, d;
+    u32 uiWord;
+    u16 usHalf;
+
+    if ((pSrc == NULL) || (BramRangeOk(uiBramAddr, uiLen) == FALSE)) return BRAM_ERR_RANGE;
+
+    /* Head: bytes up to a word boundary of the BRAM address */
+    while ((uiLen > 0) && ((uiBramAddr & 3) != 0)) {
+        *(volatile u8 *)uiBramAddr = *pS++;
+        uiBramAddr++;
+        uiLen--;
+    }
+
+    /* Both sides 8-byte aligned: 4 x LDRD / STRD per iteration */
+    if ((((UInt32)pS | uiBramAddr) & 7) == 0) {
+        pD64 = (volatile u64 *)uiBramAddr;
+        while (uiLen >= 32) {
+            a = ((const u64 *)pS)[0];
+            b = ((const u64 *)pS)[1];
+            c = ((const u64 *)pS)[2];
+            d = ((const u64 *)pS)[3];
+            pD64[0] = a;
+            pD64[1] = b;
+            pD64[2] = c;
+            pD64[3] = d;
+            pD64 += 4;
+            pS += 32;
+            uiLen -= 32;
+        }
+        uiBramAddr = (UInt32)pD64;
+    }
+
+    /* Words (source may be unaligned: normal memory) */
+    pD32 = (volatile u32 *)uiBramAddr;
+    while (uiLen >= 4) {
+        memcpy(&uiWord, pS, 4);
+        *pD32++ = uiWord;
+        pS += 4;
+        uiLen -= 4;
+    }
+
+    /* Tail: halfword / byte stores, nothing past the end */
+    uiBramAddr = (UInt32)pD32;
+    if (uiLen >= 2) {
+        memcpy(&usHalf, pS, 2);
+        *(volatile u16 *)uiBramAddr = usHalf;
+        uiBramAddr += 2;
+        pS += 2;
+        uiLen -= 2;
+    }
+    if (uiLen > 0) {
+        *(volatile u8 *)uiBramAddr = *pS;
+    }
+
+    return BRAM_OK;
+}
+
+/* Reference copies of the previous BramWrite / BramRead (benchmark only) */
+static void BramLegacyWrite(UInt8 *pBuf, UInt32 uiLen, UInt32 uiBramAddr)
+{
+    UInt32 i;
+    volatile u8 *pPtr = (volatile u8 *)uiBramAddr;
+
+    for (i = 0; i < uiLen; i++) {
+        pPtr[i] = pBuf[i];
+    }
+}
+
+static void BramLegacyRead(UInt8 *pBuf, UInt32 uiLen, UInt32 uiBramAddr)
+{
+    UInt32 i;
+    volatile u8 *pPtr = (volatile u8 *)uiBramAddr;
+
+    for (i = 0; i < uiLen; i++) {
+        pBuf[i] = pPtr[i];
+    }
+}
+
+/**
+ * @brief Byte-wise vs. bulk BRAM copy throughput (DBG "brmbench")
+ * Uses BRAM_BENCH_ADDR; on the host build this is the simulated BRAM.
+ * @param uiLen Bytes per copy (<= BRAM_BENCH_SIZE)
+ * @param uiIter Copies per measurement
+ */
+void BramBenchmark(UInt32 uiLen, UInt32 uiIter)
+{
+    static const char *pName[4] = { "write byte", "write bulk", "read byte", "read bulk" };
+    UInt64 ullNs[4];
+    UInt32 i, k, uiErr = 0;
+    XTime xStart, xEnd;
+
+    if ((uiLen == 0) || (uiLen > BRAM_BENCH_SIZE)) uiLen = BRAM_BENCH_SIZE;
+    if (uiIter == 0) uiIter = 1;
+
+    for (i = 0; i < uiLen; i++) {
+        ucBramBenchSrc[i] = (UInt8)((i * 7) + 1);
+    }
+
+    for (k = 0; k < 4; k++) {
+        memset(ucBramBenchDst, 0, uiLen);
+
+        XTime_GetTime(&xStart);
+        for (i = 0; i < uiIter; i++) {
+            switch (k) {
+            case 0: BramLegacyWrite(ucBramBenchSrc, uiLen, BRAM_BENCH_ADDR); break;
+            case 1: BramCopyToPl(BRAM_BENCH_ADDR, ucBramBenchSrc, uiLen); break;
+            case 2: BramLegacyRead(ucBramBenchDst, uiLen, BRAM_BENCH_ADDR); break;
+            default: BramCopyFromPl(ucBramBenchDst, BRAM_BENCH_ADDR, uiLen); break;
+            }
+        }
+        XTime_GetTime(&xEnd);
+        ullNs[k] = ((UInt64)(xEnd - xStart) * 1000000000ULL) / COUNTS_PER_SECOND;
+
+        /* Reads must return what the writes left in BRAM */
+        if ((k >= 2) && (memcmp(ucBramBenchDst, ucBramBenchSrc, uiLen) != 0)) uiErr++;
+    }
+
+    /* Unaligned edges: odd offset and length, neighbours untouched */
+    memset(ucBramBenchDst, 0xA5, 16);
+    BramCopyToPl(BRAM_BENCH_ADDR, ucBramBenchDst, 16);
+    BramCopyToPl(BRAM_BENCH_ADDR + 3, &ucBramBenchSrc[1], 9);
+    BramCopyFromPl(&ucBramBenchDst[1], BRAM_BENCH_ADDR + 1, 13);
+    if ((ucBramBenchDst[1] != 0xA5) || (ucBramBenchDst[2] != 0xA5) ||
+        (memcmp(&ucBramBenchDst[3], &ucBramBenchSrc[1], 9) != 0) ||
+        (ucBramBenchDst[12] != 0xA5) || (ucBramBenchDst[13] != 0xA5)) {
+        uiErr++;
+    }
+    if (BramCopyToPl(BRAM_WIN_END - 4, ucBramBenchSrc, 8) != BRAM_ERR_RANGE) uiErr++;
+
+    xil_printf("[BRAM] %u B x %u at 0x%08X, verify %s\r\n", uiLen, uiIter, BRAM_BENCH_ADDR,
+        (uiErr == 0) ? "OK" : "FAIL");
+    for (k = 0; k < 4; k++) {
+        xil_printf("  %-10s %6u ns/copy, %5u MB/s\r\n", pName[k], (UInt32)(ullNs[k] / uiIter),
+            (UInt32)((ullNs[k] != 0) ? (((UInt64)uiLen * uiIter * 1000ULL) / ullNs[k]) : 0));
+    }
+}
@@ -0,0 +1,57 @@
+/**
+ * @file bramio.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief PS <-> PL BRAM Bulk Access Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * BRAM sits behind the 32-bit M_AXI_GP port and is mapped uncached, so every
+ * access is a bus transaction. The copy routines move the aligned middle of
+ * a transfer in 64-bit pairs (LDRD / STRD, 32 bytes per iteration) or 32-bit
+ * words and only touch single bytes / halfwords at the unaligned edges.
+ * Exactly uiLen bytes are read or written; nothing past the end is touched.
+ *
+ * Every call is checked against the PL BRAM window. PsToPlCommand issues a
+ * DMB before the doorbell write, so data written with BramCopyToPl is
+ * visible to the PL before the command that starts its transfer.
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __BRAMIO_H__
+#define __BRAMIO_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "common.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define BRAM_WIN_BASE       BRAM_ADDR_CTL_PL                // PL BRAM window start
+#define BRAM_WIN_END        (BRAM_ADDR_CTL_PCM + 0x2000)    // PL BRAM window end (exclusive)
+
+#define BRAM_BENCH_ADDR     BRAM_ADDR_WR_SLOT_10            // Benchmark scratch (LVDS10 TX, unused)
+#define BRAM_BENCH_SIZE     0x1000
+
+/* Result */
+#define BRAM_OK             0
+#define BRAM_ERR_RANGE      (-1)        // Outside the PL BRAM window / NULL buffer
+
+/* Ordering of BRAM writes before a PL doorbell */
+#ifdef SIM_HOST
+#define BRAM_DMB()          __sync_synchronize()
+#else
+#define BRAM_DMB()          __asm__ __volatile__ ("dmb" : : : "memory")
+#endif
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+SInt32 BramCopyFromPl(void *pDst, UInt32 uiBramAddr, UInt32 uiLen);
+SInt32 BramCopyToPl(UInt32 uiBramAddr, const void *pSrc, UInt32 uiLen);
+
+void BramBenchmark(UInt32 uiLen, UInt32 uiIter);
+
+#endif /* __BRAMIO_H__ */
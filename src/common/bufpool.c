@@ -0,0 +1,169 @@
+/**
+ * @file bufpool.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Fixed-Block Buffer Pool with Reference-Counted Handles
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "bufpool.h"
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static sBufHdr *BufPoolHdr(sBufPool *pPool, void *pBlk);
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @brief Block pointer -> Header (NULL if the pointer is not a pool block)
+ */
+static sBufHdr *BufPoolHdr(sBufPool *pPool, void *pBlk)
+{
+    UInt8 *pHdr = (UInt8 *)pBlk - BUFPOOL_HDR_SIZE;
+
+    if ((pBlk == NULL) || (pHdr < pPool->pBase) || (pHdr >= pPool->pEnd)) return NULL;
+    if ((UInt32)(pHdr - pPool->pBase) % pPool->uiStride != 0) return NULL;
+
+    return (sBufHdr *)pHdr;
+}
+
+/**
+ * @brief Initialize Pool over caller storage
+ * @param pPool Pool
+ * @param pMem Storage (8-byte aligned), see BUFPOOL_MEM_SIZE
+ * @param uiMemSize Storage Size in Bytes
+ * @param uiBlkSize User Block Size in Bytes
+ * @return SInt32 Number of blocks, -1 on error
+ */
+SInt32 BufPoolInit(sBufPool *pPool, void *pMem, UInt32 uiMemSize, UInt32 uiBlkSize)
+{
+    sBufHdr *pHdr;
+    UInt32 i;
+
+    if ((pPool == NULL) || (pMem == NULL) || (uiBlkSize == 0)) return -1;
+
+    pPool->uiStride = BUFPOOL_STRIDE(uiBlkSize);
+    pPool->uiBlkSize = uiBlkSize;
+    pPool->uiBlkCnt = uiMemSize / pPool->uiStride;
+    pPool->pBase = (UInt8 *)pMem;
+    pPool->pEnd = pPool->pBase + (pPool->uiBlkCnt * pPool->uiStride);
+    pPool->pFree = NULL;
+    pPool->uiUsed = 0;
+    pPool->uiHighWater = 0;
+    pPool->uiAllocFail = 0;
+
+    if (pPool->uiBlkCnt == 0) return -1;
+
+    /* Chain all blocks, lowest address first */
+    for (i = pPool->uiBlkCnt; i > 0; i--) {
+        pHdr = (sBufHdr *)(pPool->pBase + ((i - 1) * pPool->uiStride));
+        pHdr->uiRefCnt = 0;
+        pHdr->pNext = pPool->pFree;
+        pPool->pFree = pHdr;
+    }
+
+    return (SInt32)pPool->uiBlkCnt;
+}
+
+/**
+ * @brief Take one block (reference count 1)
+ * @param pPool Pool
+ * @return void* Block, NULL if the pool is empty
+ */
+void *BufPoolAlloc(sBufPool *pPool)
+{
+    UBaseType_t uxSaved;
+    sBufHdr *pHdr;
+
+    uxSaved = taskENTER_CRITICAL_FROM_ISR();
+    pHdr = pPool->pFree;
+    if (pHdr != NULL) {
+        pPool->pFree = pHdr->pNext;
+        pHdr->pNext = NULL;
+        pHdr->uiRefCnt = 1;
+        pPool->uiUsed++;
+        if (pPool->uiUsed > pPool->uiHighWater) pPool->uiHighWater = pPool->uiUsed;
+    } else {
+        pPool->uiAllocFail++;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(uxSaved);
+
+    return (pHdr != NULL) ? ((UInt8 *)pHdr + BUFPOOL_HDR_SIZE) : NULL;
+}
+
+/**
+ * @brief Add a reference (block is shared with another consumer)
+ * @param pPool Pool
+ * @param pBlk Block
+ * @return SInt32 New reference count, -1 if pBlk is not an allocated block
+ */
+SInt32 BufPoolRetain(sBufPool *pPool, void *pBlk)
+{
+    UBaseType_t uxSaved;
+    sBufHdr *pHdr = BufPoolHdr(pPool, pBlk);
+    SInt32 siRef = -1;
+
+    if (pHdr == NULL) return -1;
+
+    uxSaved = taskENTER_CRITICAL_FROM_ISR();
+    if (pHdr->uiRefCnt > 0) siRef = (SInt32)(++pHdr->uiRefCnt);
+    taskEXIT_CRITICAL_FROM_ISR(uxSaved);
+
+    return siRef;
+}
+
+/**
+ * @brief Drop a reference, the block returns to the pool at zero
+ * @param pPool Pool
+ * @param pBlk Block
+ * @return SInt32 Remaining reference count, -1 on invalid / double release
+ */
+SInt32 BufPoolRelease(sBufPool *pPool, void *pBlk)
+{
+    UBaseType_t uxSaved;
+    sBufHdr *pHdr = BufPoolHdr(pPool, pBlk);
+    SInt32 siRef = -1;
+
+    if (pHdr == NULL) return -1;
+
+    uxSaved = taskENTER_CRITICAL_FROM_ISR();
+    if (pHdr->uiRefCnt > 0) {
+        siRef = (SInt32)(--pHdr->uiRefCnt);
+        if (siRef == 0) {
+            pHdr->pNext = pPool->pFree;
+            pPool->pFree = pHdr;
+            pPool->uiUsed--;
+        }
+    }
+    taskEXIT_CRITICAL_FROM_ISR(uxSaved);
+
+    return siRef;
+}
+
+/**
+ * @brief Occupancy / High-water Statistics
+ * @param pPool Pool
+ * @param pStats Snapshot
+ */
+void BufPoolGetStats(sBufPool *pPool, sBufPoolStats *pStats)
+{
+    UBaseType_t uxSaved;
+
+    uxSaved = taskENTER_CRITICAL_FROM_ISR();
+    pStats->uiBlkCnt = pPool->uiBlkCnt;
+    pStats->uiUsed = pPool->uiUsed;
+    pStats->uiHighWater = pPool->uiHighWater;
+    pStats->uiAllocFail = pPool->uiAllocFail;
+    taskEXIT_CRITICAL_FROM_ISR(uxSaved);
+}
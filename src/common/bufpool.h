@@ -0,0 +1,74 @@
+/**
+ * @file bufpool.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Fixed-Block Buffer Pool with Reference-Counted Handles Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Blocks are handed around by pointer (e.g. through FreeRTOS queues of
+ * pointers) instead of being copied. Every block carries a small header
+ * [free-list link | reference count] in front of the user area.
+ * Alloc / Retain / Release are O(1) and may be called from tasks and ISRs.
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __BUFPOOL_H__
+#define __BUFPOOL_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "common.h"
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+/* Block Header (in front of every block) */
+typedef struct sBufHdr
+{
+    struct sBufHdr *pNext;          // Free-list Link
+    UInt32 uiRefCnt;                // 0: Free
+} sBufHdr;
+
+#define BUFPOOL_HDR_SIZE            ((sizeof(sBufHdr) + 7U) & ~7U)  // Block Header (8 on ILP32)
+#define BUFPOOL_STRIDE(size)        (BUFPOOL_HDR_SIZE + (((size) + 7U) & ~7U))
+#define BUFPOOL_MEM_SIZE(size, cnt) (BUFPOOL_STRIDE(size) * (cnt))  // Storage for cnt blocks
+
+/* Pool */
+typedef struct
+{
+    UInt8 *pBase;                   // Storage Start
+    UInt8 *pEnd;                    // Storage End
+    UInt32 uiStride;                // Header + Block (8-byte aligned)
+    UInt32 uiBlkSize;               // User Block Size
+    UInt32 uiBlkCnt;                // Number of Blocks
+    sBufHdr *pFree;                 // Free-list Head
+
+    /* Statistics */
+    UInt32 uiUsed;                  // Blocks in use
+    UInt32 uiHighWater;             // Max. Blocks in use
+    UInt32 uiAllocFail;             // Alloc on empty pool
+} sBufPool;
+
+/* Statistics Snapshot */
+typedef struct
+{
+    UInt32 uiBlkCnt;
+    UInt32 uiUsed;
+    UInt32 uiHighWater;
+    UInt32 uiAllocFail;
+} sBufPoolStats;
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+SInt32 BufPoolInit(sBufPool *pPool, void *pMem, UInt32 uiMemSize, UInt32 uiBlkSize);
+
+void *BufPoolAlloc(sBufPool *pPool);
+SInt32 BufPoolRetain(sBufPool *pPool, void *pBlk);
+SInt32 BufPoolRelease(sBufPool *pPool, void *pBlk);
+
+void BufPoolGetStats(sBufPool *pPool, sBufPoolStats *pStats);
+
+#endif /* __BUFPOOL_H__ */
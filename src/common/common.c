@@ -9,6 +9,10 @@
  */
 #include "xgpiops.h"
 #include "common.h"
+#include "bramio.h"
+#ifdef SIM_HOST
+#include "../SIM/sim_pl.h"
+#endif
 
 /*==============================================================================
  * Gloabal Variables
@@ -23,6 +27,7 @@ UInt16 usUartFlag = 0;			// [TEST] UART 
  *============================================================================*/
 static XGpioPs gGpio;									// GPIO  
 static XGpioPs_Config *pConfigPtr;						// GPIO  ü
+static sCrcSlice8 stCRC32Table;							// CRC32 slicing-by-8 ̺
 
 /*==============================================================================
  * Function Declarations
@@ -32,12 +37,18 @@ void gpioSetFunc(void);																// GPIO 
 void ByteSwap_2( SInt8 *cSource );													// 2bytes SWAP Լ
 void ByteSwap_4( SInt8 *cSource );													// 4bytes SWAP Լ
 void PsToPlCommand( UInt32 uiCmd, UInt32 uiAddr );									// PS->PL  Լ
-void BramRead( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );					// BRAM 1byte Read
-void BramWrite( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );				// BRAM 1byte Write
-void BramWrite16( UInt16 *pMsg, UInt16 usMsgLen, UInt32 uiIndexStart );				// BRAM 2bytes Write
-void BramWrite32( UInt32 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );				// BRAM 4bytes Write
+SInt32 BramRead( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );					// BRAM 1byte Read
+SInt32 BramWrite( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );				// BRAM 1byte Write
+SInt32 BramWrite16( UInt16 *pMsg, UInt16 usMsgLen, UInt32 uiIndexStart );				// BRAM 2bytes Write
+SInt32 BramWrite32( UInt32 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );				// BRAM 4bytes Write
 UInt16 CalcCKS16(UInt32 uiSumOffset, const UInt16 *uspData, UInt32 uiLength);		// 16bits CRC
 UInt32 CalcCRC32(const UInt8 *ucpData, UInt32 uiLength);							// 32bits CRC
+UInt32 CalcCRC32Init(void);															// 32bits CRC   
+UInt32 CalcCRC32Update(UInt32 uiCrc, const UInt8 *pData, UInt32 uiLength);			// 32bits CRC  
+UInt32 CalcCRC32Final(UInt32 uiCrc);												// 32bits CRC   
+void CrcSlice8Init(sCrcSlice8 *pCrc, UInt32 uiPoly, UInt8 ucReflect);				// CRC slicing-by-8 ̺ 
+UInt32 CrcSlice8Update(const sCrcSlice8 *pCrc, UInt32 uiCrc, const UInt8 *pData, UInt32 uiLength);	// CRC slicing-by-8  
+UInt32 CrcByteUpdate(const sCrcSlice8 *pCrc, UInt32 uiCrc, const UInt8 *pData, UInt32 uiLength);	// CRC 1byte ̺  
 
 /*==============================================================================
  * Functions
@@ -131,28 +142,15 @@ void ByteSwap_4( SInt8 *cSource )
 
 /**
  * @fn BramRead
- * @brief BRAM Read Լ
+ * @brief BRAM Read Լ (usMsgLen ŭ )
  * @param pBuf Read Data Buffer
  * @param usMsgLen Read Data Length
  * @param uiIndexStart BRAM Read Address
- * @return void
+ * @return SInt32 BRAM_OK, BRAM_ERR_RANGE (BRAM   : ̺)
  */
-void BramRead( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart )
+SInt32 BramRead( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart )
 {
-	UInt16 usLen;
-	UInt32 uiIndex;
-    UInt32 uiRecvBuf[(MSG_MAX/4)];
-
-	volatile UInt32 *uipPtr = (volatile UInt32 *)(uiIndexStart);
-
-	usLen = (usMsgLen%4 > 0)?(usMsgLen + 4 - (usMsgLen%4)):usMsgLen;
-
-	for( uiIndex = 0; uiIndex < (usLen/4); uiIndex++ )
-	{
-		uiRecvBuf[uiIndex] = uipPtr[uiIndex];
-	}
-
-    memcpy( pBuf, uiRecvBuf, sizeof(uiRecvBuf) );
+	return BramCopyFromPl( pBuf, uiIndexStart, usMsgLen );
 }
 
 /**
@@ -161,146 +159,245 @@ void BramRead( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart )
  * @param pBuf Read Write Buffer (1 byte  )
  * @param usMsgLen Read Write Length
  * @param uiIndexStart BRAM Write Address
- * @return void
+ * @return SInt32 BRAM_OK, BRAM_ERR_RANGE (BRAM   : ̺)
  */
-void BramWrite( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart )
+SInt32 BramWrite( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart )
 {
-	UInt32 uiIndex;
-	volatile UInt8 *uipPtr = (volatile UInt8 *)(uiIndexStart);
-
-	for( uiIndex = 0; uiIndex < usMsgLen; uiIndex++ )
-	{
-		uipPtr[uiIndex] = pBuf[uiIndex];
-	}
+	return BramCopyToPl( uiIndexStart, pBuf, usMsgLen );
 }
 
 /**
  * @fn BramWrite16
  * @brief BRAM Write Լ
- * @param pBuf Read Write Buffer (2 byte  )
+ * @param pBuf Read Write Buffer (2 byte  , Ȧ ̴ 1byte ߰)
  * @param usMsgLen Read Write Length
  * @param uiIndexStart BRAM Write Address
- * @return void
+ * @return SInt32 BRAM_OK, BRAM_ERR_RANGE (BRAM   : ̺)
  */
-void BramWrite16( UInt16 *pMsg, UInt16 usMsgLen, UInt32 uiIndexStart )
+SInt32 BramWrite16( UInt16 *pMsg, UInt16 usMsgLen, UInt32 uiIndexStart )
 {
-	UInt32 uiIndex;
-	volatile UInt16 *uipPtr = (volatile UInt16 *)(uiIndexStart);
-
 	usMsgLen = (usMsgLen%2 > 0)?(usMsgLen+1):usMsgLen;
 
-	for( uiIndex = 0; uiIndex < usMsgLen/2; uiIndex++ )
-	{
-		uipPtr[uiIndex] = pMsg[uiIndex];
-	}
+	return BramCopyToPl( uiIndexStart, pMsg, usMsgLen );
 }
 
 /**
- * @fn BramWrite
+ * @fn BramWrite32
  * @brief BRAM Write Լ
- * @param pBuf Read Write Buffer (1 byte  )
+ * @param pBuf Read Write Buffer (4 byte  ,  byte )
  * @param usMsgLen Read Write Length
  * @param uiIndexStart BRAM Write Address
- * @return void
+ * @return SInt32 BRAM_OK, BRAM_ERR_RANGE (BRAM   : ̺)
  */
-void BramWrite32( UInt32 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart )
+SInt32 BramWrite32( UInt32 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart )
 {
-	UInt32 uiIndex;
-	volatile UInt32 *uipPtr = (volatile UInt32 *)(uiIndexStart);
-
-	for( uiIndex = 0; uiIndex < (usMsgLen/4); uiIndex++ )
-	{
-		uipPtr[uiIndex] = pBuf[uiIndex];
-	}
+	return BramCopyToPl( uiIndexStart, pBuf, usMsgLen & ~3U );
 }
 
 /**
  * @fn PsToPlCommand
- * @brief PS PL  Լ
+ * @brief PS PL  Լ ( BRAM Write Ϸ   Write)
  * @param uiCmd  Է
  * @return void
  */
 void PsToPlCommand( UInt32 uiCmd, UInt32 uiAddr )
 {
 	volatile UInt32 *uipPtr = (volatile UInt32 *)uiAddr;
+
+	/* BRAM Ͱ PL    doorbell */
+	BRAM_DMB();
 	*uipPtr = uiCmd;
+#ifdef SIM_HOST
+	SimPlRegWrite( uiAddr, uiCmd );		// emulated PL register side effects
+#endif
 }
 
 /**
- * @fn CalcCRC32
- * @brief 32bits CRC  Լ
- * @param pData CRC   
- * @param uiLength CRC   
- * @return UInt32 CRC  
+ * @fn CrcSlice8Init
+ * @brief CRC slicing-by-8 ̺  Լ (׽ĺ  1ȸ)
+ * @param pCrc ̺
+ * @param uiPoly ׽ (reflected :  ׽, MSB first : 32bits  , ) CRC-16 0x1021 << 16)
+ * @param ucReflect TRUE : LSB first, FALSE : MSB first
+ * @return void
  */
-UInt32 CalcCRC32(const UInt8 *pData, UInt32 uiLength)
+void CrcSlice8Init(sCrcSlice8 *pCrc, UInt32 uiPoly, UInt8 ucReflect)
 {
-    /* Variable */
-	UInt32 ui = 0, uj = 0, uk = 0; // Simple Loop
-    //------------------------------------------------------------------------------------------------
-	UInt32 uiResult = 0; // Saving Buffer for CRC result
-	UInt32 uiTempBuffer = 0; // Help buffer for calculate the CRC
-	UInt32 uiReadData = 0; // CRC32 Calculate Data
-	UInt32 uiCRCOffset = 0xffffffffL;// CRC32 Old Data
-	UInt32 uiTransData = 0; // Transfer the 32bit Data
-    //------------------------------------------------------------------------------------------------
+	UInt32 ui = 0, uj = 0; // Simple Loop
 	UInt32 uiCRCTable = 0; // Help buffer for make the CRC Table
-    //------------------------------------------------------------------------------------------------
 
-    /* Array */
-	UInt32 uiaCRCTable[256];
-    //------------------------------------------------------------------------------------------------
+	// Make a CRC Calculate Table (byte-wise)
+	for (ui = 0; ui < 256; ui++) {
+		if (ucReflect == TRUE) {
+			uiCRCTable = ui;
+			for (uj = 0; uj < 8; uj++) {
+				uiCRCTable = (uiCRCTable & 0x00000001L) ? ((uiCRCTable >> 1) ^ uiPoly) : (uiCRCTable >> 1);
+			}
+		}
+		else {
+			uiCRCTable = ui << 24;
+			for (uj = 0; uj < 8; uj++) {
+				uiCRCTable = (uiCRCTable & 0x80000000L) ? ((uiCRCTable << 1) ^ uiPoly) : (uiCRCTable << 1);
+			}
+			uiCRCTable &= 0xffffffffL;		// UInt32  64bits  host 
+		}
+
+		pCrc->uiTable[0][ui] = uiCRCTable;
+	}
 
-    memset(uiaCRCTable, 0x00, sizeof(uiaCRCTable));
+	// Make slicing tables : Table[k][n] = CRC of n followed by k zero bytes
+	for (ui = 0; ui < 256; ui++) {
+		for (uj = 1; uj < CRC32_SLICE; uj++) {
+			uiCRCTable = pCrc->uiTable[uj-1][ui];
+			if (ucReflect == TRUE) {
+				pCrc->uiTable[uj][ui] = (uiCRCTable >> 8) ^ pCrc->uiTable[0][uiCRCTable & 0xff];
+			}
+			else {
+				pCrc->uiTable[uj][ui] = ((uiCRCTable << 8) ^ pCrc->uiTable[0][uiCRCTable >> 24]) & 0xffffffffL;
+			}
+		}
+	}
 
-    if((pData != NULL) && (uiLength != 0x00)) {
-        // Set 'ui' Value for Process the Useless Assignment
-        uj = TRUE;
+	pCrc->ucReflect = ucReflect;
+	__sync_synchronize();		// ̺  Ϸ  ÷ 
+	pCrc->ucReady = TRUE;
+}
 
-        // Make a CRC Calculate Table
-        for (uj = 0; uj < 256; uj++) {
+/**
+ * @fn CrcByteUpdate
+ * @brief CRC 1byte ̺   Լ (CrcSlice8Update ܿ bytes, 񱳿 table )
+ * @param pCrc CrcSlice8Init   ̺
+ * @param uiCrc CRC ߰  (MSB first : 32bits  )
+ * @param pData CRC   
+ * @param uiLength CRC   
+ * @return UInt32 CRC ߰ 
+ */
+UInt32 CrcByteUpdate(const sCrcSlice8 *pCrc, UInt32 uiCrc, const UInt8 *pData, UInt32 uiLength)
+{
+	if (pCrc->ucReflect == TRUE) {
+		while (uiLength-- > 0) {
+			uiCrc = (uiCrc >> 8) ^ pCrc->uiTable[0][(uiCrc ^ *pData++) & 0xff];
+		}
+	}
+	else {
+		while (uiLength-- > 0) {
+			uiCrc = (uiCrc << 8) ^ pCrc->uiTable[0][((uiCrc >> 24) ^ *pData++) & 0xff];
+		}
+	}
 
-            uiCRCTable = uj;
+	return uiCrc;
+}
 
-            for (uk = 0; uk < 8; uk++) {
+/**
+ * @fn CrcSlice8Update
+ * @brief CRC slicing-by-8   Լ (CRC-32 / CRC-32C / CRC-16  Ŀ)
+ * @param pCrc CrcSlice8Init   ̺
+ * @param uiCrc CRC ߰  (MSB first : 32bits  )
+ * @param pData CRC   
+ * @param uiLength CRC   
+ * @return UInt32 CRC ߰ 
+ */
+UInt32 CrcSlice8Update(const sCrcSlice8 *pCrc, UInt32 uiCrc, const UInt8 *pData, UInt32 uiLength)
+{
+	const UInt32 (*pT)[256] = pCrc->uiTable;
+	UInt32 uiLow = 0, uiHigh = 0; // 8bytes block
+
+	// 8bytes per iteration (byte composition, no alignment requirement)
+	if (pCrc->ucReflect == TRUE) {
+		while (uiLength >= CRC32_SLICE) {
+			uiLow = uiCrc ^ ((UInt32)pData[0] | ((UInt32)pData[1] << 8) | ((UInt32)pData[2] << 16) | ((UInt32)pData[3] << 24));
+			uiHigh = (UInt32)pData[4] | ((UInt32)pData[5] << 8) | ((UInt32)pData[6] << 16) | ((UInt32)pData[7] << 24);
+
+			uiCrc = pT[7][uiLow & 0xff] ^ pT[6][(uiLow >> 8) & 0xff] ^
+					pT[5][(uiLow >> 16) & 0xff] ^ pT[4][uiLow >> 24] ^
+					pT[3][uiHigh & 0xff] ^ pT[2][(uiHigh >> 8) & 0xff] ^
+					pT[1][(uiHigh >> 16) & 0xff] ^ pT[0][uiHigh >> 24];
+
+			pData += CRC32_SLICE;
+			uiLength -= CRC32_SLICE;
+		}
+	}
+	else {
+		while (uiLength >= CRC32_SLICE) {
+			uiHigh = uiCrc ^ (((UInt32)pData[0] << 24) | ((UInt32)pData[1] << 16) | ((UInt32)pData[2] << 8) | (UInt32)pData[3]);
+			uiLow = ((UInt32)pData[4] << 24) | ((UInt32)pData[5] << 16) | ((UInt32)pData[6] << 8) | (UInt32)pData[7];
+
+			uiCrc = pT[7][(uiHigh >> 24) & 0xff] ^ pT[6][(uiHigh >> 16) & 0xff] ^
+					pT[5][(uiHigh >> 8) & 0xff] ^ pT[4][uiHigh & 0xff] ^
+					pT[3][uiLow >> 24] ^ pT[2][(uiLow >> 16) & 0xff] ^
+					pT[1][(uiLow >> 8) & 0xff] ^ pT[0][uiLow & 0xff];
+
+			pData += CRC32_SLICE;
+			uiLength -= CRC32_SLICE;
+		}
+	}
 
-                if (uiCRCTable & 0x00000001L) {
-                    uiCRCTable = (uiCRCTable >> 1) ^ CRC_POLY_32;
-                } else {
-                    uiCRCTable = uiCRCTable >> 1;
-                }
-            }
+	// Remain bytes
+	return CrcByteUpdate(pCrc, uiCrc, pData, uiLength);
+}
 
-            uiaCRCTable[uj] = uiCRCTable;
-        }
+/**
+ * @fn CalcCRC32Init
+ * @brief 32bits CRC    
+ * @return UInt32 CRC ߰ 
+ */
+UInt32 CalcCRC32Init(void)
+{
+	if (stCRC32Table.ucReady != TRUE) {
+		CrcSlice8Init(&stCRC32Table, CRC_POLY_32, TRUE);
+	}
 
-        // Set 'ui' Value for Process the Useless Assignment
-        ui = TRUE;
+	return 0xffffffffL;
+}
 
-        // Calculate the CRC 32
-        for (ui = 0; ui < uiLength; ui++) {
-            // Set the Read Data
-            uiTransData = pData[ui];
+/**
+ * @fn CalcCRC32Update
+ * @brief 32bits CRC   Լ (slicing-by-8, л   Է)
+ * @param uiCrc CRC ߰  (CalcCRC32Init /  CalcCRC32Update )
+ * @param pData CRC   
+ * @param uiLength CRC   
+ * @return UInt32 CRC ߰ 
+ */
+UInt32 CalcCRC32Update(UInt32 uiCrc, const UInt8 *pData, UInt32 uiLength)
+{
+	if ((pData == NULL) || (uiLength == 0x00)) {
+		return uiCrc;
+	}
 
-            // Change the Read Data
-            uiReadData = (0x000000ffL & uiTransData);
+	if (stCRC32Table.ucReady != TRUE) {
+		CrcSlice8Init(&stCRC32Table, CRC_POLY_32, TRUE);
+	}
 
-            // Calculate CRC 32
-            uiTempBuffer = uiCRCOffset ^ uiReadData;
+	return CrcSlice8Update(&stCRC32Table, uiCrc, pData, uiLength);
+}
 
-            // Make a CRC 32 Result
-            uiCRCOffset = (uiCRCOffset >> 8) ^ uiaCRCTable[uiTempBuffer & 0xff];
+/**
+ * @fn CalcCRC32Final
+ * @brief 32bits CRC    Լ
+ * @param uiCrc CRC ߰ 
+ * @return UInt32 CRC  
+ */
+UInt32 CalcCRC32Final(UInt32 uiCrc)
+{
+	return uiCrc ^ 0xffffffffL;
+}
 
-            // Last change for CRC 32
-            uiResult = uiCRCOffset & 0xffffffffL;
-        }
+/**
+ * @fn CalcCRC32
+ * @brief 32bits CRC  Լ
+ * @param pData CRC   
+ * @param uiLength CRC   
+ * @return UInt32 CRC  
+ */
+UInt32 CalcCRC32(const UInt8 *pData, UInt32 uiLength)
+{
+	UInt32 uiResult = 0; // Saving Buffer for CRC result
 
-        // Generate a CRC 32 Value
-        uiResult ^= 0xffffffffL;
-    }
+	if ((pData != NULL) && (uiLength != 0x00)) {
+		uiResult = CalcCRC32Final(CalcCRC32Update(CalcCRC32Init(), pData, uiLength));
+	}
 
-    // Return the CRC 32 result
-    return uiResult;
+	// Return the CRC 32 result
+	return uiResult;
 }
 
 /**
@@ -121,6 +121,7 @@ enum {
 
 /* --- Checksum --- */
 #define CRC_POLY_32					0xEDB88320L
+#define CRC32_SLICE					8			// CRC32 slicing-by-8 (8bytes  ó)
 
 /* --- Message Max Size --- */
 #define MSG_MAX                     256
@@ -628,6 +629,14 @@ typedef union {
 } __attribute__((packed)) plMeasMsg_t;
 
 
+/* --- CRC slicing-by-8 ̺ (׽ĺ 1, CRC-32 / CRC-32C / CRC-16 ) --- */
+typedef struct {
+	UInt32 uiTable[CRC32_SLICE][256];		// [k][n] = byte n ڿ 0 k bytes  CRC
+	UInt8 ucReflect;						// TRUE : LSB first (reflected), FALSE : MSB first (32bits  )
+	volatile UInt8 ucReady;					// ̺  
+} sCrcSlice8;
+
+
 /*==============================================================================
  * Global Valuable
  *============================================================================*/
@@ -649,11 +658,17 @@ extern void gpioSetFunc(void);																// GPIO ?? (???? ?? ??)
 extern void ByteSwap_2( SInt8 *cSource );													// 2bytes SWAP ??
 extern void ByteSwap_4( SInt8 *cSource );													// 4bytes SWAP Լ
 extern void PsToPlCommand( UInt32 uiCmd, UInt32 uiAddr );									// PS->PL  Լ
-extern void BramRead( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );					// BRAM 1byte Read
-extern void BramWrite( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );					// BRAM 1byte Write
-extern void BramWrite16( UInt16 *pMsg, UInt16 usMsgLen, UInt32 uiIndexStart );				// BRAM 2bytes Write
-extern void BramWrite32( UInt32 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );				// BRAM 4bytes Write
+extern SInt32 BramRead( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );					// BRAM 1byte Read
+extern SInt32 BramWrite( UInt8 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );					// BRAM 1byte Write
+extern SInt32 BramWrite16( UInt16 *pMsg, UInt16 usMsgLen, UInt32 uiIndexStart );				// BRAM 2bytes Write
+extern SInt32 BramWrite32( UInt32 *pBuf, UInt16 usMsgLen, UInt32 uiIndexStart );				// BRAM 4bytes Write
 extern UInt16 CalcCKS16(UInt32 uiSumOffset, const UInt16 *uspData, UInt32 uiLength);		// 16bits CRC
 extern UInt32 CalcCRC32(const UInt8 *ucpData, UInt32 uiLength);								// 32bits CRC
+extern UInt32 CalcCRC32Init(void);																// 32bits CRC   
+extern UInt32 CalcCRC32Update(UInt32 uiCrc, const UInt8 *pData, UInt32 uiLength);				// 32bits CRC  
+extern UInt32 CalcCRC32Final(UInt32 uiCrc);														// 32bits CRC   
+extern void CrcSlice8Init(sCrcSlice8 *pCrc, UInt32 uiPoly, UInt8 ucReflect);					// CRC slicing-by-8 ̺ 
+extern UInt32 CrcSlice8Update(const sCrcSlice8 *pCrc, UInt32 uiCrc, const UInt8 *pData, UInt32 uiLength);	// CRC slicing-by-8  
+extern UInt32 CrcByteUpdate(const sCrcSlice8 *pCrc, UInt32 uiCrc, const UInt8 *pData, UInt32 uiLength);		// CRC 1byte ̺  
 
 #endif 			//__COMMON_H__
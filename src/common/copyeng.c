@@ -0,0 +1,439 @@
+/**
+ * @file copyeng.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Asynchronous BRAM <-> DDR Copy Engine Source
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+/* Driver headers before common.h: its #pragma pack(1) would change their layout */
+#include "xparameters.h"
+#if defined(XPAR_XAXICDMA_NUM_INSTANCES)
+#include "xaxicdma.h"
+#include "xil_cache.h"
+#include "xscugic.h"
+#endif
+
+#include "copyeng.h"
+#include "bramio.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#if (COPY_ENG_BACKEND == COPY_ENG_CDMA)
+#define COPY_CDMA_DEVICE_ID     XPAR_AXICDMA_0_DEVICE_ID
+#define COPY_CDMA_INTR          XPAR_FABRIC_AXI_CDMA_0_CDMA_INTROUT_INTR
+#define COPY_CDMA_PRIORITY      0xA0        // Below the sync IRQ (0x90)
+#endif
+
+#define COPY_BENCH_MAX          COPY_QUEUE_LEN
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+/* Queue: uiQHead written on submit, uiQTail on completion (both under lock) */
+static CopyDesc_t *pCopyQueue[COPY_QUEUE_LEN];
+static UInt32 uiQHead = 0;
+static UInt32 uiQTail = 0;
+static volatile UInt32 uiCopyBusy = 0;      // Engine claimed (CDMA: transfer in flight)
+
+static CopyEngStats_t stCopyStats;
+static UInt8 ucCopyReady = FALSE;
+
+#if (COPY_ENG_BACKEND == COPY_ENG_CDMA)
+static XAxiCdma stCdma;
+#elif (COPY_ENG_BACKEND == COPY_ENG_THREAD)
+static TaskHandle_t xCopyTask = NULL;
+#endif
+
+static CopyDesc_t stCopyBench[COPY_BENCH_MAX];
+static UInt8 ucCopyBenchDst[COPY_BENCH_MAX][BRAM_BENCH_SIZE] __attribute__((aligned(32)));
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static UInt32 CopyIsBram(UInt32 uiAddr);
+#if (COPY_ENG_BACKEND != COPY_ENG_CDMA)
+static void CopyEngCpu(CopyDesc_t *pDesc);
+#endif
+static CopyDesc_t *CopyEngRetire(SInt32 siStatus);
+static void CopyEngComplete(SInt32 siStatus);
+#if (COPY_ENG_BACKEND == COPY_ENG_CDMA)
+static void CopyEngCompleteFromISR(SInt32 siStatus, BaseType_t *pxWoken);
+static void CopyEngStart(BaseType_t *pxWoken);
+static void CopyEngCdmaDone(void *pRef, u32 uiIrqMask, int *pIgnore);
+#else
+static void CopyEngStart(void);
+#endif
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+static UInt32 CopyIsBram(UInt32 uiAddr)
+{
+    return ((uiAddr >= BRAM_WIN_BASE) && (uiAddr < BRAM_WIN_END)) ? TRUE : FALSE;
+}
+
+#if (COPY_ENG_BACKEND != COPY_ENG_CDMA)
+/**
+ * @brief CPU copy of one descriptor (BRAM side through the bramio layer)
+ */
+static void CopyEngCpu(CopyDesc_t *pDesc)
+{
+    if (CopyIsBram(pDesc->uiSrc) == TRUE) {
+        BramCopyFromPl((void *)pDesc->uiDst, pDesc->uiSrc, pDesc->uiLen);
+    } else if (CopyIsBram(pDesc->uiDst) == TRUE) {
+        BramCopyToPl(pDesc->uiDst, (const void *)pDesc->uiSrc, pDesc->uiLen);
+    } else {
+        memcpy((void *)pDesc->uiDst, (const void *)pDesc->uiSrc, pDesc->uiLen);
+    }
+}
+#endif
+
+/**
+ * @brief Pop the descriptor at the head of the queue, update state and call pfnDone
+ * @return CopyDesc_t* retired descriptor (the caller notifies xNotify)
+ */
+static CopyDesc_t *CopyEngRetire(SInt32 siStatus)
+{
+    CopyDesc_t *pDesc;
+    UBaseType_t uxSaved;
+
+    uxSaved = taskENTER_CRITICAL_FROM_ISR();
+    pDesc = pCopyQueue[uiQTail & (COPY_QUEUE_LEN - 1)];
+    uiQTail++;
+    taskEXIT_CRITICAL_FROM_ISR(uxSaved);
+
+#if (COPY_ENG_BACKEND == COPY_ENG_CDMA)
+    if ((siStatus == COPY_OK) && (CopyIsBram(pDesc->uiDst) == FALSE)) {
+        Xil_DCacheInvalidateRange(pDesc->uiDst, pDesc->uiLen);
+    }
+#endif
+
+    if (siStatus == COPY_OK) {
+        stCopyStats.uiDone++;
+        stCopyStats.ullBytes += pDesc->uiLen;
+    } else {
+        stCopyStats.uiError++;
+    }
+
+    pDesc->uiState = (siStatus == COPY_OK) ? COPY_DONE : COPY_ERROR;
+    if (pDesc->pfnDone != NULL) pDesc->pfnDone(pDesc->pArg, siStatus);
+
+    return pDesc;
+}
+
+/**
+ * @brief Finish the head descriptor from task context
+ * Copy task / submitting task (CPU backends), CDMA start failure in a task.
+ */
+static void CopyEngComplete(SInt32 siStatus)
+{
+    CopyDesc_t *pDesc = CopyEngRetire(siStatus);
+
+    if (pDesc->xNotify != NULL) xTaskNotifyGive(pDesc->xNotify);
+}
+
+#if (COPY_ENG_BACKEND == COPY_ENG_CDMA)
+/**
+ * @brief Finish the head descriptor from the CDMA interrupt
+ * pxWoken is set when a higher priority task was woken; the handler yields once.
+ */
+static void CopyEngCompleteFromISR(SInt32 siStatus, BaseType_t *pxWoken)
+{
+    CopyDesc_t *pDesc = CopyEngRetire(siStatus);
+
+    if (pDesc->xNotify != NULL) vTaskNotifyGiveFromISR(pDesc->xNotify, pxWoken);
+}
+#endif
+
+#if (COPY_ENG_BACKEND == COPY_ENG_CDMA)
+/**
+ * @brief Start the head of the queue if the CDMA is idle
+ * @param pxWoken NULL from Submit (task), the handler's flag from the completion IRQ
+ */
+static void CopyEngStart(BaseType_t *pxWoken)
+{
+    CopyDesc_t *pDesc;
+    UBaseType_t uxSaved;
+
+    while (1) {
+        uxSaved = taskENTER_CRITICAL_FROM_ISR();
+        if ((uiCopyBusy != 0) || (uiQHead == uiQTail)) {
+            taskEXIT_CRITICAL_FROM_ISR(uxSaved);
+            return;
+        }
+        uiCopyBusy = 1;
+        pDesc = pCopyQueue[uiQTail & (COPY_QUEUE_LEN - 1)];
+        taskEXIT_CRITICAL_FROM_ISR(uxSaved);
+
+        /* DDR side: write back the source, no dirty lines left over the destination */
+        if (CopyIsBram(pDesc->uiSrc) == FALSE) Xil_DCacheFlushRange(pDesc->uiSrc, pDesc->uiLen);
+        if (CopyIsBram(pDesc->uiDst) == FALSE) Xil_DCacheFlushRange(pDesc->uiDst, pDesc->uiLen);
+
+        if (XAxiCdma_SimpleTransfer(&stCdma, pDesc->uiSrc, pDesc->uiDst, pDesc->uiLen,
+                                    CopyEngCdmaDone, NULL) == XST_SUCCESS) {
+            return;
+        }
+
+        /* Not started: fail this one, try the next */
+        if (pxWoken == NULL) {
+            CopyEngComplete(COPY_ERR_XFER);
+        } else {
+            CopyEngCompleteFromISR(COPY_ERR_XFER, pxWoken);
+        }
+        uiCopyBusy = 0;
+    }
+}
+
+static void CopyEngCdmaDone(void *pRef, u32 uiIrqMask, int *pIgnore)
+{
+    BaseType_t xWoken = pdFALSE;
+
+    (void)pRef;
+    (void)pIgnore;
+
+    if ((uiIrqMask & XAXICDMA_XR_IRQ_ERROR_MASK) != 0) {
+        XAxiCdma_Reset(&stCdma);
+        while (XAxiCdma_ResetIsDone(&stCdma) == 0) {
+        }
+        XAxiCdma_IntrEnable(&stCdma, XAXICDMA_XR_IRQ_ALL_MASK);
+        CopyEngCompleteFromISR(COPY_ERR_XFER, &xWoken);
+    } else {
+        CopyEngCompleteFromISR(COPY_OK, &xWoken);
+    }
+
+    uiCopyBusy = 0;
+    CopyEngStart(&xWoken);
+    portYIELD_FROM_ISR(xWoken);
+}
+#else
+/**
+ * @brief CPU backends: whoever claims the engine copies until the queue is empty
+ */
+static void CopyEngDrain(void)
+{
+    CopyDesc_t *pDesc;
+    UBaseType_t uxSaved;
+
+    uxSaved = taskENTER_CRITICAL_FROM_ISR();
+    if (uiCopyBusy != 0) {
+        taskEXIT_CRITICAL_FROM_ISR(uxSaved);
+        return;
+    }
+    uiCopyBusy = 1;
+    taskEXIT_CRITICAL_FROM_ISR(uxSaved);
+
+    while (1) {
+        uxSaved = taskENTER_CRITICAL_FROM_ISR();
+        if (uiQHead == uiQTail) {
+            uiCopyBusy = 0;
+            taskEXIT_CRITICAL_FROM_ISR(uxSaved);
+            return;
+        }
+        pDesc = pCopyQueue[uiQTail & (COPY_QUEUE_LEN - 1)];
+        taskEXIT_CRITICAL_FROM_ISR(uxSaved);
+
+        CopyEngCpu(pDesc);
+        CopyEngComplete(COPY_OK);
+    }
+}
+
+#if (COPY_ENG_BACKEND == COPY_ENG_THREAD)
+/**
+ * @brief Emulated CDMA: runs the queue in its own task, like the hardware would
+ */
+static void CopyEngTask(void *pvParameters)
+{
+    (void)pvParameters;
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        CopyEngDrain();
+    }
+}
+#endif
+
+static void CopyEngStart(void)
+{
+#if (COPY_ENG_BACKEND == COPY_ENG_THREAD)
+    xTaskNotifyGive(xCopyTask);
+#else
+    CopyEngDrain();
+#endif
+}
+#endif
+
+/**
+ * @brief Bring up the backend (OpuTask, before the OPU tasks are created)
+ * @return SInt32 COPY_OK or COPY_ERR_XFER
+ */
+SInt32 CopyEngInit(void)
+{
+#if (COPY_ENG_BACKEND == COPY_ENG_CDMA)
+    extern XScuGic xInterruptController;
+    XAxiCdma_Config *pCfg;
+
+    pCfg = XAxiCdma_LookupConfig(COPY_CDMA_DEVICE_ID);
+    if ((pCfg == NULL) || (XAxiCdma_CfgInitialize(&stCdma, pCfg, pCfg->BaseAddress) != XST_SUCCESS)) {
+        xil_printf("[COPY] CDMA init failed\r\n");
+        return COPY_ERR_XFER;
+    }
+
+    XScuGic_SetPriorityTriggerType(&xInterruptController, COPY_CDMA_INTR, COPY_CDMA_PRIORITY, 3);
+    if (XScuGic_Connect(&xInterruptController, COPY_CDMA_INTR,
+                        (Xil_InterruptHandler)XAxiCdma_IntrHandler, &stCdma) != XST_SUCCESS) {
+        xil_printf("[COPY] CDMA IRQ connect failed\r\n");
+        return COPY_ERR_XFER;
+    }
+    XScuGic_Enable(&xInterruptController, COPY_CDMA_INTR);
+    XAxiCdma_IntrEnable(&stCdma, XAXICDMA_XR_IRQ_ALL_MASK);
+#elif (COPY_ENG_BACKEND == COPY_ENG_THREAD)
+    xTaskCreate(CopyEngTask, "copy_eng", SCDAU_STACK_SIZE, NULL, tskIDLE_PRIORITY + 3, &xCopyTask);
+#endif
+
+    ucCopyReady = TRUE;
+    return COPY_OK;
+}
+
+/**
+ * @brief Queue a copy (returns at once; the descriptor must stay valid until done)
+ * @return SInt32 COPY_OK, COPY_ERR_PARAM or COPY_ERR_FULL
+ */
+SInt32 CopyEngSubmit(CopyDesc_t *pDesc)
+{
+    UInt32 uiDepth;
+
+    if ((ucCopyReady == FALSE) || (pDesc == NULL) || (pDesc->uiLen == 0) || (pDesc->uiLen > COPY_LEN_MAX)) {
+        return COPY_ERR_PARAM;
+    }
+    if (pDesc->uiState == COPY_QUEUED) return COPY_ERR_PARAM;
+
+    taskENTER_CRITICAL();
+    uiDepth = uiQHead - uiQTail;
+    if (uiDepth >= COPY_QUEUE_LEN) {
+        stCopyStats.uiFull++;
+        taskEXIT_CRITICAL();
+        return COPY_ERR_FULL;
+    }
+    pDesc->uiState = COPY_QUEUED;
+    pCopyQueue[uiQHead & (COPY_QUEUE_LEN - 1)] = pDesc;
+    uiQHead++;
+    stCopyStats.uiSubmit++;
+    if ((uiDepth + 1) > stCopyStats.uiMaxQueue) stCopyStats.uiMaxQueue = uiDepth + 1;
+    taskEXIT_CRITICAL();
+
+#if (COPY_ENG_BACKEND == COPY_ENG_CDMA)
+    CopyEngStart(NULL);
+#else
+    CopyEngStart();
+#endif
+
+    return COPY_OK;
+}
+
+/**
+ * @brief Wait for a descriptor (blocks on the notification if xNotify is the caller)
+ * @return SInt32 COPY_OK, COPY_ERR_XFER or COPY_ERR_TIMEOUT
+ */
+SInt32 CopyEngWait(CopyDesc_t *pDesc, TickType_t xTimeout)
+{
+    TickType_t xStart = xTaskGetTickCount();
+    UInt32 uiOwn = (pDesc->xNotify == xTaskGetCurrentTaskHandle()) ? TRUE : FALSE;
+
+    while (pDesc->uiState == COPY_QUEUED) {
+        if ((xTaskGetTickCount() - xStart) >= xTimeout) return COPY_ERR_TIMEOUT;
+
+        if (uiOwn == TRUE) {
+            ulTaskNotifyTake(pdFALSE, 1);
+        } else {
+            vTaskDelay(1);
+        }
+    }
+
+    return (pDesc->uiState == COPY_DONE) ? COPY_OK : COPY_ERR_XFER;
+}
+
+/**
+ * @brief Backend, queue and counters (DBG "copystat")
+ */
+void CopyEngReport(void)
+{
+    static const char *pBackend[4] = { "-", "AXI CDMA", "thread (emulated)", "inline CPU" };
+    CopyEngStats_t stStats = stCopyStats;
+
+    xil_printf("[COPY] %s, queue %u/%u (max %u), submit %u, done %u, error %u, full %u, %u KB\r\n",
+        pBackend[COPY_ENG_BACKEND], uiQHead - uiQTail, COPY_QUEUE_LEN, stStats.uiMaxQueue,
+        stStats.uiSubmit, stStats.uiDone, stStats.uiError, stStats.uiFull,
+        (UInt32)(stStats.ullBytes / 1024));
+}
+
+/**
+ * @brief CPU copy vs. engine: uiCnt BRAM -> DDR copies of uiLen bytes (DBG "cpybench")
+ * Reports the CPU time spent submitting (what the caller pays) and the time
+ * until the last copy completed.
+ */
+void CopyEngBenchmark(UInt32 uiLen, UInt32 uiCnt)
+{
+    TaskHandle_t xSelf = xTaskGetCurrentTaskHandle();
+    XTime xStart, xSubmit, xEnd;
+    UInt32 i, uiErr = 0;
+    UInt32 uiCpuNs, uiSubmitNs, uiDoneNs;
+    UInt8 ucExp;
+
+    if ((uiLen == 0) || (uiLen > BRAM_BENCH_SIZE)) uiLen = BRAM_BENCH_SIZE;
+    if ((uiCnt == 0) || (uiCnt > COPY_BENCH_MAX)) uiCnt = COPY_BENCH_MAX;
+
+    for (i = 0; i < uiLen; i++) {
+        ucCopyBenchDst[0][i] = (UInt8)(i * 13);
+    }
+    BramCopyToPl(BRAM_BENCH_ADDR, ucCopyBenchDst[0], uiLen);
+
+    /* CPU copies */
+    memset(ucCopyBenchDst, 0, sizeof(ucCopyBenchDst));
+    XTime_GetTime(&xStart);
+    for (i = 0; i < uiCnt; i++) {
+        BramCopyFromPl(ucCopyBenchDst[i], BRAM_BENCH_ADDR, uiLen);
+    }
+    XTime_GetTime(&xEnd);
+    uiCpuNs = (UInt32)(((UInt64)(xEnd - xStart) * 1000000000ULL) / COUNTS_PER_SECOND);
+
+    /* Engine: submit all, then wait for the last */
+    memset(ucCopyBenchDst, 0, sizeof(ucCopyBenchDst));
+    XTime_GetTime(&xStart);
+    for (i = 0; i < uiCnt; i++) {
+        stCopyBench[i].uiSrc = BRAM_BENCH_ADDR;
+        stCopyBench[i].uiDst = (UInt32)ucCopyBenchDst[i];
+        stCopyBench[i].uiLen = uiLen;
+        stCopyBench[i].pfnDone = NULL;
+        stCopyBench[i].pArg = NULL;
+        stCopyBench[i].xNotify = (i == (uiCnt - 1)) ? xSelf : NULL;
+        stCopyBench[i].uiState = COPY_IDLE;
+        if (CopyEngSubmit(&stCopyBench[i]) != COPY_OK) uiErr++;
+    }
+    XTime_GetTime(&xSubmit);
+    for (i = 0; i < uiCnt; i++) {
+        if (CopyEngWait(&stCopyBench[i], pdMS_TO_TICKS(1000)) != COPY_OK) uiErr++;
+    }
+    XTime_GetTime(&xEnd);
+    uiSubmitNs = (UInt32)(((UInt64)(xSubmit - xStart) * 1000000000ULL) / COUNTS_PER_SECOND);
+    uiDoneNs = (UInt32)(((UInt64)(xEnd - xStart) * 1000000000ULL) / COUNTS_PER_SECOND);
+
+    for (i = 0; i < uiCnt; i++) {
+        ucExp = (UInt8)((uiLen - 1) * 13);
+        if ((ucCopyBenchDst[i][0] != 0) || (ucCopyBenchDst[i][uiLen - 1] != ucExp)) uiErr++;
+    }
+
+    xil_printf("[COPY] %u x %u B BRAM -> DDR, verify %s\r\n", uiCnt, uiLen, (uiErr == 0) ? "OK" : "FAIL");
+    xil_printf("  cpu copy  %6u us\r\n", uiCpuNs / 1000);
+    xil_printf("  engine    %6u us submit (cpu), %6u us until done\r\n", uiSubmitNs / 1000, uiDoneNs / 1000);
+    CopyEngReport();
+}
@@ -0,0 +1,116 @@
+/**
+ * @file copyeng.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Asynchronous BRAM <-> DDR Copy Engine Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * A copy is described by a CopyDesc_t owned by the caller. CopyEngSubmit
+ * queues it and returns at once; the engine runs the queue in order and on
+ * completion sets uiState, calls pfnDone and notifies xNotify. The source
+ * and destination must not be touched until the descriptor is done.
+ *
+ * Backends:
+ *   - COPY_ENG_CDMA   AXI CDMA simple mode, one transfer in flight, the
+ *                     completion interrupt starts the next. DDR ranges are
+ *                     flushed before and invalidated after the transfer.
+ *                     Addresses are as seen by the CDMA (same map as the PS).
+ *   - COPY_ENG_THREAD host build: worker task copies and completes like
+ *                     the interrupt would.
+ *   - COPY_ENG_INLINE target without a CDMA: CPU copy inside Submit.
+ *
+ * The host build with SIM_CDMA (make SIM_CDMA=1) selects COPY_ENG_CDMA and
+ * runs it against the CDMA emulated in the BSP shim (sim_bsp.c): transfers
+ * finish on the fabric tick and complete through the connected IRQ handler,
+ * and SIM_CDMA_FAIL=<n> refuses every n-th start to drive the failure path.
+ *
+ * While a descriptor is queued the CPU must not write to cache lines it
+ * shares with the destination (the invalidate after the transfer would
+ * drop or write back over them).
+ *
+ * pfnDone runs in the completion context (interrupt on the CDMA backend):
+ * keep it short and use FromISR calls only.
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __COPYENG_H__
+#define __COPYENG_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "xparameters.h"         // XPAR_XAXICDMA_NUM_INSTANCES (backend selection)
+#include "common.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define COPY_ENG_CDMA       1
+#define COPY_ENG_THREAD     2
+#define COPY_ENG_INLINE     3
+
+#if defined(SIM_HOST) && !defined(SIM_CDMA)
+#define COPY_ENG_BACKEND    COPY_ENG_THREAD
+#elif defined(XPAR_XAXICDMA_NUM_INSTANCES)
+#define COPY_ENG_BACKEND    COPY_ENG_CDMA
+#else
+#define COPY_ENG_BACKEND    COPY_ENG_INLINE
+#endif
+
+#define COPY_QUEUE_LEN      32          // Descriptors queued (power of two)
+#define COPY_LEN_MAX        0x7FFFFF    // CDMA BTT field (23 bit)
+
+/* Descriptor State */
+#define COPY_IDLE           0
+#define COPY_QUEUED         1
+#define COPY_DONE           2
+#define COPY_ERROR          3
+
+/* Result */
+#define COPY_OK             0
+#define COPY_ERR_PARAM      (-1)        // NULL / zero or too long / descriptor busy
+#define COPY_ERR_FULL       (-2)        // Queue full
+#define COPY_ERR_TIMEOUT    (-3)        // CopyEngWait timeout
+#define COPY_ERR_XFER       (-4)        // Transfer error (CDMA)
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+typedef void (*CopyDone_t)(void *pArg, SInt32 siStatus);
+
+#pragma pack(push)
+#pragma pack()
+typedef struct {
+    UInt32 uiSrc;
+    UInt32 uiDst;
+    UInt32 uiLen;
+    CopyDone_t pfnDone;         // Completion callback (NULL: none)
+    void *pArg;
+    TaskHandle_t xNotify;       // Task notified on completion (NULL: none)
+    volatile UInt32 uiState;    // COPY_xxx
+} CopyDesc_t;
+
+typedef struct {
+    UInt32 uiSubmit;
+    UInt32 uiDone;
+    UInt32 uiError;
+    UInt32 uiFull;              // Submit rejected, queue full
+    UInt32 uiMaxQueue;          // Deepest queue seen
+    UInt64 ullBytes;
+} CopyEngStats_t;
+#pragma pack(pop)
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+SInt32 CopyEngInit(void);
+SInt32 CopyEngSubmit(CopyDesc_t *pDesc);
+SInt32 CopyEngWait(CopyDesc_t *pDesc, TickType_t xTimeout);
+
+void CopyEngReport(void);
+void CopyEngBenchmark(UInt32 uiLen, UInt32 uiCnt);
+
+#endif /* __COPYENG_H__ */
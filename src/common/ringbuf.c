@@ -0,0 +1,311 @@
+/**
+ * @file ringbuf.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Single-Producer / Single-Consumer Lock-free Byte Ring
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+#include "ringbuf.h"
+#include "stress.h"
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+/* Stress Test */
+static sRingBufInfo stStressRb;
+static UInt8 ucStressBuf[RB_STRESS_SIZE] __attribute__((aligned(4)));
+static volatile UInt8 ucStressProdDone;
+static UInt32 uiStressPush, uiStressFull;          // Producer
+static UInt32 uiStressPop, uiStressErr;            // Consumer
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static UInt32 RingBufStressLen(UInt32 uiSeq);
+static void RingBufStressProducer(void);
+static void RingBufStressConsumer(void);
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @brief Initialize Ring buffer
+ * @param pRb Ring buffer Info
+ * @param pBuf Buffer (4-byte aligned)
+ * @param uiSize Capacity in Bytes (power of two)
+ * @return SInt32 0 on success, -1 on invalid size
+ */
+SInt32 RingBufInit(sRingBufInfo *pRb, UInt8 *pBuf, UInt32 uiSize)
+{
+    if ((uiSize < (RB_REC_HDR * 2)) || ((uiSize & (uiSize - 1)) != 0)) return -1;
+
+    pRb->uiAddr = (UInt32)pBuf;
+    pRb->uiSize = uiSize;
+    pRb->uiMask = uiSize - 1;
+    pRb->uiHead = 0;
+    pRb->uiPushCnt = 0;
+    pRb->uiResv = 0;
+    pRb->uiResvLen = 0;
+    pRb->uiDrop = 0;
+    pRb->uiTail = 0;
+    pRb->uiPopCnt = 0;
+
+    return 0;
+}
+
+/**
+ * @brief Reserve contiguous space for one record (producer only)
+ * @param pRb Ring buffer Info
+ * @param uiLen Maximum Data Length to be written
+ * @return UInt8* Data pointer, NULL if the ring is full (nothing is dropped)
+ */
+UInt8 *RingBufReserve(sRingBufInfo *pRb, UInt32 uiLen)
+{
+    UInt8 *pAddr = (UInt8 *)pRb->uiAddr;
+    UInt32 uiHead = pRb->uiHead;
+    UInt32 uiRecLen = RB_REC_HDR + RB_ALIGN4(uiLen);
+    UInt32 uiOff = uiHead & pRb->uiMask;
+    UInt32 uiEnd = pRb->uiSize - uiOff;             // Contiguous Bytes up to the end
+    UInt32 uiFree;
+
+    /* Acquire: the consumer is done with everything before uiTail */
+    uiFree = pRb->uiSize - (uiHead - pRb->uiTail);
+    RB_DMB();
+
+    if (uiRecLen > uiEnd) {
+        /* Skip the tail area and place the record at offset 0 */
+        if (uiFree < (uiEnd + uiRecLen)) {
+            pRb->uiDrop++;
+            return NULL;
+        }
+        *(u32 *)&pAddr[uiOff] = RB_WRAP_MARK;
+        pRb->uiResv = uiHead + uiEnd;
+    } else {
+        if (uiFree < uiRecLen) {
+            pRb->uiDrop++;
+            return NULL;
+        }
+        pRb->uiResv = uiHead;
+    }
+    pRb->uiResvLen = uiLen;
+
+    return &pAddr[(pRb->uiResv & pRb->uiMask) + RB_REC_HDR];
+}
+
+/**
+ * @brief Publish the record written after RingBufReserve (producer only)
+ * @param pRb Ring buffer Info
+ * @param uiLen Data Length actually written (<= reserved length)
+ * @return SInt32 0 on success, -1 on error
+ */
+SInt32 RingBufCommit(sRingBufInfo *pRb, UInt32 uiLen)
+{
+    UInt8 *pAddr = (UInt8 *)pRb->uiAddr;
+
+    if (uiLen > pRb->uiResvLen) return -1;
+
+    *(u32 *)&pAddr[pRb->uiResv & pRb->uiMask] = uiLen;
+
+    /* Release: record (and wrap mark) visible before the new head */
+    RB_DMB();
+    pRb->uiPushCnt++;
+    pRb->uiHead = pRb->uiResv + RB_REC_HDR + RB_ALIGN4(uiLen);
+    pRb->uiResvLen = 0;
+
+    return 0;
+}
+
+/**
+ * @brief Copy one record into the ring (producer only)
+ * @param pRb Ring buffer Info
+ * @param pData Data pointer
+ * @param uiLen Data Length
+ * @return SInt32 0 on success, -1 if the ring is full (new record is dropped)
+ */
+SInt32 RingBufPush(sRingBufInfo *pRb, const void *pData, UInt32 uiLen)
+{
+    UInt8 *pDst = RingBufReserve(pRb, uiLen);
+
+    if (pDst == NULL) return -1;
+
+    memcpy(pDst, pData, uiLen);
+
+    return RingBufCommit(pRb, uiLen);
+}
+
+/**
+ * @brief Copy out the oldest record (consumer only)
+ * @param pRb Ring buffer Info
+ * @param pData Destination (NULL to discard)
+ * @param uiMaxLen Destination size, longer records are truncated
+ * @param pLen Record Length (may be NULL)
+ * @return SInt32 -1 if empty, otherwise number of records left
+ */
+SInt32 RingBufPop(sRingBufInfo *pRb, UInt8 *pData, UInt32 uiMaxLen, UInt32 *pLen)
+{
+    UInt8 *pAddr = (UInt8 *)pRb->uiAddr;
+    UInt32 uiTail = pRb->uiTail;
+    UInt32 uiOff;
+    UInt32 uiLen;
+
+    if (pRb->uiHead == uiTail) return -1;
+
+    /* Acquire: record contents are read after the head that published them */
+    RB_DMB();
+
+    uiOff = uiTail & pRb->uiMask;
+    uiLen = *(u32 *)&pAddr[uiOff];
+    if (uiLen == RB_WRAP_MARK) {
+        uiTail += pRb->uiSize - uiOff;
+        uiOff = 0;
+        uiLen = *(u32 *)&pAddr[0];
+    }
+
+    if (pLen != NULL) *pLen = uiLen;
+    if (pData != NULL) {
+        memcpy(pData, &pAddr[uiOff + RB_REC_HDR], (uiLen < uiMaxLen) ? uiLen : uiMaxLen);
+    }
+
+    /* Release: copy finished before the space is handed back */
+    RB_DMB();
+    pRb->uiPopCnt++;
+    pRb->uiTail = uiTail + RB_REC_HDR + RB_ALIGN4(uiLen);
+
+    return RingBufCount(pRb);
+}
+
+/**
+ * @brief Number of records in the ring (exact from either side's own view)
+ * @param pRb Ring buffer Info
+ * @return SInt32 Record Count
+ */
+SInt32 RingBufCount(const sRingBufInfo *pRb)
+{
+    return (SInt32)(pRb->uiPushCnt - pRb->uiPopCnt);
+}
+
+/*==============================================================================
+ * Stress Test
+ *============================================================================*/
+
+/**
+ * @brief Record length derived from the sequence number
+ */
+static UInt32 RingBufStressLen(UInt32 uiSeq)
+{
+    return 4 + ((uiSeq * 37) % (RB_STRESS_MAX_LEN - 3));
+}
+
+/**
+ * @brief Producer: [u32 seq][seq + i ...] records until stopped, retry when full
+ */
+static void RingBufStressProducer(void)
+{
+    UInt32 uiSeq = 0;
+    UInt32 uiLen;
+    UInt32 i;
+    UInt8 *pDst;
+
+    while (StressStopped() == FALSE) {
+        uiLen = RingBufStressLen(uiSeq);
+        pDst = RingBufReserve(&stStressRb, uiLen);
+        if (pDst == NULL) {
+            uiStressFull++;
+            StressYield();
+            continue;
+        }
+
+        memcpy(pDst, &uiSeq, 4);
+        for (i = 4; i < uiLen; i++) pDst[i] = (UInt8)(uiSeq + i);
+        RingBufCommit(&stStressRb, uiLen);
+        uiSeq++;
+    }
+    uiStressPush = uiSeq;
+    RB_DMB();
+    ucStressProdDone = TRUE;
+}
+
+/**
+ * @brief Consumer: check sequence, length and payload of every record
+ */
+static void RingBufStressConsumer(void)
+{
+    UInt8 ucBuf[RB_STRESS_MAX_LEN];
+    UInt32 uiSeq = 0;
+    UInt32 uiRxSeq = 0;
+    UInt32 uiLen;
+    UInt32 i;
+    UInt8 ucDone;
+
+    for (;;) {
+        /* Done flag read before the head, so the last records are still drained */
+        ucDone = ucStressProdDone;
+        RB_DMB();
+        if (RingBufPop(&stStressRb, ucBuf, sizeof(ucBuf), &uiLen) < 0) {
+            if (ucDone == TRUE) break;
+            StressYield();
+            continue;
+        }
+
+        memcpy(&uiRxSeq, ucBuf, 4);
+        if ((uiRxSeq != uiSeq) || (uiLen != RingBufStressLen(uiSeq))) {
+            uiStressErr++;
+            uiSeq = uiRxSeq;
+        } else {
+            for (i = 4; i < uiLen; i++) {
+                if (ucBuf[i] != (UInt8)(uiSeq + i)) {
+                    uiStressErr++;
+                    break;
+                }
+            }
+        }
+        uiSeq++;
+    }
+    uiStressPop = uiSeq;
+}
+
+/**
+ * @brief Run producer and consumer concurrently and verify every record
+ * @param uiSec Test duration in seconds (see StressRun)
+ */
+void RingBufStress(UInt32 uiSec)
+{
+    static const sStressBody stBody[] = {
+        { "RB_CONS", RingBufStressConsumer },
+        { "RB_PROD", RingBufStressProducer },
+    };
+    XTime xStart, xEnd;
+    UInt32 uiUs;
+
+    RingBufInit(&stStressRb, ucStressBuf, RB_STRESS_SIZE);
+    ucStressProdDone = FALSE;
+    uiStressPush = uiStressFull = uiStressPop = uiStressErr = 0;
+
+    XTime_GetTime(&xStart);
+    StressRun(stBody, sizeof(stBody) / sizeof(stBody[0]), uiSec);
+    XTime_GetTime(&xEnd);
+
+    uiUs = (UInt32)((xEnd - xStart) / (COUNTS_PER_SECOND / 1000000));
+    if (uiUs == 0) uiUs = 1;
+
+    xil_printf("[RB] %d s, size %d : push %d, pop %d, full %d, err %d, %d rec/ms -> %s\r\n",
+        (int)uiSec, RB_STRESS_SIZE, (int)uiStressPush, (int)uiStressPop, (int)uiStressFull,
+        (int)uiStressErr, (int)(((UInt64)uiStressPop * 1000) / uiUs),
+        ((uiStressErr == 0) && (uiStressPush == uiStressPop)) ? "PASS" : "FAIL");
+}
@@ -0,0 +1,91 @@
+/**
+ * @file ringbuf.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Single-Producer / Single-Consumer Lock-free Byte Ring Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Records are stored back to back as [u32 Length][Data, 4-byte aligned].
+ * A record that does not fit before the end of the buffer is preceded by
+ * RB_WRAP_MARK and placed at offset 0, so every record is contiguous.
+ *
+ * uiHead is written only by the producer and uiTail only by the consumer.
+ * Both are free-running byte counters, masked with (uiSize - 1) on access.
+ * Several producers on one ring must serialize themselves (e.g. with
+ * a mutex, see SerialTxLock); the consumer side never needs a lock.
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __RINGBUF_H__
+#define __RINGBUF_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "common.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define RB_REC_HDR          4               // Record Header [Length(4)]
+#define RB_WRAP_MARK        0xFFFFFFFF      // Unused Tail Area (continue at offset 0)
+#define RB_ALIGN4(x)        (((x)+3U)&~3U)  // Record 4-byte Alignment
+#define RB_CACHE_LINE       32              // Cortex-A9 L1 Cache Line
+
+/* Memory barrier between payload and index updates */
+#ifdef SIM_HOST
+#define RB_DMB()            __sync_synchronize()
+#else
+#define RB_DMB()            __asm__ __volatile__ ("dmb" : : : "memory")
+#endif
+
+#define RB_STRESS_SIZE      4096            // Stress Test Ring Size
+#define RB_STRESS_MAX_LEN   200             // Stress Test Max Record Length
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+/* Ring buffer Info (producer / consumer fields on separate cache lines,
+ * natural alignment restored over the pack(1) set in common.h) */
+#pragma pack(push)
+#pragma pack()
+typedef struct
+{
+    /* Set once by RingBufInit */
+    UInt32 uiAddr;                  // Buffer Start Address
+    UInt32 uiSize;                  // Capacity (Byte, power of two)
+    UInt32 uiMask;                  // uiSize - 1
+
+    /* Producer */
+    volatile UInt32 uiHead __attribute__((aligned(RB_CACHE_LINE)));  // Write Position
+    volatile UInt32 uiPushCnt;      // Committed Records
+    UInt32 uiResv;                  // Reserved Record Position
+    UInt32 uiResvLen;               // Reserved Data Length
+    UInt32 uiDrop;                  // Records dropped (Ring buffer full)
+
+    /* Consumer */
+    volatile UInt32 uiTail __attribute__((aligned(RB_CACHE_LINE)));  // Read Position
+    volatile UInt32 uiPopCnt;       // Consumed Records
+} sRingBufInfo;
+#pragma pack(pop)
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+SInt32 RingBufInit(sRingBufInfo *pRb, UInt8 *pBuf, UInt32 uiSize);
+
+/* Producer */
+UInt8 *RingBufReserve(sRingBufInfo *pRb, UInt32 uiLen);
+SInt32 RingBufCommit(sRingBufInfo *pRb, UInt32 uiLen);
+SInt32 RingBufPush(sRingBufInfo *pRb, const void *pData, UInt32 uiLen);
+
+/* Consumer */
+SInt32 RingBufPop(sRingBufInfo *pRb, UInt8 *pData, UInt32 uiMaxLen, UInt32 *pLen);
+
+SInt32 RingBufCount(const sRingBufInfo *pRb);
+
+/* Producer / Consumer on separate threads for uiSec seconds */
+void RingBufStress(UInt32 uiSec);
+
+#endif /* __RINGBUF_H__ */
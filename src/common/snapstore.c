@@ -0,0 +1,210 @@
+/**
+ * @file snapstore.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Latest-Value Snapshot Store (Double-Buffered Seqlock)
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+#include "snapstore.h"
+#include "stress.h"
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+/* Stress Test */
+static UInt8 ucStressMem[SNAP_STORE_MEM(SNAP_STRESS_WORDS * 4)] __attribute__((aligned(8)));
+static sSnapStore stStressStore = SNAP_STORE_INIT(ucStressMem, SNAP_STRESS_WORDS * 4);
+static volatile UInt8 ucStressWrDone;
+static UInt32 uiStressWrite;                        // Writer
+static UInt32 uiStressRead, uiStressRetry, uiStressErr;  // Reader
+
+/*==============================================================================
+ * Local Function Declarations
+ *============================================================================*/
+static void SnapStoreStressWriter(void);
+static void SnapStoreStressReader(void);
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @brief Initialize Store over caller storage
+ * @param pStore Store
+ * @param pMem Storage (8-byte aligned), see SNAP_STORE_MEM
+ * @param uiMemSize Storage Size in Bytes
+ * @param uiSize Object Size in Bytes
+ * @return SInt32 0 on success, -1 if the storage is too small
+ */
+SInt32 SnapStoreInit(sSnapStore *pStore, void *pMem, UInt32 uiMemSize, UInt32 uiSize)
+{
+    if ((pStore == NULL) || (pMem == NULL) || (uiMemSize < SNAP_STORE_MEM(uiSize))) return -1;
+
+    memset(pStore, 0, sizeof(sSnapStore));
+    pStore->uiSize = uiSize;
+    pStore->pBuf[0] = (UInt8 *)pMem;
+    pStore->pBuf[1] = (UInt8 *)pMem + SNAP_ALIGN8(uiSize);
+
+    return 0;
+}
+
+/**
+ * @brief Publish a new value (single writer, never waits)
+ *
+ * seq odd  -> readers use copy 1 while copy 0 is rewritten,
+ * seq even -> readers use copy 0 while copy 1 is rewritten.
+ * Copy 1 holds nothing before the first write completes, so seq 1 still
+ * reads as never written (see SnapStoreRead).
+ */
+void SnapStoreWrite(sSnapStore *pStore, const void *pData)
+{
+    UInt32 uiSeq = pStore->uiSeq;
+    sSnapInfo stInfo;
+    XTime xNow;
+
+    XTime_GetTime(&xNow);
+    stInfo.uiSeq = (uiSeq / 2) + 1;
+    stInfo.uiTick = (UInt32)xTaskGetTickCount();
+    stInfo.ullStamp = (UInt64)xNow;
+
+    pStore->uiSeq = uiSeq + 1;
+    SNAP_DMB();
+    memcpy(pStore->pBuf[0], pData, pStore->uiSize);
+    pStore->stInfo[0] = stInfo;
+    SNAP_DMB();
+
+    pStore->uiSeq = uiSeq + 2;
+    SNAP_DMB();
+    memcpy(pStore->pBuf[1], pData, pStore->uiSize);
+    pStore->stInfo[1] = stInfo;
+    SNAP_DMB();
+}
+
+/**
+ * @brief Copy the latest value (any number of readers, never blocks the writer)
+ * @param pStore Store
+ * @param pData Destination (NULL: metadata only)
+ * @param pInfo Sequence / Timestamp of the copied value (may be NULL)
+ * @return SInt32 -1 if no write has completed yet, otherwise number of retries
+ */
+SInt32 SnapStoreRead(sSnapStore *pStore, void *pData, sSnapInfo *pInfo)
+{
+    sSnapInfo stInfo;
+    UInt32 uiSeq, uiIdx;
+    SInt32 siRetry = -1;
+
+    do {
+        siRetry++;
+        uiSeq = pStore->uiSeq;
+        if (uiSeq < 2) return -1;     // 0: never written, 1: first write in progress
+        SNAP_DMB();
+
+        uiIdx = uiSeq & 1;
+        if (pData != NULL) memcpy(pData, pStore->pBuf[uiIdx], pStore->uiSize);
+        stInfo = pStore->stInfo[uiIdx];
+        SNAP_DMB();
+    } while (pStore->uiSeq != uiSeq);
+
+    /* Readers may run concurrently: atomic add (ldrex/strex) */
+    if (siRetry > 0) __sync_fetch_and_add(&pStore->uiRetry, (UInt32)siRetry);
+    if (pInfo != NULL) *pInfo = stInfo;
+
+    return siRetry;
+}
+
+/*==============================================================================
+ * Stress Test
+ *============================================================================*/
+
+/**
+ * @brief Writer: every word of the object = write number
+ */
+static void SnapStoreStressWriter(void)
+{
+    u32 uiObj[SNAP_STRESS_WORDS];
+    UInt32 uiSeq = 0;
+    UInt32 i;
+
+    while (StressStopped() == FALSE) {
+        uiSeq++;
+        for (i = 0; i < SNAP_STRESS_WORDS; i++) uiObj[i] = uiSeq;
+        SnapStoreWrite(&stStressStore, uiObj);
+        if ((uiSeq & 0xFF) == 0) StressYield();
+    }
+    uiStressWrite = uiSeq;
+    SNAP_DMB();
+    ucStressWrDone = TRUE;
+}
+
+/**
+ * @brief Reader: object words equal, equal to the sequence (never 0), never going back
+ */
+static void SnapStoreStressReader(void)
+{
+    u32 uiObj[SNAP_STRESS_WORDS];
+    UInt32 uiLast = 0;
+    sSnapInfo stInfo;
+    SInt32 siRetry;
+    UInt32 i;
+
+    while (ucStressWrDone == FALSE) {
+        siRetry = SnapStoreRead(&stStressStore, uiObj, &stInfo);
+        if (siRetry < 0) {
+            StressYield();
+            continue;
+        }
+        uiStressRead++;
+        uiStressRetry += (UInt32)siRetry;
+
+        if ((stInfo.uiSeq == 0) || (uiObj[0] != stInfo.uiSeq) || (stInfo.uiSeq < uiLast)) {
+            uiStressErr++;
+        } else {
+            for (i = 1; i < SNAP_STRESS_WORDS; i++) {
+                if (uiObj[i] != uiObj[0]) {
+                    uiStressErr++;
+                    break;
+                }
+            }
+        }
+        uiLast = stInfo.uiSeq;
+    }
+}
+
+/**
+ * @brief Run writer and reader concurrently and verify every snapshot
+ * @param uiSec Test duration in seconds (see StressRun)
+ */
+void SnapStoreStress(UInt32 uiSec)
+{
+    static const sStressBody stBody[] = {
+        { "SNAP_RD", SnapStoreStressReader },
+        { "SNAP_WR", SnapStoreStressWriter },
+    };
+
+    memset(ucStressMem, 0, sizeof(ucStressMem));     // A premature read would return zeros
+    SnapStoreInit(&stStressStore, ucStressMem, sizeof(ucStressMem), SNAP_STRESS_WORDS * 4);
+    ucStressWrDone = FALSE;
+    uiStressWrite = uiStressRead = uiStressRetry = uiStressErr = 0;
+
+    StressRun(stBody, sizeof(stBody) / sizeof(stBody[0]), uiSec);
+
+    xil_printf("[SNAP] %d s, %d B : write %d, read %d, retry %d, err %d -> %s\r\n",
+        (int)uiSec, SNAP_STRESS_WORDS * 4, (int)uiStressWrite, (int)uiStressRead,
+        (int)uiStressRetry, (int)uiStressErr,
+        ((uiStressErr == 0) && (uiStressRead > 0)) ? "PASS" : "FAIL");
+}
@@ -0,0 +1,77 @@
+/**
+ * @file snapstore.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Latest-Value Snapshot Store (Double-Buffered Seqlock) Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * One writer publishes the latest value of a fixed-size object, any
+ * number of readers copy consistent snapshots. The writer never waits.
+ * The value is kept twice (seqcount latch): while one copy is rewritten,
+ * readers are steered to the other one, so a reader only repeats its
+ * copy if a complete write finished in the meantime.
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __SNAPSTORE_H__
+#define __SNAPSTORE_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "common.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define SNAP_ALIGN8(x)          (((x) + 7U) & ~7U)
+#define SNAP_STORE_MEM(size)    (2 * SNAP_ALIGN8(size))     // Storage for one store
+
+/* Static initializer over caller storage (see SNAP_STORE_MEM) */
+#define SNAP_STORE_INIT(mem, size)  { 0, (size), { (mem), (mem) + SNAP_ALIGN8(size) }, { { 0, 0, 0 }, { 0, 0, 0 } }, 0 }
+
+/* Memory barrier between sequence and payload accesses */
+#ifdef SIM_HOST
+#define SNAP_DMB()              __sync_synchronize()
+#else
+#define SNAP_DMB()              __asm__ __volatile__ ("dmb" : : : "memory")
+#endif
+
+#define SNAP_STRESS_WORDS       32      // Stress Test Object Size (words)
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+/* Snapshot metadata (natural alignment for the 64-bit stamp) */
+#pragma pack(push)
+#pragma pack()
+typedef struct
+{
+    UInt32 uiSeq;                   // Write Number (1 = first write)
+    UInt32 uiTick;                  // FreeRTOS Tick of the write
+    UInt64 ullStamp;                // Global Timer (XTime) of the write
+} sSnapInfo;
+
+typedef struct
+{
+    volatile UInt32 uiSeq;          // Latch Sequence (2 per write, odd: copy 1 current, < 2: no value yet)
+    UInt32 uiSize;                  // Object Size
+    UInt8 *pBuf[2];                 // Copies
+    sSnapInfo stInfo[2];            // Metadata per copy
+    volatile UInt32 uiRetry;        // Reader retries, all readers (statistics, atomic add)
+} sSnapStore;
+#pragma pack(pop)
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+SInt32 SnapStoreInit(sSnapStore *pStore, void *pMem, UInt32 uiMemSize, UInt32 uiSize);
+
+void SnapStoreWrite(sSnapStore *pStore, const void *pData);
+SInt32 SnapStoreRead(sSnapStore *pStore, void *pData, sSnapInfo *pInfo);
+
+/* Writer / reader on separate threads for uiSec seconds */
+void SnapStoreStress(UInt32 uiSec);
+
+#endif /* __SNAPSTORE_H__ */
@@ -0,0 +1,126 @@
+/**
+ * @file stress.c
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Concurrency Stress Test Harness
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "xil_types.h"
+
+#include "stress.h"
+
+#ifdef SIM_HOST
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/*==============================================================================
+ * Local Variables
+ *============================================================================*/
+static volatile UInt8 ucStressStop;
+static volatile UInt8 ucStressDone[STRESS_BODY_MAX];
+static const sStressBody *pStressBody;
+
+/*==============================================================================
+ * Functions
+ *============================================================================*/
+
+/**
+ * @brief Run one body and flag its completion
+ */
+static void StressBodyRun(UInt32 uiIdx, const sStressBody *pBody)
+{
+    pBody->pfnBody();
+    __sync_synchronize();   // Body results visible before the flag
+    ucStressDone[uiIdx] = TRUE;
+}
+
+#ifdef SIM_HOST
+static void *StressThread(void *p)
+{
+    UInt32 uiIdx = (UInt32)(UINTPTR)p;
+
+    StressBodyRun(uiIdx, &pStressBody[uiIdx]);
+    return NULL;
+}
+#else
+static void StressTask(void *p)
+{
+    UInt32 uiIdx = (UInt32)(UINTPTR)p;
+
+    StressBodyRun(uiIdx, &pStressBody[uiIdx]);
+    vTaskDelete(NULL);
+}
+#endif
+
+/**
+ * @brief Run the bodies concurrently for uiSec seconds
+ * @param pBody Bodies, started in array order (start consumers first)
+ * @param uiCnt Number of bodies (<= STRESS_BODY_MAX)
+ * @param uiSec Time until StressStopped() turns TRUE
+ * @return SInt32 0 after all bodies returned, -1 on invalid arguments
+ *
+ * Not reentrant: one stress run at a time (DBG shell).
+ */
+SInt32 StressRun(const sStressBody *pBody, UInt32 uiCnt, UInt32 uiSec)
+{
+    UInt32 i;
+#ifdef SIM_HOST
+    pthread_t thBody[STRESS_BODY_MAX];
+#endif
+
+    if ((pBody == NULL) || (uiCnt == 0) || (uiCnt > STRESS_BODY_MAX)) return -1;
+
+    pStressBody = pBody;
+    ucStressStop = FALSE;
+    for (i = 0; i < uiCnt; i++) ucStressDone[i] = FALSE;
+    __sync_synchronize();
+
+#ifdef SIM_HOST
+    for (i = 0; i < uiCnt; i++) pthread_create(&thBody[i], NULL, StressThread, (void *)(UINTPTR)i);
+    vTaskDelay(pdMS_TO_TICKS(uiSec * 1000));
+    ucStressStop = TRUE;
+    for (i = 0; i < uiCnt; i++) pthread_join(thBody[i], NULL);
+#else
+    for (i = 0; i < uiCnt; i++) {
+        xTaskCreate(StressTask, pBody[i].pName, SCDAU_STACK_SIZE, (void *)(UINTPTR)i, tskIDLE_PRIORITY + 1, NULL);
+    }
+    vTaskDelay(pdMS_TO_TICKS(uiSec * 1000));
+    ucStressStop = TRUE;
+    for (i = 0; i < uiCnt; i++) {
+        while (ucStressDone[i] == FALSE) vTaskDelay(pdMS_TO_TICKS(10));
+    }
+#endif
+    __sync_synchronize();
+
+    return 0;
+}
+
+/**
+ * @brief TRUE once the run time is over (polled by the bodies)
+ */
+UInt8 StressStopped(void)
+{
+    return ucStressStop;
+}
+
+/**
+ * @brief Give the other bodies the CPU (busy ring, empty store, ...)
+ */
+void StressYield(void)
+{
+#ifdef SIM_HOST
+    sched_yield();
+#else
+    taskYIELD();
+#endif
+}
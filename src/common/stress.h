@@ -0,0 +1,47 @@
+/**
+ * @file stress.h
+ * @author Sebum Chun (sebum.chun@intergravity.tech)
+ * @brief Concurrency Stress Test Harness Header
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Runs the bodies of a stress test (producer / consumer, writer / reader,
+ * ...) concurrently for a given time and waits until all of them returned.
+ * Host build: POSIX threads, i.e. truly parallel on an SMP host.
+ * Target: FreeRTOS tasks at equal priority, interleaved by time slicing.
+ *
+ * @copyright Intergravity Technologies Copyright (c) 2026
+ */
+
+#ifndef __STRESS_H__
+#define __STRESS_H__
+
+/*==============================================================================
+ * Include Files
+ *============================================================================*/
+#include "common.h"
+
+/*==============================================================================
+ * Define
+ *============================================================================*/
+#define STRESS_BODY_MAX         4       // Concurrent bodies per run
+
+/*==============================================================================
+ * Type Definition
+ *============================================================================*/
+typedef struct
+{
+    const char *pName;              // Task Name (target)
+    void (*pfnBody)(void);          // Runs until StressStopped(), then returns
+} sStressBody;
+
+/*==============================================================================
+ * Global Function Declarations
+ *============================================================================*/
+/* Start the bodies in order, stop them after uiSec seconds, wait for all */
+SInt32 StressRun(const sStressBody *pBody, UInt32 uiCnt, UInt32 uiSec);
+
+UInt8 StressStopped(void);
+void StressYield(void);
+
+#endif /* __STRESS_H__ */
@@ -24,12 +24,15 @@
 #include "xil_printf.h"
 
 /* User includes */
-#include "siu/siu_task.h"
-#include "opu/opu_task.h"
+#include "SIU/siu_task.h"
+#include "OPU/opu_task.h"
 #include "common/common.h"
-#include "scu/scu_task.h"
-#include "dbg/dbg_task.h"
+#include "SCU/scu_task.h"
+#include "DBG/dbg_task.h"
 #include "IGNU/Inc/ignu_task.h"
+#ifdef SIM_HOST
+#include "SIM/sim_pl.h"
+#endif
 
 /***********************************************************
 					Gloabal Variables
@@ -71,6 +74,12 @@ int main()
 	printf( "SCDAU Processing Module GINU v0.1.0\n" );
 	gpioSetFunc();
 
+#ifdef SIM_HOST
+	/* Emulated PL fabric (host simulation build) */
+	SimPlInit();
+	xTaskCreate( SimPlTask, ( const char * ) "SIM_PL", SCDAU_STACK_SIZE*4, NULL, configMAX_PRIORITIES-1, NULL );
+#endif
+
 	/* SIU Task ?? */
 	xTaskCreate( SiuTask, 					/* The function that implements the task. */
 				( const char * ) "SIU", 	/* Text name for the task, provided to assist debugging only. */
@@ -87,6 +96,7 @@ int main()
 				tskIDLE_PRIORITY+2,			/* The task runs at the idle priority. */
 				&xOpuTask );
 
+#ifndef SIM_HOST
 	/* SCU Task ?? */
 	xTaskCreate( ScuTask, 					/* The function that implements the task. */
 				( const char * ) "SCU", 	/* Text name for the task, provided to assist debugging only. */
@@ -94,6 +104,7 @@ int main()
 				NULL, 						/* The task parameter is not used, so set to NULL. */
 				tskIDLE_PRIORITY+1,			/* The task runs at the idle priority. */
 				&xScuTask );
+#endif
 
 	/* DBG Task ?? */
 	xTaskCreate( DbgTask, 					/* The function that implements the task. */